@@ -0,0 +1,67 @@
+#!/bin/bash
+# Differential test of the translation to C++.
+#
+# Every program of examples/ and opt/corpus/ is run by the interpreter and
+# translated with --emit-cpp, compiled against aot/liblexon.a and run again
+# with the same input. The standard output, the errors and the exit code
+# must be equal. lexonCasino.p only takes the option that leaves the casino:
+# its games use rand, seeded with the time.
+#
+# Usage: compare.sh [interpreter]
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+INTERPRETER=${1:-$ROOT/interpreter.exe}
+CPP=${CPP:-g++}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Input of each example
+input()
+{
+	case $1 in
+		binario)     echo "45" ;;
+		conversion)  echo "12.5 hola" ;;
+		lexonCasino) echo "4" ;;
+		menu)        echo "Ana x 1 6 x 2 84 36 x 0 x" ;;
+		test_switch) echo "1 2 3 7 0" ;;
+	esac
+}
+
+FAILED=0
+
+for PROGRAM in "$ROOT"/examples/*.p "$ROOT"/opt/corpus/*.p
+do
+	NAME=$(basename "$PROGRAM" .p)
+	printf "%-16s" $NAME
+
+	input $NAME > "$TMP/$NAME.in"
+
+	# The programs are run from their directory, as the errors show the file name
+	cd "$(dirname "$PROGRAM")"
+
+	"$INTERPRETER" $NAME.p < "$TMP/$NAME.in" > "$TMP/$NAME.interpreter" 2>&1
+	echo "exit $?" >> "$TMP/$NAME.interpreter"
+
+	if ! "$INTERPRETER" --emit-cpp "$TMP/$NAME.cpp" $NAME.p > "$TMP/$NAME.emit" 2>&1 ||
+	   ! $CPP -O2 -I "$ROOT" "$TMP/$NAME.cpp" "$ROOT/aot/liblexon.a" -o "$TMP/$NAME.exe" 2> "$TMP/$NAME.errors"
+	then
+		echo "not translated"
+		cat "$TMP/$NAME.emit" "$TMP/$NAME.errors" | head -5
+		FAILED=1
+		continue
+	fi
+
+	"$TMP/$NAME.exe" < "$TMP/$NAME.in" > "$TMP/$NAME.translated" 2>&1
+	echo "exit $?" >> "$TMP/$NAME.translated"
+
+	if cmp -s "$TMP/$NAME.interpreter" "$TMP/$NAME.translated"
+	then
+		echo "ok"
+	else
+		echo "different"
+		diff "$TMP/$NAME.interpreter" "$TMP/$NAME.translated" | head -10
+		FAILED=1
+	fi
+done
+
+exit $FAILED
@@ -0,0 +1,1228 @@
+/*!
+	\file    cppEmitter.cpp
+	\brief   Code of the functions of the CppEmitter class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <list>
+
+#include "cppEmitter.hpp"
+
+#include "../includes/globals.hpp"
+
+#include "../table/table.hpp"
+#include "../table/numericConstant.hpp"
+#include "../table/logicalConstant.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief Kind of the function that computes the type of an expression, as getType
+*/
+static const int TYPE = -1;
+
+/*!
+  \brief Kind of the function that computes the value of an expression with its tag, as evaluate
+*/
+static const int VALUE = 0;
+
+
+/*!
+  \brief Functions of the builtins in the translated program, as in table/init.hpp
+*/
+static struct
+{
+	const char *name;
+	const char *function;
+} builtins[] = {
+	{"sin",     "std::sin"},
+	{"cos",     "std::cos"},
+	{"atan",    "std::atan"},
+	{"log",     "Log"},
+	{"log10",   "Log10"},
+	{"exp",     "Exp"},
+	{"sqrt",    "Sqrt"},
+	{"integer", "integer"},
+	{"abs",     "std::fabs"},
+	{"random",  "Random"},
+	{"atan2",   "Atan2"},
+	{NULL,      NULL}
+};
+
+
+/*!
+  \brief  Text of an integer
+*/
+static std::string text(int number)
+{
+	std::ostringstream out;
+
+	out << number;
+
+	return out.str();
+}
+
+
+/*!
+  \brief  C++ literal of a string
+  \note   The question marks are escaped because -ansi enables the trigraphs
+*/
+static std::string quote(std::string const &value)
+{
+	std::string result = "\"";
+
+	for (size_t i = 0; i < value.size(); i++)
+	{
+		unsigned char c = value[i];
+
+		switch (c)
+		{
+			case '\\': result += "\\\\"; break;
+			case '"':  result += "\\\""; break;
+			case '?':  result += "\\?";  break;
+			case '\n': result += "\\n";  break;
+			case '\t': result += "\\t";  break;
+			case '\r': result += "\\r";  break;
+			default:
+				if ((c < 32) or (c >= 127))
+				{
+					char octal[8];
+					sprintf(octal, "\\%03o", c);
+					result += octal;
+				}
+				else
+					result += c;
+		}
+	}
+
+	return result + "\"";
+}
+
+
+/*!
+  \brief  C++ literal of a double that is read back as the same double
+*/
+static std::string literal(double number)
+{
+	if (number != number)
+		return "std::numeric_limits<double>::quiet_NaN()";
+
+	if (number > 1.7976931348623157e308)
+		return "std::numeric_limits<double>::infinity()";
+
+	if (number < -1.7976931348623157e308)
+		return "(-std::numeric_limits<double>::infinity())";
+
+	char buffer[32];
+	sprintf(buffer, "%.17g", number);
+
+	std::string result = buffer;
+
+	// An integer literal would not be a double
+	if (result.find_first_of(".e") == std::string::npos)
+		result += ".0";
+
+	if (number < 0)
+		result = "(" + result + ")";
+
+	return result;
+}
+
+
+/*!
+  \brief  Tag of lp::Value for a type of the parser
+*/
+static std::string tag(int type)
+{
+	switch (type)
+	{
+		case NUMBER: return "lp::Value::NUMBER";
+		case BOOL:   return "lp::Value::BOOL";
+		case STRING: return "lp::Value::STRING";
+	}
+
+	return "lp::Value::EMPTY";
+}
+
+
+/*!
+  \brief  Call of the runtime that reports an error, on a line of its own
+*/
+static std::string error(std::string const &tabs, int line, const char *message, const char *suggestion,
+                         bool runtime = false)
+{
+	return tabs + (runtime ? "lp::runtimeError(" : "lp::semanticError(") + text(line) + ", "
+	       + quote(message) + ", " + quote(suggestion) + ");\n";
+}
+
+
+/*!
+  \brief  Type of the value of an expression when its type is checked without errors
+  \param  node: expression
+  \return NUMBER, BOOL, STRING or 0 if it depends on the variables
+*/
+static int naturalType(lp::ExpNode *node)
+{
+	if (dynamic_cast<lp::ConstantNode *>(node))
+		return node->getType();
+
+	if (dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::NumericUnaryOperatorNode *>(node)
+		or dynamic_cast<lp::NumericOperatorNode *>(node) or dynamic_cast<lp::BuiltinFunctionNode_0 *>(node)
+		or dynamic_cast<lp::BuiltinFunctionNode_1 *>(node) or dynamic_cast<lp::RandomNode *>(node))
+		return NUMBER;
+
+	if (dynamic_cast<lp::StringNode *>(node) or dynamic_cast<lp::ConcatenationNode *>(node))
+		return STRING;
+
+	if (dynamic_cast<lp::BoolNode *>(node) or dynamic_cast<lp::LogicalUnaryOperatorNode *>(node)
+		or dynamic_cast<lp::RelationalOperatorNode *>(node) or dynamic_cast<lp::LogicalOperatorNode *>(node))
+		return BOOL;
+
+	return 0;
+}
+
+
+/*!
+  \brief  Type of an expression known before the program runs
+  \param  node: expression
+  \return NUMBER, BOOL, STRING or 0 if its getType depends on the variables
+*/
+static int fixedType(lp::ExpNode *node)
+{
+	if (node->_typeFixed)
+		return node->_type;
+
+	// Their getType never looks at the variables
+	if (dynamic_cast<lp::ConstantNode *>(node) or dynamic_cast<lp::NumberNode *>(node)
+		or dynamic_cast<lp::StringNode *>(node) or dynamic_cast<lp::BoolNode *>(node)
+		or dynamic_cast<lp::BuiltinFunctionNode_0 *>(node) or dynamic_cast<lp::RandomNode *>(node))
+		return naturalType(node);
+
+	return 0;
+}
+
+
+/*!
+  \brief  Check if the getType of an expression can report an error
+*/
+static bool isChecking(lp::ExpNode *node)
+{
+	return dynamic_cast<lp::UnaryOperatorNode *>(node) or dynamic_cast<lp::OperatorNode *>(node)
+	       or dynamic_cast<lp::BuiltinFunctionNode_1 *>(node) or dynamic_cast<lp::BuiltinFunctionNode_2 *>(node);
+}
+
+
+/*!
+  \brief  Check if the node redefines the evaluate function of a kind
+  \note   The other evaluate functions of ExpNode return 0, false or an empty string
+*/
+static bool overrides(lp::ExpNode *node, int kind)
+{
+	bool variable = (dynamic_cast<lp::VariableNode *>(node) != NULL);
+
+	switch (kind)
+	{
+		case NUMBER:
+			return variable or dynamic_cast<lp::ConstantNode *>(node) or (naturalType(node) == NUMBER)
+			       or dynamic_cast<lp::BuiltinFunctionNode_2 *>(node);
+		case BOOL:
+			return variable or dynamic_cast<lp::ConstantNode *>(node) or (naturalType(node) == BOOL);
+		case STRING:
+			return variable or (naturalType(node) == STRING);
+	}
+
+	return true;
+}
+
+
+/*!
+  \brief  Name of the function of a builtin in the translated program
+*/
+static std::string builtin(int slot)
+{
+	std::string name = table.getSymbol(slot)->getName();
+
+	for (int i = 0; builtins[i].name != NULL; i++)
+		if (name == builtins[i].name)
+			return builtins[i].function;
+
+	return name;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::CppEmitter::emit(lp::AST *root, std::ostream &out)
+{
+	// The statements are translated first: they define the functions and the variables
+	std::ostringstream program;
+
+	this->emitStatements(root->getStatements(), program, 1);
+
+	out << "// C++ translation of a Lexon program, written by interpreter.exe --emit-cpp" << std::endl;
+	out << "// Build it with: g++ -O2 -I <lexon> program.cpp <lexon>/aot/liblexon.a" << std::endl;
+	out << std::endl;
+	out << "#include <limits>" << std::endl;
+	out << std::endl;
+	out << "#include \"aot/runtime.hpp\"" << std::endl;
+	out << std::endl;
+
+	out << "// Lines of the source file, shown by the errors" << std::endl;
+	out << "static const char *source[] =" << std::endl << "{" << std::endl;
+	std::string line;
+
+	for (int i = 1; source.getLine(i, line); i++)
+		out << "\t" << quote(line) << "," << std::endl;
+	out << "\tNULL" << std::endl << "};" << std::endl << std::endl;
+
+	out << "// Variables of the program" << std::endl;
+	out << "static lp::Value variables[" << (this->_names.empty() ? 1 : this->_names.size()) << "];" << std::endl;
+	out << std::endl;
+	out << "static lp::NamedValue names[] =" << std::endl << "{" << std::endl;
+	for (size_t i = 0; i < this->_names.size(); i++)
+		out << "\t{" << quote(this->_names[i]) << ", &variables[" << i << "]}," << std::endl;
+	out << "\t{NULL, NULL}" << std::endl << "};" << std::endl << std::endl;
+
+	if (not this->_literals.str().empty())
+		out << "// Strings" << std::endl << this->_literals.str() << std::endl;
+
+	out << "// Expressions" << std::endl << std::endl;
+	out << this->_functions.str();
+
+	out << "// Statements" << std::endl;
+	out << "int main()" << std::endl << "{" << std::endl;
+	out << "\t// The errors of the mathematical functions jump back here" << std::endl;
+	out << "\tif (setjmp(begin) != 0)" << std::endl;
+	out << "\t\treturn EXIT_FAILURE;" << std::endl << std::endl;
+	out << "\tlp::start(source, " << columnNumber << ", names);" << std::endl << std::endl;
+	out << program.str();
+	out << std::endl << "\treturn 0;" << std::endl << "}" << std::endl;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string lp::CppEmitter::variable(int slot, std::string const &name)
+{
+	std::map<int, int>::iterator it = this->_variables.find(slot);
+
+	if (it != this->_variables.end())
+		return "variables[" + text(it->second) + "]";
+
+	int index = this->_names.size();
+
+	this->_variables[slot] = index;
+	this->_names.push_back(name);
+
+	return "variables[" + text(index) + "]";
+}
+
+
+int lp::CppEmitter::number(lp::ExpNode *node)
+{
+	std::map<lp::ExpNode *, int>::iterator it = this->_numbers.find(node);
+
+	if (it != this->_numbers.end())
+		return it->second;
+
+	int result = this->_numbers.size();
+
+	this->_numbers[node] = result;
+
+	return result;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::CppEmitter::emitStatements(std::list<lp::Statement *> *stmts, std::ostream &out, int depth)
+{
+	if (stmts == NULL)
+		return;
+
+	std::string tabs(depth, '\t');
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+	{
+		this->emitStatement(*it, out, depth);
+
+		// The enclosing loops follow the number of their variables until it gets another type,
+		// from the innermost one: the loops detached together share the counter of the outermost one
+		for (size_t i = this->_counters.size(); i > 0; i--)
+		{
+			std::string var = this->_counters[i - 1].first;
+			std::string n = text(this->_counters[i - 1].second);
+
+			out << tabs << "if (attached" << n << ") { if (" << var << ".getTag() == lp::Value::NUMBER) *counter" << n
+			    << " = " << var << ".getNumber(); else { attached" << n << " = false;";
+
+			for (size_t j = i - 1; j > 0; j--)
+				if (this->_counters[j - 1].first == var)
+					out << " if (attached" << this->_counters[j - 1].second << ") counter" << n
+					    << " = counter" << this->_counters[j - 1].second << ";";
+
+			out << " } }" << std::endl;
+		}
+	}
+}
+
+
+void lp::CppEmitter::emitStatement(lp::Statement *stmt, std::ostream &out, int depth)
+{
+	std::string tabs(depth, '\t');
+	int line = stmt->_lineNumber;
+
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+		this->emitAssignment(asgn, out, depth);
+
+	else if ((dynamic_cast<lp::PlusAssignmentStmt *>(stmt) != NULL) or (dynamic_cast<lp::MinusAssignmentStmt *>(stmt) != NULL))
+	{
+		lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt);
+		lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt);
+		lp::ExpNode *exp = (plus != NULL) ? plus->getExp() : minus->getExp();
+		std::string var = (plus != NULL) ? this->variable(plus->getSlot(), plus->getId())
+		                                 : this->variable(minus->getSlot(), minus->getId());
+
+		out << tabs << "{" << std::endl;
+
+		if (fixedType(exp) != NUMBER)
+		{
+			out << tabs << "\tif (" << this->call(exp, TYPE, false) << " != lp::Value::NUMBER)" << std::endl;
+			out << error(tabs + "\t\t", line,
+			             (plus != NULL) ? "Incompatible type of expression for Plus Assignment"
+			                            : "Incompatible type of expression for Minus Assignment",
+			             (plus != NULL) ? "Check that the expression is assigned a numeric value before using it in a plus assignment operation."
+			                            : "Check that the expression is assigned a numeric value before using it in a minus assignment operation.")
+			    << std::endl;
+		}
+
+		out << tabs << "\tdouble value = " << this->call(exp, NUMBER, true) << ";" << std::endl << std::endl;
+		out << tabs << "\tif (" << var << ".getTag() != lp::Value::NUMBER)" << std::endl;
+		out << error(tabs + "\t\t", line,
+		             (plus != NULL) ? "Plus assignment operator requires numeric variable."
+		                            : "Minus assignment operator requires numeric variable.",
+		             (plus != NULL) ? "Use a numeric variable before applying '+:=' operator."
+		                            : "Use a numeric variable before applying '-:=' operator.")
+		    << std::endl;
+		out << tabs << "\t" << var << " = lp::Value(" << var << ".getNumber() " << ((plus != NULL) ? "+" : "-")
+		    << " value);" << std::endl;
+		out << tabs << "}" << std::endl;
+	}
+
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+		out << tabs << "lp::print(" << this->call(print->getExp(), VALUE, false) << ", " << line << ");" << std::endl;
+
+	else if (lp::ReadStmt *read = dynamic_cast<lp::ReadStmt *>(stmt))
+		out << tabs << this->variable(read->getSlot(), read->getId()) << " = lp::Value(lp::readNumber());" << std::endl;
+
+	else if (lp::ReadStringStmt *read = dynamic_cast<lp::ReadStringStmt *>(stmt))
+		out << tabs << this->variable(read->getSlot(), read->getId()) << " = lp::Value(lp::readString());" << std::endl;
+
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		out << tabs << "if (" << this->call(ifStmt->getCondition(), BOOL, false) << ")" << std::endl;
+		out << tabs << "{" << std::endl;
+		this->emitStatements(ifStmt->getConsequent(), out, depth + 1);
+		out << tabs << "}" << std::endl;
+
+		if (ifStmt->getAlternative() != NULL)
+		{
+			out << tabs << "else" << std::endl << tabs << "{" << std::endl;
+			this->emitStatements(ifStmt->getAlternative(), out, depth + 1);
+			out << tabs << "}" << std::endl;
+		}
+	}
+
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		out << tabs << "while (" << this->call(whileStmt->getCondition(), BOOL, false) << ")" << std::endl;
+		out << tabs << "{" << std::endl;
+		this->emitStatements(whileStmt->getStatements(), out, depth + 1);
+		out << tabs << "}" << std::endl;
+	}
+
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		out << tabs << "do" << std::endl << tabs << "{" << std::endl;
+		this->emitStatements(doWhile->getStatements(), out, depth + 1);
+		out << tabs << "} while (" << this->call(doWhile->getCondition(), BOOL, false) << ");" << std::endl;
+	}
+
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		out << tabs << "do" << std::endl << tabs << "{" << std::endl;
+		this->emitStatements(repeat->getStatements(), out, depth + 1);
+		out << tabs << "} while (not " << this->call(repeat->getCondition(), BOOL, false) << ");" << std::endl;
+	}
+
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+		this->emitFor(forStmt, out, depth);
+
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+		this->emitSwitch(switchStmt, out, depth);
+
+	else if ((dynamic_cast<lp::UnaryIncrementStmt *>(stmt) != NULL) or (dynamic_cast<lp::UnaryDecrementStmt *>(stmt) != NULL))
+	{
+		lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt);
+		lp::ExpNode *exp = (inc != NULL) ? inc->getExp() : dynamic_cast<lp::UnaryDecrementStmt *>(stmt)->getExp();
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(exp);
+
+		if (var == NULL)
+			out << error(tabs, line,
+			             (inc != NULL) ? "Unary increment can only be applied to variables."
+			                           : "Unary decrement can only be applied to variables.",
+			             (inc != NULL) ? "Use a variable as the operand of the increment operator."
+			                           : "Use a variable as the operand of the decrement operator.");
+		else
+		{
+			std::string value = this->variable(var->getSlot(), var->getId());
+
+			out << tabs << "if (" << value << ".getTag() != lp::Value::NUMBER)" << std::endl;
+			out << error(tabs + "\t", line,
+			             (inc != NULL) ? "Unary increment operation can only be applied to numeric variables."
+			                           : "Unary decrement operation can only be applied to numeric variables.",
+			             (inc != NULL) ? "Ensure that the variable is numeric before applying unary increment."
+			                           : "Ensure that the variable is numeric before applying unary decrement.");
+			out << tabs << value << " = lp::Value(" << value << ".getNumber() " << ((inc != NULL) ? "+" : "-")
+			    << " 1);" << std::endl;
+		}
+	}
+
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(fact->getExp());
+
+		if (var == NULL)
+			out << error(tabs, line, "Unary factorial can only be applied to variables.",
+			             "Use a variable as the operand of the factorial operator.");
+		else
+		{
+			std::string value = this->variable(var->getSlot(), var->getId());
+
+			out << tabs << "{" << std::endl;
+			out << tabs << "\tif (" << value << ".getTag() != lp::Value::NUMBER)" << std::endl;
+			out << error(tabs + "\t\t", line, "Unary factorial operation can only be applied to numeric variables.",
+			             "Ensure that the variable is numeric before applying unary factorial.") << std::endl;
+			out << tabs << "\tdouble value = " << value << ".getNumber();" << std::endl << std::endl;
+			out << tabs << "\tif (value < 0 || value != static_cast<int>(value))" << std::endl;
+			out << error(tabs + "\t\t", line, "Factorial is only defined for non-negative integers.",
+			             "Ensure the variable is a non-negative integer before applying factorial.") << std::endl;
+			out << tabs << "\tint result = 1;" << std::endl;
+			out << tabs << "\tfor (int i = 2; i <= static_cast<int>(value); ++i)" << std::endl;
+			out << tabs << "\t\tresult *= i;" << std::endl;
+			out << tabs << "\t" << value << " = lp::Value(static_cast<double>(result));" << std::endl;
+			out << tabs << "}" << std::endl;
+		}
+	}
+
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+	{
+		out << tabs << "{" << std::endl;
+		this->emitStatements(block->getStatements(), out, depth + 1);
+		out << tabs << "}" << std::endl;
+	}
+
+	else if (dynamic_cast<lp::ClearScreenStmt *>(stmt))
+		out << tabs << "std::cout << CLEAR_SCREEN_TEXT;" << std::endl;
+
+	else if (lp::PlaceStmt *place = dynamic_cast<lp::PlaceStmt *>(stmt))
+		this->emitPlace(place, out, depth);
+
+	// EmptyStmt does nothing
+}
+
+
+void lp::CppEmitter::emitAssignment(lp::AssignmentStmt *stmt, std::ostream &out, int depth)
+{
+	std::string tabs(depth, '\t');
+	std::string var = this->variable(stmt->getSlot(), stmt->getId());
+
+	// Multiple assignment: the strings are not copied, as in the interpreter
+	if (stmt->getExp() == NULL)
+	{
+		lp::AssignmentStmt *second = stmt->getAssignment();
+
+		this->emitAssignment(second, out, depth);
+
+		std::string value = this->variable(second->getSlot(), second->getId());
+
+		out << tabs << "if ((" << value << ".getTag() == lp::Value::NUMBER) or (" << value
+		    << ".getTag() == lp::Value::BOOL))" << std::endl;
+		out << tabs << "\t" << var << " = " << value << ";" << std::endl;
+		return;
+	}
+
+	lp::ExpNode *exp = stmt->getExp();
+
+	// The value of the expression is never EMPTY: getType reports the error
+	if (naturalType(exp) != 0)
+	{
+		out << tabs << var << " = " << this->call(exp, VALUE, false) << ";" << std::endl;
+		return;
+	}
+
+	out << tabs << "{" << std::endl;
+	out << tabs << "\tlp::Value value = " << this->call(exp, VALUE, false) << ";" << std::endl << std::endl;
+	out << tabs << "\tif (value.getTag() == lp::Value::EMPTY)" << std::endl;
+	out << error(tabs + "\t\t", stmt->_lineNumber, "Incompatible type of expression for Assignment",
+	             "Check that the expression is assigned a value of the correct type before using it in an assignment operation.")
+	    << std::endl;
+	out << tabs << "\t" << var << " = value;" << std::endl;
+	out << tabs << "}" << std::endl;
+}
+
+
+void lp::CppEmitter::emitFor(lp::ForStmt *stmt, std::ostream &out, int depth)
+{
+	std::string tabs(depth, '\t');
+	std::string var = this->variable(stmt->getSlot(), stmt->getId());
+	int line = stmt->_lineNumber;
+
+	out << tabs << "{" << std::endl;
+
+	if (fixedType(stmt->getFrom()) != NUMBER)
+	{
+		out << tabs << "\tif (" << this->call(stmt->getFrom(), TYPE, false) << " != lp::Value::NUMBER)" << std::endl;
+		out << error(tabs + "\t\t", line, "'from' value is not numeric.",
+		             "Ensure the 'from' expression evaluates to a numeric value.");
+	}
+
+	if (fixedType(stmt->getTo()) != NUMBER)
+	{
+		out << tabs << "\tif (" << this->call(stmt->getTo(), TYPE, false) << " != lp::Value::NUMBER)" << std::endl;
+		out << error(tabs + "\t\t", line, "'to' value is not numeric.",
+		             "Ensure the 'to' expression evaluates to a numeric value.");
+	}
+
+	if ((stmt->getStep() != NULL) and (fixedType(stmt->getStep()) != NUMBER))
+	{
+		out << tabs << "\tif (" << this->call(stmt->getStep(), TYPE, false) << " != lp::Value::NUMBER)" << std::endl;
+		out << error(tabs + "\t\t", line, "'step' value is not numeric.",
+		             "Ensure the 'step' expression evaluates to a numeric value.");
+	}
+
+	// The upper bound is evaluated before the lower bound, as in the interpreter
+	out << tabs << "\tdouble to = " << this->call(stmt->getTo(), NUMBER, true) << ";" << std::endl;
+	out << tabs << "\tdouble from = " << this->call(stmt->getFrom(), NUMBER, true) << ";" << std::endl << std::endl;
+	out << tabs << "\tif (to < from)" << std::endl;
+	out << error(tabs + "\t\t", line, "Invalid interval: loop upper bound is less than lower bound.",
+	             "Consider swapping 'from' and 'to' values or checking loop direction.") << std::endl;
+
+	out << tabs << "\t" << var << " = lp::Value(" << this->call(stmt->getFrom(), NUMBER, true) << ");" << std::endl;
+	out << tabs << "\tdouble step = 1.0;" << std::endl << std::endl;
+
+	if (stmt->getStep() != NULL)
+	{
+		out << tabs << "\tdouble value = " << this->call(stmt->getStep(), NUMBER, true) << ";" << std::endl << std::endl;
+		out << tabs << "\tif (value <= ERROR_BOUND)" << std::endl;
+		out << error(tabs + "\t\t", line, "Step value must be a numeric constant greater than the error bound.",
+		             "Verify that the step value is numeric and exceeds the defined error bound before use.");
+		out << tabs << "\telse" << std::endl;
+		out << tabs << "\t\tstep = value;" << std::endl << std::endl;
+	}
+
+	// The upper bound is evaluated again before each iteration
+	if (not stmt->writesVariable())
+	{
+		out << tabs << "\tfor (; " << var << ".getNumber() <= " << this->call(stmt->getTo(), NUMBER, false) << "; "
+		    << var << " = lp::Value(" << var << ".getNumber() + step))" << std::endl;
+		out << tabs << "\t{" << std::endl;
+		this->emitStatements(stmt->getStatements(), out, depth + 2);
+		out << tabs << "\t}" << std::endl;
+		out << tabs << "}" << std::endl;
+		return;
+	}
+
+	// The loop counts on the number of its variable until the body gives the
+	// variable another type. Then it goes on counting on a copy of its last
+	// number that the body does not see, as the interpreter does
+	std::string n = text(depth);
+
+	out << tabs << "\tdouble cell" << n << " = " << var << ".getNumber();" << std::endl;
+	out << tabs << "\tdouble *counter" << n << " = &cell" << n << ";" << std::endl;
+	out << tabs << "\tbool attached" << n << " = true;" << std::endl << std::endl;
+	out << tabs << "\tfor (; *counter" << n << " <= " << this->call(stmt->getTo(), NUMBER, false) << "; *counter" << n << " += step)" << std::endl;
+	out << tabs << "\t{" << std::endl;
+	out << tabs << "\t\tif (attached" << n << ")" << std::endl;
+	out << tabs << "\t\t\t" << var << " = lp::Value(*counter" << n << ");" << std::endl << std::endl;
+
+	this->_counters.push_back(std::make_pair(var, depth));
+	this->emitStatements(stmt->getStatements(), out, depth + 2);
+	this->_counters.pop_back();
+
+	out << tabs << "\t}" << std::endl << std::endl;
+
+	// The final value is the first one past the upper bound
+	out << tabs << "\tif (attached" << n << ")" << std::endl;
+	out << tabs << "\t\t" << var << " = lp::Value(*counter" << n << ");" << std::endl;
+	out << tabs << "}" << std::endl;
+}
+
+
+void lp::CppEmitter::emitSwitch(lp::SwitchStmt *stmt, std::ostream &out, int depth)
+{
+	std::string tabs(depth, '\t');
+
+	// The labels of a switch of strings are string literals
+	bool strings = stmt->hasStringLabels();
+
+	out << tabs << "{" << std::endl;
+
+	if (strings)
+	{
+		out << tabs << "\tif (" << this->call(stmt->getExp(), TYPE, false) << " != lp::Value::STRING)" << std::endl;
+		out << error(tabs + "\t\t", stmt->_lineNumber, "Incompatible type of expression for switch",
+		             "Check that the expression of a switch with string labels is a string.") << std::endl;
+		out << tabs << "\tstd::string value = " << this->call(stmt->getExp(), STRING, true) << ";" << std::endl << std::endl;
+	}
+	else
+		out << tabs << "\tdouble value = " << this->call(stmt->getExp(), NUMBER, false) << ";" << std::endl << std::endl;
+
+	// The cases are evaluated in order until one of them matches
+	std::string keyword = "if";
+
+	for (std::list<lp::CaseStmt *>::iterator it = stmt->getCases()->begin(); it != stmt->getCases()->end(); ++it)
+	{
+		if (strings)
+			out << tabs << "\t" << keyword << " (value == " << this->call((*it)->getExp(), STRING, false) << ")" << std::endl;
+		else
+			out << tabs << "\t" << keyword << " (std::fabs(value - " << this->call((*it)->getExp(), NUMBER, false)
+			    << ") < ERROR_BOUND)" << std::endl;
+		out << tabs << "\t{" << std::endl;
+		this->emitStatements((*it)->getStatements(), out, depth + 2);
+		out << tabs << "\t}" << std::endl;
+
+		keyword = "else if";
+	}
+
+	if (stmt->getDefault() != NULL)
+	{
+		if (stmt->getCases()->empty())
+			out << tabs << "\t{" << std::endl;
+		else
+			out << tabs << "\telse" << std::endl << tabs << "\t{" << std::endl;
+
+		this->emitStatements(stmt->getDefault(), out, depth + 2);
+		out << tabs << "\t}" << std::endl;
+	}
+
+	out << tabs << "}" << std::endl;
+}
+
+
+void lp::CppEmitter::emitPlace(lp::PlaceStmt *stmt, std::ostream &out, int depth)
+{
+	std::string tabs(depth, '\t');
+	int line = stmt->_lineNumber;
+	std::string x = this->call(stmt->_x, TYPE, false);
+	std::string y = this->call(stmt->_y, TYPE, false);
+
+	out << tabs << "if ((" << x << " == lp::Value::NUMBER) and (" << y << " == lp::Value::NUMBER))" << std::endl;
+	out << tabs << "{" << std::endl;
+	out << tabs << "\tint x = static_cast<int>(" << this->call(stmt->_x, NUMBER, true) << ");" << std::endl;
+	out << tabs << "\tint y = static_cast<int>(" << this->call(stmt->_y, NUMBER, true) << ");" << std::endl;
+	out << tabs << "\tPLACE(x, y);" << std::endl;
+	out << tabs << "}" << std::endl;
+
+	// The names of two numeric variables: both get the value of the first expression
+	out << tabs << "else if ((" << x << " == lp::Value::STRING) and (" << y << " == lp::Value::STRING))" << std::endl;
+	out << tabs << "{" << std::endl;
+	out << tabs << "\tlp::Value *x = lp::lookup(" << this->call(stmt->_x, STRING, true) << ");" << std::endl;
+	out << tabs << "\tlp::Value *y = lp::lookup(" << this->call(stmt->_y, STRING, true) << ");" << std::endl << std::endl;
+	out << tabs << "\tif ((x == NULL) or (x->getTag() != lp::Value::NUMBER) or (y == NULL) or (y->getTag() != lp::Value::NUMBER))" << std::endl;
+	out << error(tabs + "\t\t", line, "Invalid types for Place statement.",
+	             "Ensure both x and y expressions evaluate to numeric values or valid variable names.") << std::endl;
+	out << tabs << "\t*x = lp::Value(" << this->call(stmt->_x, NUMBER, true) << ");" << std::endl;
+	out << tabs << "\t*y = lp::Value(" << this->call(stmt->_x, NUMBER, true) << ");" << std::endl;
+	out << tabs << "\tPLACE(static_cast<int>(x->getNumber()), static_cast<int>(y->getNumber()));" << std::endl;
+	out << tabs << "}" << std::endl;
+	out << tabs << "else" << std::endl;
+	out << error(tabs + "\t", line, "Invalid types for Place statement.",
+	             "Ensure both x and y expressions evaluate to numeric values or valid variable names.");
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string lp::CppEmitter::call(lp::ExpNode *node, int kind, bool checked)
+{
+	// The values hoisted out of the loops are computed again: the translation is optimized by the C++ compiler
+	if (lp::InvariantNode *invariant = dynamic_cast<lp::InvariantNode *>(node))
+		return this->call(invariant->getExp(), kind, checked);
+
+	lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node);
+
+	if (kind == TYPE)
+	{
+		if (fixedType(node) != 0)
+			return tag(fixedType(node));
+
+		if (var != NULL)
+			return this->variable(var->getSlot(), var->getId()) + ".getTag()";
+
+		return this->define(node, TYPE) + "()";
+	}
+
+	// The evaluate functions of ExpNode
+	if (not overrides(node, kind))
+		return (kind == NUMBER) ? "0.0" : (kind == BOOL) ? "false" : "std::string()";
+
+	// Literals
+	if ((kind == NUMBER) and dynamic_cast<lp::NumberNode *>(node))
+		return literal(dynamic_cast<lp::NumberNode *>(node)->getNumber());
+
+	if ((kind == BOOL) and dynamic_cast<lp::BoolNode *>(node))
+		return dynamic_cast<lp::BoolNode *>(node)->getBool() ? "true" : "false";
+
+	if ((kind == STRING) and dynamic_cast<lp::StringNode *>(node))
+		return "std::string(" + quote(dynamic_cast<lp::StringNode *>(node)->getString()) + ")";
+
+	if (lp::ConstantNode *constant = dynamic_cast<lp::ConstantNode *>(node))
+	{
+		if ((kind == NUMBER) and (node->getType() == NUMBER))
+			return literal(((lp::NumericConstant *) table.getSymbol(constant->getSlot()))->getValue());
+
+		if ((kind == BOOL) and (node->getType() == BOOL))
+			return ((lp::LogicalConstant *) table.getSymbol(constant->getSlot()))->getValue() ? "true" : "false";
+	}
+
+	if (kind == VALUE)
+	{
+		// The value of a variable is shared, not checked
+		if (var != NULL)
+			return this->variable(var->getSlot(), var->getId());
+
+		// The string of a literal is created once
+		if (lp::StringNode *string = dynamic_cast<lp::StringNode *>(node))
+		{
+			std::string name = "literal_" + text(this->number(node));
+
+			if (this->_defined.insert(name).second)
+				this->_literals << "static const lp::Value " << name << "(std::string(" << quote(string->getString())
+				                << "));" << std::endl;
+
+			return name;
+		}
+
+		if (naturalType(node) != 0)
+			return "lp::Value(" + this->call(node, naturalType(node), checked) + ")";
+	}
+
+	std::string result = this->define(node, kind) + "()";
+
+	// getType is called first by the evaluate functions; BuiltinFunctionNode_2 calls it itself
+	if ((not checked) and isChecking(node) and (fixedType(node) == 0)
+		and (dynamic_cast<lp::BuiltinFunctionNode_2 *>(node) == NULL))
+		return "(" + this->define(node, TYPE) + "(), " + result + ")";
+
+	return result;
+}
+
+
+std::string lp::CppEmitter::define(lp::ExpNode *node, int kind)
+{
+	const char *prefix = (kind == TYPE) ? "type_" : (kind == NUMBER) ? "number_" : (kind == BOOL) ? "logic_"
+	                     : (kind == STRING) ? "text_" : "value_";
+	const char *result = (kind == TYPE) ? "int" : (kind == NUMBER) ? "double" : (kind == BOOL) ? "bool"
+	                     : (kind == STRING) ? "std::string" : "lp::Value";
+
+	std::string name = prefix + text(this->number(node));
+
+	if (this->_defined.find(name) != this->_defined.end())
+		return name;
+
+	// The functions of the children are written before the body
+	std::string body;
+
+	switch (kind)
+	{
+		case TYPE:
+			body = this->typeBody(node);
+			break;
+		case NUMBER:
+			body = this->numberBody(node);
+			break;
+		case BOOL:
+			body = this->logicBody(node);
+			break;
+		case STRING:
+			body = this->textBody(node);
+			break;
+		default:
+			// Only BuiltinFunctionNode_2 has a value whose type is not known
+			std::string type = this->define(node, TYPE) + "()";
+			std::string number = this->define(node, NUMBER) + "()";
+
+			body = "\tswitch (" + type + ")\n\t{\n"
+			       "\t\tcase lp::Value::NUMBER:\n\t\t\treturn lp::Value(" + number + ");\n"
+			       "\t\tcase lp::Value::BOOL:\n\t\t\treturn lp::Value(false);\n"
+			       "\t\tcase lp::Value::STRING:\n\t\t\treturn lp::Value(std::string());\n"
+			       "\t}\n\n\treturn lp::Value();\n";
+			break;
+	}
+
+	this->_defined.insert(name);
+	this->_functions << "static " << result << " " << name << "()" << std::endl;
+	this->_functions << "{" << std::endl << body << "}" << std::endl << std::endl;
+
+	return name;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string lp::CppEmitter::typeBody(lp::ExpNode *node)
+{
+	std::ostringstream out;
+	int line = node->_lineNumber;
+
+	if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+	{
+		out << "\tif (" << this->call(unary->getExp(), TYPE, false) << " == lp::Value::NUMBER)" << std::endl;
+		out << "\t\treturn lp::Value::NUMBER;" << std::endl << std::endl;
+		out << error("\t", line, "Incompatible types for \"Numeric Unary Operator\"",
+		             "Check that the expression is assigned a numeric value before using it in a numeric operation.");
+	}
+	else if (lp::LogicalUnaryOperatorNode *unary = dynamic_cast<lp::LogicalUnaryOperatorNode *>(node))
+	{
+		out << "\tif (" << this->call(unary->getExp(), TYPE, false) << " == lp::Value::BOOL)" << std::endl;
+		out << "\t\treturn lp::Value::BOOL;" << std::endl << std::endl;
+		out << error("\t", line, "Incompatible types for \"Logical Unary Operator\"",
+		             "Check that the expression is assigned a boolean value before using it in a logical operation.");
+	}
+	else if (lp::RelationalOperatorNode *binary = dynamic_cast<lp::RelationalOperatorNode *>(node))
+	{
+		// The right operand is only looked at when the left one has a valid type
+		out << "\tint left = " << this->call(binary->getLeft(), TYPE, false) << ";" << std::endl << std::endl;
+		out << "\tif (((left == lp::Value::NUMBER) or (left == lp::Value::BOOL) or (left == lp::Value::STRING))" << std::endl;
+		out << "\t\tand (" << this->call(binary->getRight(), TYPE, false) << " == left))" << std::endl;
+		out << "\t\treturn lp::Value::BOOL;" << std::endl << std::endl;
+		out << error("\t", line, "Incompatible types for \"Relational Operator\"",
+		             "Check that both operands are of the same type before using them in a relational operation.");
+	}
+	else if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+	{
+		int type = naturalType(node);
+		const char *message, *suggestion;
+
+		if (type == NUMBER)
+		{
+			message = "Incompatible types for \"Numeric operator\"";
+			suggestion = "Check that both operands are numeric before using them in a numeric operation.";
+		}
+		else if (type == STRING)
+		{
+			message = "Incompatible types for \"String Operator\"";
+			suggestion = "Check that both operands are strings before using them in a string operation.";
+		}
+		else
+		{
+			message = "Incompatible types for \"Logical Operator\"";
+			suggestion = "Check that both operands are boolean before using them in a logical operation.";
+		}
+
+		out << "\tif ((" << this->call(binary->getLeft(), TYPE, false) << " == " << tag(type) << ")" << std::endl;
+		out << "\t\tand (" << this->call(binary->getRight(), TYPE, false) << " == " << tag(type) << "))" << std::endl;
+		out << "\t\treturn " << tag(type) << ";" << std::endl << std::endl;
+		out << error("\t", line, message, suggestion);
+	}
+	else if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+	{
+		out << "\tif (" << this->call(f->getExp(), TYPE, false) << " == lp::Value::NUMBER)" << std::endl;
+		out << "\t\treturn lp::Value::NUMBER;" << std::endl << std::endl;
+		out << error("\t", line, "Incompatible type for \"BuiltinFunctionNode_1\"",
+		             "Check that the expression is assigned a numeric value before using it in a numeric operation.");
+	}
+	else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		out << "\tint first = " << this->call(f->getExp1(), TYPE, false) << ";" << std::endl;
+		out << "\tint second = " << this->call(f->getExp2(), TYPE, false) << ";" << std::endl << std::endl;
+		out << "\tif ((first == lp::Value::NUMBER) and (second == lp::Value::NUMBER))" << std::endl;
+		out << "\t\treturn lp::Value::NUMBER;" << std::endl << std::endl;
+		out << error("\t", line, "Incompatible types for \"BuiltinFunctionNode_2\"",
+		             "Check that both expressions are assigned numeric values before using them in a numeric operation.");
+	}
+
+	out << "\treturn lp::Value::EMPTY;" << std::endl;
+
+	return out.str();
+}
+
+
+std::string lp::CppEmitter::numberBody(lp::ExpNode *node)
+{
+	std::ostringstream out;
+	int line = node->_lineNumber;
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		std::string value = this->variable(var->getSlot(), var->getId());
+
+		out << "\tif (" << value << ".getTag() != lp::Value::NUMBER)" << std::endl;
+		out << error("\t\t", line, "Variable is not numeric.",
+		             "Check that the variable is assigned a numeric value before using it in a numeric expression.");
+		out << std::endl << "\treturn " << value << ".getNumber();" << std::endl;
+	}
+	else if (dynamic_cast<lp::ConstantNode *>(node))
+	{
+		// A logical constant: the numeric ones are literals
+		out << error("\t", line, "Constant is not numeric.",
+		             "Check that the constant is assigned a numeric value before using it in a numeric expression.");
+		out << "\treturn 0.0;" << std::endl;
+	}
+	else if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+	{
+		std::string exp = this->call(unary->getExp(), NUMBER, true);
+
+		if (dynamic_cast<lp::UnaryMinusNode *>(node))
+			out << "\treturn -(" << exp << ");" << std::endl;
+		else if (dynamic_cast<lp::UnaryPlusNode *>(node))
+			out << "\treturn " << exp << ";" << std::endl;
+		else if (dynamic_cast<lp::UnaryIncrementNode *>(node))
+			out << "\treturn " << exp << " + 1;" << std::endl;
+		else if (dynamic_cast<lp::UnaryDecrementNode *>(node))
+			out << "\treturn " << exp << " - 1;" << std::endl;
+		else
+		{
+			out << "\tdouble value = " << exp << ";" << std::endl << std::endl;
+			out << "\tif (value < 0 || std::floor(value) != value)" << std::endl;
+			out << error("\t\t", line, "Factorial is only defined for non-negative integers.",
+			             "Ensure the expression is a non-negative whole number before applying '!'.") << std::endl;
+			out << "\tdouble result = 1.0;" << std::endl;
+			out << "\tfor (int i = 1; i <= (int) value; ++i)" << std::endl;
+			out << "\t\tresult *= i;" << std::endl << std::endl;
+			out << "\treturn result;" << std::endl;
+		}
+	}
+	else if (lp::NumericOperatorNode *binary = dynamic_cast<lp::NumericOperatorNode *>(node))
+	{
+		std::string left = "\tdouble left = " + this->call(binary->getLeft(), NUMBER, true) + ";\n";
+		std::string right = "\tdouble right = " + this->call(binary->getRight(), NUMBER, true) + ";\n";
+
+		// The operands of pow are evaluated from right to left by the interpreter
+		if (dynamic_cast<lp::PowerNode *>(node))
+			out << right << left;
+		else
+			out << left << right;
+
+		out << std::endl;
+
+		if (dynamic_cast<lp::PlusNode *>(node))
+			out << "\treturn left + right;" << std::endl;
+		else if (dynamic_cast<lp::MinusNode *>(node))
+			out << "\treturn left - right;" << std::endl;
+		else if (dynamic_cast<lp::MultiplicationNode *>(node))
+			out << "\treturn left * right;" << std::endl;
+		else if (dynamic_cast<lp::PowerNode *>(node))
+			out << "\treturn std::pow(left, right);" << std::endl;
+		else if (dynamic_cast<lp::DivisionNode *>(node))
+		{
+			out << "\tif (std::fabs(right) > ERROR_BOUND)" << std::endl;
+			out << "\t\treturn left / right;" << std::endl << std::endl;
+			out << error("\t", line, "Division by zero in DivisionNode.",
+			             "Check that the divisor is not zero before using it in a division operation.", true);
+			out << "\treturn 0.0;" << std::endl;
+		}
+		else if (dynamic_cast<lp::IntegerDivisionNode *>(node))
+		{
+			out << "\tif ((std::fabs(right) > ERROR_BOUND) and (static_cast<int>(right) != 0))" << std::endl;
+			out << "\t\treturn static_cast<double>(static_cast<int>(left) / static_cast<int>(right));" << std::endl << std::endl;
+			out << error("\t", line, "Division by zero in IntegerDivisionNode.",
+			             "Check that the divisor is not zero before using it in an integer division operation.");
+			out << "\treturn 0.0;" << std::endl;
+		}
+		else
+		{
+			out << "\tif (std::fabs(right) > ERROR_BOUND)" << std::endl;
+			out << "\t\treturn (int) left % (int) right;" << std::endl << std::endl;
+			out << error("\t", line, "Division by zero in ModuloNode.",
+			             "Check that the divisor is not zero before using it in a modulo operation.");
+			out << "\treturn 0.0;" << std::endl;
+		}
+	}
+	else if (lp::BuiltinFunctionNode_0 *f = dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+		out << "\treturn " << builtin(f->getSlot()) << "();" << std::endl;
+	else if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		out << "\treturn " << builtin(f->getSlot()) << "(" << this->call(f->getExp(), NUMBER, true) << ");" << std::endl;
+	else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		out << "\tif (" << this->define(node, TYPE) << "() != lp::Value::NUMBER)" << std::endl;
+		out << error("\t\t", line, "Incompatible types of parameters for BuiltinFunctionNode_2",
+		             "Check that both expressions are assigned numeric values before using them in a numeric operation.");
+		out << std::endl;
+
+		// The arguments are evaluated from right to left by the interpreter
+		out << "\tdouble second = " << this->call(f->getExp2(), NUMBER, true) << ";" << std::endl;
+		out << "\tdouble first = " << this->call(f->getExp1(), NUMBER, true) << ";" << std::endl << std::endl;
+		out << "\treturn " << builtin(f->getSlot()) << "(first, second);" << std::endl;
+	}
+	else if (lp::RandomNode *random = dynamic_cast<lp::RandomNode *>(node))
+	{
+		lp::ExpNode *min = random->getMinimum();
+		lp::ExpNode *max = random->getMaximum();
+
+		out << "\tstd::srand(std::time(NULL));" << std::endl << std::endl;
+		out << "\tif ((" << this->call(min, TYPE, false) << " == lp::Value::NUMBER) and (" << this->call(max, TYPE, false)
+		    << " == lp::Value::NUMBER))" << std::endl;
+		out << "\t{" << std::endl;
+		out << "\t\tdouble minimum = static_cast<int>(" << this->call(min, NUMBER, true) << ");" << std::endl;
+		out << "\t\tdouble maximum = static_cast<int>(" << this->call(max, NUMBER, true) << ");" << std::endl << std::endl;
+		out << "\t\treturn lp::randomBetween(minimum, maximum, " << line << ");" << std::endl;
+		out << "\t}" << std::endl << std::endl;
+
+		// The names of two numeric variables
+		out << "\tif ((" << this->call(min, TYPE, false) << " == lp::Value::STRING) and (" << this->call(max, TYPE, false)
+		    << " == lp::Value::STRING))" << std::endl;
+		out << "\t{" << std::endl;
+		out << "\t\tlp::Value *minimum = lp::lookup(" << this->call(min, STRING, true) << ");" << std::endl;
+		out << "\t\tlp::Value *maximum = lp::lookup(" << this->call(max, STRING, true) << ");" << std::endl << std::endl;
+		out << "\t\treturn lp::randomBetween(minimum, maximum, " << line << ");" << std::endl;
+		out << "\t}" << std::endl << std::endl;
+		out << error("\t", line, "Invalid types for Random statement.",
+		             "Ensure both expressions evaluate to numeric values or valid numeric variable names.");
+		out << "\treturn -1;" << std::endl;
+	}
+
+	return out.str();
+}
+
+
+std::string lp::CppEmitter::logicBody(lp::ExpNode *node)
+{
+	std::ostringstream out;
+	int line = node->_lineNumber;
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		std::string value = this->variable(var->getSlot(), var->getId());
+
+		out << "\tif (" << value << ".getTag() != lp::Value::BOOL)" << std::endl;
+		out << error("\t\t", line, "Variable is not bool.",
+		             "Check that the variable is assigned a bool value before using it in a bool expression.");
+		out << std::endl << "\treturn " << value << ".getBool();" << std::endl;
+	}
+	else if (dynamic_cast<lp::ConstantNode *>(node))
+	{
+		// A numeric constant: the logical ones are literals
+		out << error("\t", line, "Constant is not bool.",
+		             "Check that the constant is assigned a bool value before using it in a bool expression.");
+		out << "\treturn false;" << std::endl;
+	}
+	else if (lp::NotNode *unary = dynamic_cast<lp::NotNode *>(node))
+		out << "\treturn not " << this->call(unary->getExp(), BOOL, true) << ";" << std::endl;
+	else if (lp::RelationalOperatorNode *binary = dynamic_cast<lp::RelationalOperatorNode *>(node))
+	{
+		const char *op = dynamic_cast<lp::GreaterThanNode *>(node) ? ">"
+		                 : dynamic_cast<lp::GreaterOrEqualNode *>(node) ? ">="
+		                 : dynamic_cast<lp::LessThanNode *>(node) ? "<"
+		                 : dynamic_cast<lp::LessOrEqualNode *>(node) ? "<="
+		                 : dynamic_cast<lp::EqualNode *>(node) ? "==" : "!=";
+
+		// The type of the left operand is known when getType has checked it
+		int known = naturalType(binary->getLeft());
+
+		if (known == 0)
+			known = fixedType(binary->getLeft());
+
+		if (known == 0)
+			out << "\tswitch (" << this->call(binary->getLeft(), TYPE, true) << ")" << std::endl << "\t{" << std::endl;
+
+		for (int type = NUMBER; type <= STRING; type++)
+		{
+			if ((type != NUMBER) and (type != BOOL) and (type != STRING))
+				continue;
+
+			if ((known != 0) and (known != type))
+				continue;
+
+			std::string tabs = (known == 0) ? "\t\t\t" : "\t";
+
+			if (known == 0)
+				out << "\t\tcase " << tag(type) << ":" << std::endl << "\t\t{" << std::endl;
+
+			if (type == NUMBER)
+			{
+				out << tabs << "double left = " << this->call(binary->getLeft(), NUMBER, true) << ";" << std::endl;
+				out << tabs << "double right = " << this->call(binary->getRight(), NUMBER, true) << ";" << std::endl << std::endl;
+
+				// ERROR_BOUND to control the precision of real numbers
+				if (dynamic_cast<lp::EqualNode *>(node))
+					out << tabs << "return std::fabs(left - right) < ERROR_BOUND;" << std::endl;
+				else if (dynamic_cast<lp::NotEqualNode *>(node))
+					out << tabs << "return std::fabs(left - right) >= ERROR_BOUND;" << std::endl;
+				else
+					out << tabs << "return left " << op << " right;" << std::endl;
+			}
+			else if (type == BOOL)
+			{
+				out << tabs << "bool left = " << this->call(binary->getLeft(), BOOL, true) << ";" << std::endl;
+				out << tabs << "bool right = " << this->call(binary->getRight(), BOOL, true) << ";" << std::endl << std::endl;
+				out << tabs << "return left " << op << " right;" << std::endl;
+			}
+			else
+			{
+				out << tabs << "lp::Value left = " << this->call(binary->getLeft(), VALUE, true) << ";" << std::endl;
+				out << tabs << "lp::Value right = " << this->call(binary->getRight(), VALUE, true) << ";" << std::endl << std::endl;
+				out << tabs << "return left.getString() " << op << " right.getString();" << std::endl;
+			}
+
+			if (known == 0)
+				out << "\t\t}" << std::endl;
+		}
+
+		if (known == 0)
+			out << "\t}" << std::endl << std::endl << "\treturn false;" << std::endl;
+	}
+	else if (lp::LogicalOperatorNode *binary = dynamic_cast<lp::LogicalOperatorNode *>(node))
+	{
+		out << "\tbool left = " << this->call(binary->getLeft(), BOOL, true) << ";" << std::endl;
+		out << "\tbool right = " << this->call(binary->getRight(), BOOL, true) << ";" << std::endl << std::endl;
+		out << "\treturn left " << (dynamic_cast<lp::AndNode *>(node) ? "and" : "or") << " right;" << std::endl;
+	}
+
+	return out.str();
+}
+
+
+std::string lp::CppEmitter::textBody(lp::ExpNode *node)
+{
+	std::ostringstream out;
+	int line = node->_lineNumber;
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		std::string value = this->variable(var->getSlot(), var->getId());
+
+		out << "\tif (" << value << ".getTag() != lp::Value::STRING)" << std::endl;
+		out << error("\t\t", line, "Variable is not string.",
+		             "Check that the variable is assigned a string value before using it in a string expression.");
+		out << std::endl << "\treturn " << value << ".getString();" << std::endl;
+	}
+	else if (lp::ConcatenationNode *binary = dynamic_cast<lp::ConcatenationNode *>(node))
+	{
+		// The operands are shared, only the result is built
+		out << "\tlp::Value left = " << this->call(binary->getLeft(), VALUE, true) << ";" << std::endl;
+		out << "\tlp::Value right = " << this->call(binary->getRight(), VALUE, true) << ";" << std::endl;
+		out << "\tstd::string result;" << std::endl << std::endl;
+		out << "\tresult.reserve(left.getString().size() + right.getString().size());" << std::endl;
+		out << "\tresult.append(left.getString());" << std::endl;
+		out << "\tresult.append(right.getString());" << std::endl << std::endl;
+		out << "\treturn result;" << std::endl;
+	}
+
+	return out.str();
+}
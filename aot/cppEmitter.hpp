@@ -0,0 +1,104 @@
+/*!
+	\file    cppEmitter.hpp
+	\brief   Declaration of the translator of the AST to a C++ source file
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _CPPEMITTER_HPP_
+#define _CPPEMITTER_HPP_
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <list>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../ast/ast.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class CppEmitter
+  \brief Translation of the AST of a program into a C++ program that is linked with aot/liblexon.a
+  \note  The variables keep their types while the program runs, as in the
+         interpreter: each one is an lp::Value. Every expression becomes a
+         static function for each way in which it is evaluated (type, number,
+         logic, text or value), whose code is the one of the evaluate functions
+         of its node. The types are checked where getType would check them
+         and in the same order, so the translated program reports the same
+         errors as the interpreter, with the same lines and messages.
+*/
+class CppEmitter
+{
+	private:
+		std::ostringstream _functions;           //!< Functions of the expressions, each one after the functions that it calls
+		std::ostringstream _literals;            //!< Values of the string literals
+		std::map<lp::ExpNode *, int> _numbers;   //!< Number of each expression in the names of its functions
+		std::set<std::string> _defined;          //!< Functions already written in _functions
+		std::map<int, int> _variables;           //!< Index of the value of each slot of the table of symbols
+		std::vector<std::string> _names;         //!< Names of the variables, by index
+		std::vector<std::pair<std::string, int> > _counters; //!< Variable and depth of each enclosing for loop whose body writes its variable
+
+	public:
+
+	/*!
+		\brief Constructor of CppEmitter
+	*/
+		CppEmitter()
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Translate the whole program
+		\param   root: AST of the program, already analyzed
+		\param   out: stream that receives the C++ source file
+		\return  void
+		\note    The source lines and the column of the errors are taken from the globals of the parser
+	*/
+		void emit(lp::AST *root, std::ostream &out);
+
+	private:
+
+	/*!
+		\name Auxiliary functions
+	*/
+		std::string variable(int slot, std::string const &name);
+		int number(lp::ExpNode *node);
+
+	/*!
+		\name Statements
+	*/
+		void emitStatements(std::list<lp::Statement *> *stmts, std::ostream &out, int depth);
+		void emitStatement(lp::Statement *stmt, std::ostream &out, int depth);
+		void emitAssignment(lp::AssignmentStmt *stmt, std::ostream &out, int depth);
+		void emitFor(lp::ForStmt *stmt, std::ostream &out, int depth);
+		void emitSwitch(lp::SwitchStmt *stmt, std::ostream &out, int depth);
+		void emitPlace(lp::PlaceStmt *stmt, std::ostream &out, int depth);
+
+	/*!
+		\name Expressions
+	*/
+		std::string call(lp::ExpNode *node, int kind, bool checked);
+		std::string define(lp::ExpNode *node, int kind);
+		std::string typeBody(lp::ExpNode *node);
+		std::string numberBody(lp::ExpNode *node);
+		std::string logicBody(lp::ExpNode *node);
+		std::string textBody(lp::ExpNode *node);
+};
+
+// End of name space lp
+}
+
+// End of _CPPEMITTER_HPP_
+#endif
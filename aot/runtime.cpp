@@ -0,0 +1,150 @@
+/*!
+	\file    runtime.cpp
+	\brief   Code of the runtime library of the programs translated to C++
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <signal.h>
+
+#include "runtime.hpp"
+
+#include "../includes/globals.hpp"
+#include "../error/error.hpp"
+
+
+jmp_buf begin; //!< Restored by the errors of the mathematical functions
+
+static lp::NamedValue *names = NULL; //!< Variables of the program, found by lookup
+
+
+void lp::start(const char *lines[], int column, lp::NamedValue *variables)
+{
+	// The errors show the lines of the source file, as in the interpreter
+	std::string text;
+
+	for (int i = 0; lines[i] != NULL; i++)
+		text.append(lines[i]).append("\n");
+
+	source.assign(text);
+
+	columnNumber = column;
+	interactiveMode = false;
+	names = variables;
+
+	// Number of decimal places
+	std::cout.precision(7);
+
+	// The name of the function to handle floating-point errors is set
+	signal(SIGFPE, fpecatch);
+}
+
+
+void lp::semanticError(int line, const char *message, const char *suggestion)
+{
+	semanticWarning(fileName, line, columnNumber, message, suggestion);
+}
+
+
+void lp::runtimeError(int line, const char *message, const char *suggestion)
+{
+	runtimeWarning(fileName, line, columnNumber, message, suggestion);
+}
+
+
+void lp::print(lp::Value const &value, int line)
+{
+	switch (value.getTag())
+	{
+		case lp::Value::NUMBER:
+			std::cout << value.getNumber() << std::endl;
+			break;
+		case lp::Value::BOOL:
+			if (value.getBool())
+				std::cout << "true" << std::endl;
+			else
+				std::cout << "false" << std::endl;
+			break;
+		case lp::Value::STRING:
+			std::cout << value.getString() << std::endl;
+			break;
+		default:
+			lp::semanticError(line, "Incompatible type for print statement.",
+			                  "Ensure the expression is a number, boolean, or string.");
+			break;
+	}
+}
+
+
+double lp::readNumber()
+{
+	double value = 0.0;
+
+	std::cin >> value;
+
+	return value;
+}
+
+
+std::string lp::readString()
+{
+	std::string value;
+
+	std::cin >> value;
+
+	return value;
+}
+
+
+lp::Value *lp::lookup(std::string const &name)
+{
+	for (int i = 0; names[i].name != NULL; i++)
+		if (name == names[i].name)
+			return names[i].value;
+
+	return NULL;
+}
+
+
+/*!
+  \brief  Random number between two bounds with three decimals, as RandomNode
+*/
+static double scaled(double minimum, double maximum)
+{
+	int scale = 1000;
+	int minScaled = static_cast<int>(minimum * scale);
+	int maxScaled = static_cast<int>(maximum * scale);
+
+	if (minScaled > maxScaled) std::swap(minScaled, maxScaled);
+
+	int randomValue = minScaled + std::rand() % (maxScaled - minScaled + 1);
+	return static_cast<double>(randomValue) / scale;
+}
+
+
+double lp::randomBetween(double minimum, double maximum, int line)
+{
+	if (minimum > maximum)
+		lp::semanticError(line, "Invalid range for random number generation: minimum is greater than maximum.",
+		                  "Ensure that the minimum value is less than or equal to the maximum value.");
+
+	return scaled(minimum, maximum);
+}
+
+
+double lp::randomBetween(lp::Value *minimum, lp::Value *maximum, int line)
+{
+	if ((minimum == NULL) or (minimum->getTag() != lp::Value::NUMBER)
+		or (maximum == NULL) or (maximum->getTag() != lp::Value::NUMBER))
+	{
+		lp::semanticError(line, "One or both variable references are invalid or not numeric.",
+		                  "Ensure both variable names refer to numeric values.");
+		return -1;
+	}
+
+	return scaled(minimum->getNumber(), maximum->getNumber());
+}
@@ -0,0 +1,126 @@
+/*!
+	\file    runtime.hpp
+	\brief   Declaration of the runtime library of the programs translated to C++
+	\author
+	\date    2025-06-06
+	\version 1.0
+	\note    The translated programs are linked with liblexon.a, built in this
+	         directory: the runtime, the functions of table/mathFunction.cpp
+	         and the error reporting of error/error.cpp
+*/
+
+#ifndef _RUNTIME_HPP_
+#define _RUNTIME_HPP_
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <setjmp.h>
+
+#include "../table/value.hpp"
+#include "../table/mathFunction.hpp"
+#include "../includes/macros.hpp"
+
+#ifndef ERROR_BOUND
+#define ERROR_BOUND 1.0e-6  //!< Error bound for the comparison of real numbers, as in ast/ast.hpp
+#endif
+
+
+extern jmp_buf begin; //!< Restored by the errors of the mathematical functions
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \struct NamedValue
+  \brief  Variable of a translated program, found by its name by rand and place
+*/
+struct NamedValue
+{
+	const char *name;   //!< Name of the variable, NULL at the end of the table
+	lp::Value *value;   //!< Value of the variable
+};
+
+
+/*!
+	\brief   Prepare the execution of a translated program
+	\param   lines: lines of the source file, ended by NULL, shown by the errors
+	\param   column: column reported by the errors, as the interpreter does
+	\param   names: variables of the program, ended by a NULL name
+	\return  void
+*/
+void start(const char *lines[], int column, lp::NamedValue *names);
+
+/*!
+	\brief   Report a semantic error and end the program
+	\param   line: line of the source file
+	\param   message: description of the error
+	\param   suggestion: how to fix the error
+	\return  void
+*/
+void semanticError(int line, const char *message, const char *suggestion);
+
+/*!
+	\brief   Report a runtime error and end the program
+	\param   line: line of the source file
+	\param   message: description of the error
+	\param   suggestion: how to fix the error
+	\return  void
+*/
+void runtimeError(int line, const char *message, const char *suggestion);
+
+/*!
+	\brief   Print a value as the print statement does
+	\param   value: value of the expression
+	\param   line: line of the print statement, for the error of an EMPTY value
+	\return  void
+*/
+void print(lp::Value const &value, int line);
+
+/*!
+	\brief   Read a number from the standard input
+	\return  double: 0 if the input is not a number
+*/
+double readNumber();
+
+/*!
+	\brief   Read a word from the standard input
+	\return  std::string
+*/
+std::string readString();
+
+/*!
+	\brief   Find a variable by its name
+	\param   name: name of the variable
+	\return  lp::Value *: NULL if the program has no variable with that name
+*/
+lp::Value *lookup(std::string const &name);
+
+/*!
+	\brief   Random number of rand with numeric bounds
+	\param   minimum, maximum: bounds, already truncated to integers
+	\param   line: line of the expression, for the error of an invalid range
+	\return  double: number with three decimals between the bounds
+*/
+double randomBetween(double minimum, double maximum, int line);
+
+/*!
+	\brief   Random number of rand with the names of two variables as bounds
+	\param   minimum, maximum: variables found by lookup, may be NULL
+	\param   line: line of the expression, for the error of invalid variables
+	\return  double: number with three decimals between the values of the variables
+*/
+double randomBetween(lp::Value *minimum, lp::Value *maximum, int line);
+
+// End of name space lp
+}
+
+// End of _RUNTIME_HPP_
+#endif
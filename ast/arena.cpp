@@ -0,0 +1,65 @@
+/*!
+	\file    arena.cpp
+	\brief   Code of the functions of the Arena class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <new>
+#include <vector>
+
+#include "arena.hpp"
+
+
+// The sizes of the blocks are kept by reference
+const size_t lp::Arena::BLOCK;
+
+lp::Arena::~Arena()
+{
+	// The objects are destroyed in the reverse order of their creation
+	for (std::vector<Finalizer>::size_type i = this->_finalizers.size(); i > 0; i--)
+		this->_finalizers[i - 1].destroy(this->_finalizers[i - 1].object);
+
+	for (std::vector<char *>::size_type i = 0; i < this->_blocks.size(); i++)
+		::operator delete(this->_blocks[i]);
+}
+
+
+bool lp::Arena::contains(const void *address) const
+{
+	const char *byte = (const char *) address;
+
+	for (std::vector<char *>::size_type i = 0; i < this->_blocks.size(); i++)
+		if ((byte >= this->_blocks[i]) and (byte < this->_blocks[i] + this->_sizes[i]))
+			return true;
+
+	return false;
+}
+
+
+void *lp::Arena::grow(size_t size)
+{
+	this->_bytes += size;
+
+	// A large object gets a block of its own, and the current block is still used
+	if (size > BLOCK / 4)
+	{
+		char *block = (char *) ::operator new(size);
+
+		this->_blocks.push_back(block);
+		this->_sizes.push_back(size);
+		return block;
+	}
+
+	// The rest of the current block is left unused
+	this->_next = (char *) ::operator new(BLOCK);
+	this->_left = BLOCK - size;
+	this->_blocks.push_back(this->_next);
+	this->_sizes.push_back(BLOCK);
+
+	void *result = this->_next;
+
+	this->_next += size;
+	return result;
+}
@@ -0,0 +1,195 @@
+/*!
+	\file    arena.hpp
+	\brief   Declaration of the arena where the nodes of the AST are allocated
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _ARENA_HPP_
+#define _ARENA_HPP_
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Arena
+  \brief Memory of the nodes of the AST of a program, released at once
+  \note  The nodes are allocated one after the other in blocks of 64 KB,
+         by moving a pointer, so the parser calls malloc once per block
+         instead of once per node, and the nodes of a statement end up
+         close to each other. Most nodes own no memory and are never
+         destroyed: the blocks are freed at once. The few objects that own
+         memory, such as the string literals or the lists of statements,
+         are adopted by the arena once they are constructed and destroyed
+         when it is released.
+*/
+class Arena
+{
+	private:
+
+	/*!
+	  \struct Finalizer
+	  \brief  Object of the arena to be destroyed with it
+	*/
+		struct Finalizer
+		{
+			void (*destroy)(void *);   //!< Destructor of the type of the object
+			void *object;              //!< Address of the object
+		};
+
+		std::vector<char *> _blocks;           //!< Blocks of memory
+		std::vector<size_t> _sizes;            //!< Size of each block
+		char *_next;                           //!< First free byte of the current block
+		size_t _left;                          //!< Free bytes of the current block
+		size_t _bytes;                         //!< Bytes allocated in the arena
+		std::vector<Finalizer> _finalizers;    //!< Objects to destroy, in the order of their creation
+
+	public:
+
+	/*!
+		\brief Size of a block
+	*/
+		static const size_t BLOCK = 64 * 1024;
+
+	/*!
+		\brief Alignment of every allocation, enough for any member of a node
+	*/
+		static const size_t ALIGNMENT = 16;
+
+	/*!
+		\brief Constructor of Arena
+		\post  The arena has no blocks until the first allocation
+	*/
+		Arena(): _next(NULL), _left(0), _bytes(0)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief Destructor
+		\post  The objects of the arena are destroyed and its blocks are freed
+	*/
+		~Arena();
+
+	/*!
+		\brief   Allocate memory that lives as long as the arena
+		\param   size: number of bytes
+		\return  void *: aligned to ALIGNMENT
+	*/
+		inline void *allocate(size_t size)
+		{
+			size = (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+			if (size > this->_left)
+				return this->grow(size);
+
+			void *result = this->_next;
+
+			this->_next += size;
+			this->_left -= size;
+			this->_bytes += size;
+
+			return result;
+		}
+
+	/*!
+		\brief   Destroy an object when the arena is released
+		\param   object: object allocated in the arena and already constructed
+		\return  T *: the object
+	*/
+		template <class T>
+		inline T *adopt(T *object)
+		{
+			Finalizer finalizer;
+
+			finalizer.destroy = &Arena::destroy<T>;
+			finalizer.object = object;
+
+			this->_finalizers.push_back(finalizer);
+			return object;
+		}
+
+	/*!
+		\brief   Create an object with its default constructor in the arena
+		\return  T *: the object, destroyed when the arena is released
+	*/
+		template <class T>
+		T *create()
+		{
+			return this->adopt(new (this->allocate(sizeof(T))) T());
+		}
+
+	/*!
+		\brief   Whether some memory was allocated in the arena
+		\param   address: address of the memory
+		\return  bool
+		\note    The blocks are searched one by one: it is meant for the assertions
+	*/
+		bool contains(const void *address) const;
+
+	/*!
+		\brief   Number of blocks of the arena
+		\return  size_t
+	*/
+		inline size_t getBlocks() const
+		{
+			return this->_blocks.size();
+		}
+
+	/*!
+		\brief   Number of bytes allocated in the arena
+		\return  size_t
+	*/
+		inline size_t getBytes() const
+		{
+			return this->_bytes;
+		}
+
+	/*!
+		\brief   Number of objects to destroy with the arena
+		\return  size_t
+	*/
+		inline size_t getObjects() const
+		{
+			return this->_finalizers.size();
+		}
+
+	private:
+
+	/*!
+		\brief   Allocate from a new block
+		\param   size: number of bytes, already aligned
+		\return  void *
+	*/
+		void *grow(size_t size);
+
+	/*!
+		\brief   Destructor of an object of type T
+		\param   object: address of the object
+		\return  void
+	*/
+		template <class T>
+		static void destroy(void *object)
+		{
+			((T *) object)->~T();
+		}
+
+	// Copying an Arena would free its blocks twice
+		Arena(Arena const &);
+		Arena & operator=(Arena const &);
+};
+
+// End of name space lp
+}
+
+// End of _ARENA_HPP_
+#endif
@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <cmath>
+#include <algorithm>
 
 // Project core AST definitions
 #include "ast.hpp"
@@ -47,6 +48,277 @@ extern lp::Table table; //!< Reference to the Table of Symbols
 extern lp::AST *root; //!< Reference to the object at the base of the AST
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Infers the types of the expressions of a list of statements.
+ * @param stmts List of statements.
+ */
+static void analyzeStatements(std::list<lp::Statement *> *stmts)
+{
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		(*it)->analyze();
+}
+
+
+static unsigned long frozenBodies = 0;      //!< Lists of statements laid out by freezeStatements
+static unsigned long frozenStatements = 0;  //!< Statements of those lists
+
+/**
+ * @brief Lays out a list of statements in a contiguous array and freezes the statements.
+ * @param stmts List of statements.
+ * @return Array of the statements, ended by NULL, in the arena of the program if there is one.
+ * @note The statements are evaluated by walking the array, without following the links of the list.
+ */
+static lp::Statement **freezeStatements(std::list<lp::Statement *> *stmts)
+{
+	size_t size = (stmts->size() + 1) * sizeof(lp::Statement *);
+	lp::Statement **body = (lp::Statement **) ((arena != NULL) ? arena->allocate(size) : ::operator new(size));
+	lp::Statement **next = body;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		*next++ = *it;
+
+	*next = NULL;
+
+	frozenBodies++;
+	frozenStatements += stmts->size();
+
+	// The nested bodies are laid out after the array of their parent
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		(*it)->freeze();
+
+	return body;
+}
+
+
+/**
+ * @brief Evaluates the statements of a frozen body in order.
+ * @param body Array of statements ended by NULL.
+ */
+static inline void evaluateBody(lp::Statement **body)
+{
+	for (; *body != NULL; ++body)
+		(*body)->evaluate();
+}
+
+
+/**
+ * @brief Checks whether an expression reads a variable.
+ * @param node Expression.
+ * @param slot Slot of the variable in the table of symbols.
+ * @return true if the expression may read the variable.
+ * @note The unknown expressions are assumed to read it.
+ */
+static bool readsSlot(lp::ExpNode *node, int slot)
+{
+	if (node == NULL)
+		return false;
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+		return var->getSlot() == slot;
+
+	if ((dynamic_cast<lp::NumberNode *>(node) != NULL) or (dynamic_cast<lp::StringNode *>(node) != NULL)
+	    or (dynamic_cast<lp::BoolNode *>(node) != NULL) or (dynamic_cast<lp::ConstantNode *>(node) != NULL)
+	    or (dynamic_cast<lp::BuiltinFunctionNode_0 *>(node) != NULL))
+		return false;
+
+	if (lp::InvariantNode *invariant = dynamic_cast<lp::InvariantNode *>(node))
+		return readsSlot(invariant->getExp(), slot);
+
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		return readsSlot(unary->getExp(), slot);
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+		return readsSlot(binary->getLeft(), slot) or readsSlot(binary->getRight(), slot);
+
+	if (lp::BuiltinFunctionNode_1 *builtin = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return readsSlot(builtin->getExp(), slot);
+
+	if (lp::BuiltinFunctionNode_2 *builtin = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return readsSlot(builtin->getExp1(), slot) or readsSlot(builtin->getExp2(), slot);
+
+	return true;
+}
+
+static void findSlot(std::list<lp::Statement *> *stmts, int slot, bool &reads, bool &writes);
+
+/**
+ * @brief Looks for the reads and the writes of a variable in a statement.
+ * @param stmt Statement.
+ * @param slot Slot of the variable in the table of symbols.
+ * @param reads Set to true if the statement may read the variable.
+ * @param writes Set to true if the statement may write the variable.
+ * @note The unknown statements are assumed to read and write it.
+ */
+static void findSlot(lp::Statement *stmt, int slot, bool &reads, bool &writes)
+{
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		writes = writes or (asgn->getSlot() == slot);
+
+		if (asgn->getAssignment() != NULL)
+			findSlot(asgn->getAssignment(), slot, reads, writes);
+		else
+			reads = reads or readsSlot(asgn->getExp(), slot);
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+	{
+		writes = writes or (plus->getSlot() == slot);
+		reads = reads or (plus->getSlot() == slot) or readsSlot(plus->getExp(), slot);
+	}
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+	{
+		writes = writes or (minus->getSlot() == slot);
+		reads = reads or (minus->getSlot() == slot) or readsSlot(minus->getExp(), slot);
+	}
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+		reads = reads or readsSlot(print->getExp(), slot);
+	else if (lp::ReadStmt *read = dynamic_cast<lp::ReadStmt *>(stmt))
+		writes = writes or (read->getSlot() == slot);
+	else if (lp::ReadStringStmt *read = dynamic_cast<lp::ReadStringStmt *>(stmt))
+		writes = writes or (read->getSlot() == slot);
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		reads = reads or readsSlot(ifStmt->getCondition(), slot);
+		findSlot(ifStmt->getConsequent(), slot, reads, writes);
+		findSlot(ifStmt->getAlternative(), slot, reads, writes);
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		reads = reads or readsSlot(whileStmt->getCondition(), slot);
+		findSlot(whileStmt->getStatements(), slot, reads, writes);
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		reads = reads or readsSlot(doWhile->getCondition(), slot);
+		findSlot(doWhile->getStatements(), slot, reads, writes);
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		reads = reads or readsSlot(repeat->getCondition(), slot);
+		findSlot(repeat->getStatements(), slot, reads, writes);
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		writes = writes or (forStmt->getSlot() == slot);
+		reads = reads or readsSlot(forStmt->getFrom(), slot) or readsSlot(forStmt->getTo(), slot)
+		        or readsSlot(forStmt->getStep(), slot);
+		findSlot(forStmt->getStatements(), slot, reads, writes);
+	}
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		reads = reads or readsSlot(switchStmt->getExp(), slot);
+
+		std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+		for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+		{
+			reads = reads or readsSlot((*it)->getExp(), slot);
+			findSlot((*it)->getStatements(), slot, reads, writes);
+		}
+
+		findSlot(switchStmt->getDefault(), slot, reads, writes);
+	}
+	else if (lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt))
+	{
+		reads = reads or readsSlot(inc->getExp(), slot);
+		writes = writes or readsSlot(inc->getExp(), slot);
+	}
+	else if (lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt))
+	{
+		reads = reads or readsSlot(dec->getExp(), slot);
+		writes = writes or readsSlot(dec->getExp(), slot);
+	}
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+	{
+		reads = reads or readsSlot(fact->getExp(), slot);
+		writes = writes or readsSlot(fact->getExp(), slot);
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		findSlot(block->getStatements(), slot, reads, writes);
+	else if (lp::PlaceStmt *place = dynamic_cast<lp::PlaceStmt *>(stmt))
+		reads = reads or readsSlot(place->_x, slot) or readsSlot(place->_y, slot);
+	else if ((dynamic_cast<lp::EmptyStmt *>(stmt) == NULL) and (dynamic_cast<lp::ClearScreenStmt *>(stmt) == NULL))
+	{
+		reads = true;
+		writes = true;
+	}
+}
+
+/**
+ * @brief Looks for the reads and the writes of a variable in a list of statements.
+ * @param stmts List of statements, may be NULL.
+ * @param slot Slot of the variable in the table of symbols.
+ * @param reads Set to true if a statement may read the variable.
+ * @param writes Set to true if a statement may write the variable.
+ */
+static void findSlot(std::list<lp::Statement *> *stmts, int slot, bool &reads, bool &writes)
+{
+	if (stmts == NULL)
+		return;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		findSlot(*it, slot, reads, writes);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Caches the type of the expression until a variable changes its type.
+ * @param type The type computed by getType.
+ * @return The same type.
+ */
+int lp::ExpNode::cacheType(int type)
+{
+	// Only the valid types are cached
+	if ((type == NUMBER) or (type == STRING) or (type == BOOL))
+	{
+		this->_type = type;
+		this->_typeEpoch = typeEpoch;
+	}
+
+	return type;
+}
+
+/**
+ * @brief Caches a type that does not depend on any variable.
+ * @param type The type of the expression.
+ * @return The same type.
+ */
+int lp::ExpNode::fixType(int type)
+{
+	if ((type == NUMBER) or (type == STRING) or (type == BOOL))
+	{
+		this->_type = type;
+		this->_typeFixed = true;
+	}
+
+	return type;
+}
+
+
+/**
+ * @brief Evaluates the expression as a value tagged with its type.
+ * @return The value of the expression, or an EMPTY value if its type is not valid.
+ */
+lp::Value lp::ExpNode::evaluate()
+{
+	switch (this->getType())
+	{
+		case NUMBER:
+			return lp::Value(this->evaluateNumber());
+		case BOOL:
+			return lp::Value(this->evaluateBool());
+		case STRING:
+			return lp::Value(this->evaluateString());
+	}
+
+	return lp::Value();
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /**
@@ -56,7 +328,7 @@ extern lp::AST *root; //!< Reference to the object at the base of the AST
 int lp::VariableNode::getType() 
 {
     // Get the identifier in the table of symbols as Variable
-    lp::Variable *var = (lp::Variable *) table.getSymbol(this->_id);
+    lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
     // Return the type of the Variable
     return var->getType();
@@ -67,7 +339,7 @@ int lp::VariableNode::getType()
  */
 void lp::VariableNode::printAST() 
 {
-    std::cout << "VariableNode: " << this->_id;
+    std::cout << "VariableNode: " << this->getId();
     std::cout << " (Type: " << this->getType() << ")" << std::endl;
 }
 
@@ -81,11 +353,11 @@ double lp::VariableNode::evaluateNumber()
 
     if (this->getType() == NUMBER)
     {
-        // Get the identifier in the table of symbols as NumericVariable
-        lp::NumericVariable *var = (lp::NumericVariable *) table.getSymbol(this->_id);
+        // Get the identifier in the table of symbols as Variable
+        lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
-        // Copy the value of the NumericVariable
-        result = var->getValue();
+        // Copy the numeric value of the Variable
+        result = var->getNumber();
     }
     else
     {
@@ -94,7 +366,7 @@ double lp::VariableNode::evaluateNumber()
         semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, suggestion);
     }
 
-    // Return the value of the NumericVariable
+    // Return the value of the Variable
     return result;
 }
 
@@ -108,11 +380,11 @@ bool lp::VariableNode::evaluateBool()
 
     if (this->getType() == BOOL)
     {
-        // Get the identifier in the table of symbols as LogicalVariable
-        lp::LogicalVariable *var = (lp::LogicalVariable *) table.getSymbol(this->_id);
+        // Get the identifier in the table of symbols as Variable
+        lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
-        // Copy the value of the LogicalVariable
-        result = var->getValue();
+        // Copy the logical value of the Variable
+        result = var->getLogical();
     }
     else
     {
@@ -121,7 +393,7 @@ bool lp::VariableNode::evaluateBool()
         semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, suggestion);
     }
 
-    // Return the value of the LogicalVariable
+    // Return the value of the Variable
     return result;
 }
 
@@ -135,11 +407,11 @@ std::string lp::VariableNode::evaluateString()
 
     if (this->getType() == STRING)
     {
-        // Get the identifier in the table of symbols as StringVariable
-        lp::StringVariable *var = (lp::StringVariable *) table.getSymbol(this->_id);
+        // Get the identifier in the table of symbols as Variable
+        lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
-        // Copy the value of the StringVariable
-        result = var->getValue();
+        // Copy the string value of the Variable
+        result = var->getString();
     }
     else
     {
@@ -148,10 +420,31 @@ std::string lp::VariableNode::evaluateString()
         semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, suggestion);
     }
 
-    // Return the value of the StringVariable
+    // Return the value of the Variable
     return result;
 }
 
+/**
+ * @brief Evaluates the variable node with a single lookup in the table of symbols.
+ * @return The value of the variable; a string is shared with the Variable.
+ */
+lp::Value lp::VariableNode::evaluate()
+{
+    lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
+
+    switch (var->getType())
+    {
+        case NUMBER:
+            return lp::Value(var->getNumber());
+        case BOOL:
+            return lp::Value(var->getLogical());
+        case STRING:
+            return var->getSharedString();
+    }
+
+    return lp::Value();
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,7 +454,7 @@ std::string lp::VariableNode::evaluateString()
  */
 void lp::ConstantNode::printAST() 
 {
-  std::cout << "ConstantNode: " << this->_id;
+  std::cout << "ConstantNode: " << this->getId();
   std::cout << " (Type: " << this->getType() << ")" << std::endl;
 }
 
@@ -171,11 +464,24 @@ void lp::ConstantNode::printAST()
  */
 int lp::ConstantNode::getType() 
 { 
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	// Get the identifier in the table of symbols as Constant
-	lp::Constant *var = (lp::Constant *) table.getSymbol(this->_id);
+	lp::Constant *var = (lp::Constant *) table.getSymbol(this->_slot);
+
+	// Return the type of the Constant, which can never change
+	return this->fixType(var->getType());
+}
 
-	// Return the type of the Constant
-	return var->getType();
+/**
+ * @brief Infers the type of the constant node.
+ * @return The type of the constant.
+ */
+int lp::ConstantNode::inferType()
+{
+	return this->getType();
 }
 
 
@@ -190,7 +496,7 @@ double lp::ConstantNode::evaluateNumber()
 	if (this->getType() == NUMBER)
 	{
 		// Get the identifier in the table of symbols as NumericConstant
-		lp::NumericConstant *constant = (lp::NumericConstant *) table.getSymbol(this->_id);
+		lp::NumericConstant *constant = (lp::NumericConstant *) table.getSymbol(this->_slot);
 
 		// Copy the value of the NumericConstant
 		result = constant->getValue();
@@ -219,7 +525,7 @@ bool lp::ConstantNode::evaluateBool()
 	if (this->getType() == BOOL)
 	{
 		// Get the identifier in the table of symbols as LogicalConstant
-		lp::LogicalConstant *constant = (lp::LogicalConstant *) table.getSymbol(this->_id);
+		lp::LogicalConstant *constant = (lp::LogicalConstant *) table.getSymbol(this->_slot);
 
 		// Copy the value of the LogicalConstant
 		result = constant->getValue();
@@ -250,6 +556,15 @@ int lp::NumberNode::getType()
 	return NUMBER;
 }
 
+/**
+ * @brief Infers the type of the number node.
+ * @return NUMBER type.
+ */
+int lp::NumberNode::inferType()
+{
+	return this->fixType(NUMBER);
+}
+
 
 /**
  * @brief Prints the AST representation of a NumberNode.
@@ -272,6 +587,155 @@ double lp::NumberNode::evaluateNumber()
 //////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
  
+/**
+ * @brief Returns the type of the bool node.
+ * @return BOOL type.
+ */
+int lp::BoolNode::getType()
+{
+	return BOOL;
+}
+
+/**
+ * @brief Infers the type of the bool node.
+ * @return BOOL type.
+ */
+int lp::BoolNode::inferType()
+{
+	return this->fixType(BOOL);
+}
+
+/**
+ * @brief Prints the AST representation of a BoolNode.
+ */
+void lp::BoolNode::printAST()
+{
+  std::cout << "BoolNode: " << (this->_logic ? "true" : "false") << std::endl;
+}
+
+/**
+ * @brief Evaluates and returns the logical value of the bool node.
+ * @return The logical value.
+ */
+bool lp::BoolNode::evaluateBool() 
+{ 
+    return this->_logic; 
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+ 
+/**
+ * @brief Returns the type of the invariant node.
+ * @return The type of the kept value, or the type of the expression before it is evaluated.
+ */
+int lp::InvariantNode::getType()
+{
+	switch (this->_value.getTag())
+	{
+		case lp::Value::NUMBER: return NUMBER;
+		case lp::Value::BOOL:   return BOOL;
+		case lp::Value::STRING: return STRING;
+	}
+
+	return this->_exp->getType();
+}
+
+/**
+ * @brief Infers the type of the expression of the invariant node.
+ * @return The type of the expression, or 0 if it depends on the variables.
+ */
+int lp::InvariantNode::inferType()
+{
+	return this->_exp->inferType();
+}
+
+/**
+ * @brief Prints the AST representation of an InvariantNode.
+ */
+void lp::InvariantNode::printAST()
+{
+  std::cout << "InvariantNode: ";
+  this->_exp->printAST();
+}
+
+/**
+ * @brief Evaluates the expression the first time, then returns the kept value.
+ * @return The value of the expression.
+ */
+lp::Value lp::InvariantNode::evaluate()
+{
+	// Errors are reported by the expression, which is only evaluated when it is needed
+	if (this->_value.getTag() == lp::Value::EMPTY)
+		this->_value = this->_exp->evaluate();
+
+	return this->_value;
+}
+
+/**
+ * @brief Evaluates the invariant node as NUMBER.
+ * @return The numeric value.
+ */
+double lp::InvariantNode::evaluateNumber()
+{
+	if (this->_value.getTag() == lp::Value::EMPTY)
+		this->_value = this->_exp->evaluate();
+
+	if (this->_value.getTag() == lp::Value::NUMBER)
+		return this->_value.getNumber();
+
+	// The expression reports the error
+	return this->_exp->evaluateNumber();
+}
+
+/**
+ * @brief Evaluates the invariant node as BOOL.
+ * @return The logical value.
+ */
+bool lp::InvariantNode::evaluateBool()
+{
+	if (this->_value.getTag() == lp::Value::EMPTY)
+		this->_value = this->_exp->evaluate();
+
+	if (this->_value.getTag() == lp::Value::BOOL)
+		return this->_value.getBool();
+
+	// The expression reports the error
+	return this->_exp->evaluateBool();
+}
+
+/**
+ * @brief Evaluates the invariant node as STRING.
+ * @return The string value.
+ */
+std::string lp::InvariantNode::evaluateString()
+{
+	if (this->_value.getTag() == lp::Value::EMPTY)
+		this->_value = this->_exp->evaluate();
+
+	if (this->_value.getTag() == lp::Value::STRING)
+		return this->_value.getString();
+
+	// The expression reports the error
+	return this->_exp->evaluateString();
+}
+
+/**
+ * @brief Forgets the values of the expressions hoisted out of a loop when it starts again.
+ * @param invariants The InvariantNode of the loop, or NULL.
+ */
+void lp::resetInvariants(std::list<lp::InvariantNode *> *invariants)
+{
+	if (invariants == NULL)
+		return;
+
+	for (std::list<lp::InvariantNode *>::iterator it = invariants->begin(); it != invariants->end(); ++it)
+		(*it)->reset();
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+ 
 /**
  * @brief Returns the type of the string node.
  * @return STRING type.
@@ -281,6 +745,15 @@ int lp::StringNode::getType()
 	return STRING;
 }
 
+/**
+ * @brief Infers the type of the string node.
+ * @return STRING type.
+ */
+int lp::StringNode::inferType()
+{
+	return this->fixType(STRING);
+}
+
 /**
  * @brief Prints the AST representation of a StringNode.
  */
@@ -298,6 +771,15 @@ std::string lp::StringNode::evaluateString()
     return this->_string;
 }
 
+/**
+ * @brief Evaluates the string node without copying the string.
+ * @return The string value, shared with the node.
+ */
+lp::Value lp::StringNode::evaluate()
+{
+    return this->_value;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 /**
@@ -306,6 +788,10 @@ std::string lp::StringNode::evaluateString()
  */
 int lp::NumericUnaryOperatorNode::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result;
 
 	if(this->_exp->getType() == NUMBER)
@@ -322,7 +808,19 @@ int lp::NumericUnaryOperatorNode::getType()
 				 suggestion);
 	}
 
-	return result;
+	return this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the numeric unary operator node without warnings.
+ * @return NUMBER if the type of the child is known, otherwise 0.
+ */
+int lp::NumericUnaryOperatorNode::inferType()
+{
+	if (this->_exp->inferType() == NUMBER)
+		return this->fixType(NUMBER);
+
+	return 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,6 +832,10 @@ int lp::NumericUnaryOperatorNode::getType()
  */
 int lp::LogicalUnaryOperatorNode::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result;
 
 	if(this->_exp->getType() == BOOL)
@@ -349,7 +851,19 @@ int lp::LogicalUnaryOperatorNode::getType()
 				 suggestion);
 	}
 	
-	return result;
+	return this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the logical unary operator node without warnings.
+ * @return BOOL if the type of the child is known, otherwise 0.
+ */
+int lp::LogicalUnaryOperatorNode::inferType()
+{
+	if (this->_exp->inferType() == BOOL)
+		return this->fixType(BOOL);
+
+	return 0;
 }
 
 
@@ -362,6 +876,10 @@ int lp::LogicalUnaryOperatorNode::getType()
  */
 int lp::NumericOperatorNode::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
 	if ( (this->_left->getType() == NUMBER) and (this->_right->getType() == NUMBER) )
@@ -373,7 +891,23 @@ int lp::NumericOperatorNode::getType()
 		semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
 				 suggestion);
     }
-	return	result;
+	return	this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the numeric operator node without warnings.
+ * @return NUMBER if the types of both operands are known, otherwise 0.
+ */
+int lp::NumericOperatorNode::inferType()
+{
+	// Both children are inferred to fix their own types
+	int left = this->_left->inferType();
+	int right = this->_right->inferType();
+
+	if ((left == NUMBER) and (right == NUMBER))
+		return this->fixType(NUMBER);
+
+	return 0;
 }
 
 
@@ -386,6 +920,10 @@ int lp::NumericOperatorNode::getType()
  */
 int lp::StringOperatorNode::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
 	if ( (this->_left->getType() == STRING) and (this->_right->getType() == STRING))
@@ -398,11 +936,27 @@ int lp::StringOperatorNode::getType()
 				 suggestion);
         }
 
-	return	result;
+	return	this->cacheType(result);
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Infers the type of the string operator node without warnings.
+ * @return STRING if the types of both operands are known, otherwise 0.
+ */
+int lp::StringOperatorNode::inferType()
+{
+	// Both children are inferred to fix their own types
+	int left = this->_left->inferType();
+	int right = this->_right->inferType();
+
+	if ((left == STRING) and (right == STRING))
+		return this->fixType(STRING);
+
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
 
 
 /**
@@ -411,6 +965,10 @@ int lp::StringOperatorNode::getType()
  */
 int lp::RelationalOperatorNode::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
 	if ( (this->_left->getType() == NUMBER) and (this->_right->getType() == NUMBER))
@@ -426,7 +984,23 @@ int lp::RelationalOperatorNode::getType()
 		semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
 				suggestion);
 	}
-	return	result;
+	return	this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the relational operator node without warnings.
+ * @return BOOL if the types of both operands are known, otherwise 0.
+ */
+int lp::RelationalOperatorNode::inferType()
+{
+	// Both children are inferred to fix their own types
+	int left = this->_left->inferType();
+	int right = this->_right->inferType();
+
+	if ((left != 0) and (left == right))
+		return this->fixType(BOOL);
+
+	return 0;
 }
 
 
@@ -439,6 +1013,10 @@ int lp::RelationalOperatorNode::getType()
  */
 int lp::LogicalOperatorNode:: getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
 	if ( (this->_left->getType() == BOOL) and (this->_right->getType() == BOOL))
@@ -454,7 +1032,23 @@ int lp::LogicalOperatorNode:: getType()
 				 suggestion);
 	}
 
-	return	result;
+	return	this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the logical operator node without warnings.
+ * @return BOOL if the types of both operands are known, otherwise 0.
+ */
+int lp::LogicalOperatorNode::inferType()
+{
+	// Both children are inferred to fix their own types
+	int left = this->_left->inferType();
+	int right = this->_right->inferType();
+
+	if ((left == BOOL) and (right == BOOL))
+		return this->fixType(BOOL);
+
+	return 0;
 }
 
 
@@ -945,10 +1539,13 @@ std::string lp::ConcatenationNode::evaluateString()
 	// Verifica que ambos operandos sean de tipo STRING
 	if (this->getType() == STRING)
 	{
-		std::string leftStr = this->_left->evaluateString();
-		std::string rightStr = this->_right->evaluateString();
+		// The operands are shared, only the result is built
+		lp::Value leftValue = this->_left->evaluate();
+		lp::Value rightValue = this->_right->evaluate();
 
-		result = leftStr + rightStr;
+		result.reserve(leftValue.getString().size() + rightValue.getString().size());
+		result.append(leftValue.getString());
+		result.append(rightValue.getString());
 	}
 	else
 	{
@@ -962,6 +1559,15 @@ std::string lp::ConcatenationNode::evaluateString()
 	return result;
 }
 
+/**
+ * @brief Evaluates the string concatenation operation.
+ * @return The concatenated string as a new shared value.
+ */
+lp::Value lp::ConcatenationNode::evaluate()
+{
+	return lp::Value(this->evaluateString());
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1070,6 +1676,15 @@ int lp::BuiltinFunctionNode_0::getType()
 	return	NUMBER;
 }
 
+/**
+ * @brief Infers the type of the BuiltinFunctionNode_0.
+ * @return NUMBER type.
+ */
+int lp::BuiltinFunctionNode_0::inferType()
+{
+	return this->fixType(NUMBER);
+}
+
 
 /**
  * @brief Prints the AST representation of a BuiltinFunctionNode_0.
@@ -1078,7 +1693,7 @@ void lp::BuiltinFunctionNode_0::printAST()
 {
   std::cout << "BuiltinFunctionNode_0: "  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;
+  std::cout << this->getId() << std::endl;
 }
 
 /**
@@ -1088,7 +1703,7 @@ void lp::BuiltinFunctionNode_0::printAST()
 double lp::BuiltinFunctionNode_0::evaluateNumber() 
 {
 	// Get the identifier in the table of symbols as BuiltinParameter0
-	lp::BuiltinParameter0 *f = (lp::BuiltinParameter0 *) table.getSymbol(this->_id);
+	lp::BuiltinParameter0 *f = (lp::BuiltinParameter0 *) table.getSymbol(this->_slot);
 
 	// Apply the function and copy the result
    	return f->getFunction()();
@@ -1104,18 +1719,36 @@ double lp::BuiltinFunctionNode_0::evaluateNumber()
  */
 int lp::BuiltinFunctionNode_1::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
 	if (this->_exp->getType() == NUMBER)
 		result = NUMBER;
 	else
+	{
 		errorMsg = "Incompatible type for \"BuiltinFunctionNode_1\"";
 		
 		suggestion = "Check that the expression is assigned a numeric value before using it in a numeric operation.";
 		semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
 				 suggestion);
+	}
 
-	return	result;
+	return	this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the BuiltinFunctionNode_1 without warnings.
+ * @return NUMBER if the type of the child is known, otherwise 0.
+ */
+int lp::BuiltinFunctionNode_1::inferType()
+{
+	if (this->_exp->inferType() == NUMBER)
+		return this->fixType(NUMBER);
+
+	return 0;
 }
 
 /**
@@ -1125,7 +1758,7 @@ void lp::BuiltinFunctionNode_1::printAST()
 {
   std::cout << "BuiltinFunctionNode_1: "  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;  
+  std::cout << this->getId() << std::endl;  
   std::cout << "\t";
 	this->_exp->printAST();
 	std::cout << std::endl;
@@ -1143,7 +1776,7 @@ double lp::BuiltinFunctionNode_1::evaluateNumber()
 	if (this->getType() == NUMBER)
 	{
 		// Get the identifier in the table of symbols as BuiltinParameter1
-		lp::BuiltinParameter1 *f = (lp::BuiltinParameter1 *) table.getSymbol( this->_id);
+		lp::BuiltinParameter1 *f = (lp::BuiltinParameter1 *) table.getSymbol(this->_slot);
 
 		// Apply the function to the parameter and copy the result
 		result = f->getFunction()(this->_exp->evaluateNumber());
@@ -1166,22 +1799,43 @@ double lp::BuiltinFunctionNode_1::evaluateNumber()
 
 /**
  * @brief Returns the type of the BuiltinFunctionNode_2.
- * @return The type of the result if both parameters have the same type, otherwise triggers a semantic warning.
+ * @return NUMBER if both parameters are numeric, otherwise triggers a semantic warning.
  */
 int lp::BuiltinFunctionNode_2::getType()
 {
+	// The type is already known
+	if (this->hasCachedType())
+		return this->_type;
+
 	int result = 0;
 		
-	if (this->_exp1->getType() == this->_exp2->getType())
-		result = this->_exp1->getType();
+	if ((this->_exp1->getType() == NUMBER) and (this->_exp2->getType() == NUMBER))
+		result = NUMBER;
 	else
+	{
 		errorMsg = "Incompatible types for \"BuiltinFunctionNode_2\"";
 		
-		suggestion = "Check that both expressions are assigned values of the same type before using them in a numeric operation.";
+		suggestion = "Check that both expressions are assigned numeric values before using them in a numeric operation.";
 		semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
 				 suggestion);
+	}
+
+	return	this->cacheType(result);
+}
+
+/**
+ * @brief Infers the type of the BuiltinFunctionNode_2 without warnings.
+ * @return NUMBER if the types of both children are known to be numeric, otherwise 0.
+ */
+int lp::BuiltinFunctionNode_2::inferType()
+{
+	int type1 = this->_exp1->inferType();
+	int type2 = this->_exp2->inferType();
 
-	return	result;
+	if ((type1 == NUMBER) and (type2 == NUMBER))
+		return this->fixType(NUMBER);
+
+	return 0;
 }
 
 /**
@@ -1191,7 +1845,7 @@ void lp::BuiltinFunctionNode_2::printAST()
 {
   std::cout << "BuiltinFunctionNode_2: " << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;
+  std::cout << this->getId() << std::endl;
   std::cout << "\t";
   this->_exp1->printAST();
   std::cout << "\t";
@@ -1211,7 +1865,7 @@ double lp::BuiltinFunctionNode_2::evaluateNumber()
 	if (this->getType() == NUMBER)
 	{
 		// Get the identifier in the table of symbols as BuiltinParameter2
-		lp::BuiltinParameter2 *f = (lp::BuiltinParameter2 *) table.getSymbol(this->_id);
+		lp::BuiltinParameter2 *f = (lp::BuiltinParameter2 *) table.getSymbol(this->_slot);
 
 		// Apply the function to the parameters and copy the result
 	  	result = f->getFunction()(this->_exp1->evaluateNumber(),this->_exp2->evaluateNumber());
@@ -1252,7 +1906,7 @@ void lp::GreaterThanNode::printAST()
 bool lp::GreaterThanNode::evaluateBool() 
 {
 	bool result = false;
-    std::string leftString, rightString;
+    lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1275,11 +1929,11 @@ bool lp::GreaterThanNode::evaluateBool()
 			result = (leftBoolean > rightBoolean);
 			break;
 		case STRING:
-			leftString = this->_left->evaluateString();
-			rightString = this->_right->evaluateString();
+			leftValue = this->_left->evaluate();
+			rightValue = this->_right->evaluate();
 
 			// 
-			result = (leftString > rightString);
+			result = (leftValue.getString() > rightValue.getString());
 			break;
 		default:
 			errorMsg = "Incompatible types of parameters for operator Greater than";
@@ -1324,7 +1978,7 @@ void lp::GreaterOrEqualNode::printAST()
 bool lp::GreaterOrEqualNode::evaluateBool() 
 {
 	bool result = false;
-	std::string leftString, rightString;
+	lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1346,11 +2000,11 @@ bool lp::GreaterOrEqualNode::evaluateBool()
 			result = (leftBoolean >= rightBoolean);
 			break;
 		case STRING:
-			leftString = this->_left->evaluateString();
-			rightString = this->_right->evaluateString();
+			leftValue = this->_left->evaluate();
+			rightValue = this->_right->evaluate();
 
 			// 
-			result = (leftString >= rightString);
+			result = (leftValue.getString() >= rightValue.getString());
 			break;
 		default:
 			errorMsg = "Incompatible types of parameters for operator Greater or equal than";
@@ -1396,7 +2050,7 @@ void lp::LessThanNode::printAST()
 bool lp::LessThanNode::evaluateBool() 
 {
 	bool result = false;
-    std::string leftString, rightString;
+    lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1419,11 +2073,11 @@ bool lp::LessThanNode::evaluateBool()
 			result = (leftBoolean < rightBoolean);
 			break;
 		case STRING:
-			leftString = this->_left->evaluateString();
-			rightString = this->_right->evaluateString();
+			leftValue = this->_left->evaluate();
+			rightValue = this->_right->evaluate();
 
 			// 
-			result = (leftString < rightString);
+			result = (leftValue.getString() < rightValue.getString());
 			break;
 		default:
 			errorMsg = "Incompatible types of parameters for operator Greater than";
@@ -1468,7 +2122,7 @@ void lp::LessOrEqualNode::printAST()
 bool lp::LessOrEqualNode::evaluateBool() 
 {
 	bool result = false;
-    std::string leftString, rightString;
+    lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1491,11 +2145,11 @@ bool lp::LessOrEqualNode::evaluateBool()
 			result = (leftBoolean <= rightBoolean);
 			break;
 		case STRING:
-			leftString = this->_left->evaluateString();
-			rightString = this->_right->evaluateString();
+			leftValue = this->_left->evaluate();
+			rightValue = this->_right->evaluate();
 
 			// 
-			result = (leftString <= rightString);
+			result = (leftValue.getString() <= rightValue.getString());
 			break;
 		default:
 			errorMsg = "Incompatible types of parameters for operator Greater than";
@@ -1541,7 +2195,7 @@ void lp::EqualNode::printAST()
 bool lp::EqualNode::evaluateBool() 
 {
 	bool result = false;
-	std::string leftString, rightString;
+	lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1563,11 +2217,11 @@ bool lp::EqualNode::evaluateBool()
 				result = (leftBoolean == rightBoolean);
 				break;
 			case STRING:
-				leftString = this->_left->evaluateString();
-				rightString = this->_right->evaluateString();
+				leftValue = this->_left->evaluate();
+				rightValue = this->_right->evaluate();
 
 				// 
-				result = (leftString == rightString);
+				result = (leftValue.getString() == rightValue.getString());
 				break;
 		default:
 				// warning("Runtime error: incompatible types of parameters for ", 
@@ -1616,7 +2270,7 @@ void lp::NotEqualNode::printAST()
 bool lp::NotEqualNode::evaluateBool() 
 {
 	bool result = false;
-    std::string leftString, rightString;
+    lp::Value leftValue, rightValue;
 
 	if (this->getType() == BOOL)
 	{
@@ -1638,11 +2292,11 @@ bool lp::NotEqualNode::evaluateBool()
 				result = (leftBoolean != rightBoolean);
 				break;
 			case STRING:
-				leftString = this->_left->evaluateString();
-				rightString = this->_right->evaluateString();
+				leftValue = this->_left->evaluate();
+				rightValue = this->_right->evaluate();
 
 				// 
-				result = (leftString != rightString);
+				result = (leftValue.getString() != rightValue.getString());
 				break;
 		  default:
 				// warning("Runtime error: incompatible types of parameters for ", 
@@ -1813,7 +2467,7 @@ void lp::AssignmentStmt::printAST()
 {
   std::cout << "assignment_node: ="  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;
+  std::cout << this->getId() << std::endl;
   std::cout << "\t";
 
   // Check the expression
@@ -1841,87 +2495,60 @@ void lp::AssignmentStmt::evaluate()
 		a: firstVar
 		b: secondVar
 	*/
-	lp::Variable *firstVar = (lp::Variable *) table.getSymbol(this->_id);
+	lp::Variable *firstVar = (lp::Variable *) table.getSymbol(this->_slot);
 
 	// Check the expression
 	if (this->_exp != NULL)
 	{
+		// Evaluate the expression once, with its type
+		lp::Value result = this->_exp->evaluate();
+
 		// Check the type of the expression of the asgn
-		switch(this->_exp->getType())
+		switch(result.getTag())
 		{
-			case NUMBER:
+			case lp::Value::NUMBER:
 			{
-				double value;
-				// evaluate the expression as NUMBER
-			 	value = this->_exp->evaluateNumber();
+				double value = result.getNumber();
 
 				// Check the type of the first varible
-				if (firstVar->getType() == NUMBER)
-				{
-				  	// Get the identifier in the table of symbols as NumericVariable
-					lp::NumericVariable *v = (lp::NumericVariable *) table.getSymbol(this->_id);
-
-					// Assignment the value to the identifier in the table of symbols
-					v->setValue(value);
-				}
-				// The type of variable is not NUMBER
-				else
+				if (firstVar->getType() != NUMBER)
 				{
-					// Delete the variable from the table of symbols 
-					table.eraseSymbol(this->_id);
-
-					// Insert the variable in the table of symbols as NumericVariable 
-					// with the type NUMBER and the value 
-					lp::NumericVariable *v = new lp::NumericVariable(this->_id,
-											VARIABLE,NUMBER,value);
-					table.installSymbol(v);
+					// The variable is retyped in place: its address does not change
+					firstVar->retype(NUMBER);
+					// The expressions that use the variable may change their type
+					typeEpoch++;
 				}
+
+				// Assignment the value to the identifier in the table of symbols
+				firstVar->setNumber(value);
 			}
 			break;
-			case STRING:
+			case lp::Value::STRING:
 			{
-				std::string value = this->_exp->evaluateString();
-
-				if (firstVar->getType() == STRING)
+				if (firstVar->getType() != STRING)
 				{
-					lp::StringVariable *v = (lp::StringVariable *) table.getSymbol(this->_id);
-					v->setValue(value);
+					firstVar->retype(STRING);
+					// The expressions that use the variable may change their type
+					typeEpoch++;
 				}
-				else
-				{
-					table.eraseSymbol(this->_id);
 
-					lp::StringVariable *v = new lp::StringVariable(this->_id, VARIABLE, STRING, value);
-					table.installSymbol(v);
-				}
+				// The variable shares the string of the expression
+				firstVar->setString(result);
 			}
 			break;
-			case BOOL:
+			case lp::Value::BOOL:
 			{
-				bool value;
-				// evaluate the expression as BOOL
-			 	value = this->_exp->evaluateBool();
-
-				if (firstVar->getType() == BOOL)
-				{
-				  	// Get the identifier in the table of symbols as LogicalVariable
-					lp::LogicalVariable *v = (lp::LogicalVariable *) table.getSymbol(this->_id);
+				bool value = result.getBool();
 
-					// Assignment the value to the identifier in the table of symbols
-					v->setValue(value);
-				}
-				// The type of variable is not BOOL
-				else
+				if (firstVar->getType() != BOOL)
 				{
-					// Delete the variable from the table of symbols 
-					table.eraseSymbol(this->_id);
-
-					// Insert the variable in the table of symbols as NumericVariable 
-					// with the type BOOL and the value 
-					lp::LogicalVariable *v = new lp::LogicalVariable(this->_id,
-											VARIABLE,BOOL,value);
-					table.installSymbol(v);
+					firstVar->retype(BOOL);
+					// The expressions that use the variable may change their type
+					typeEpoch++;
 				}
+
+				// Assignment the value to the identifier in the table of symbols
+				firstVar->setLogical(value);
 			}
 			break;
 
@@ -1947,70 +2574,40 @@ void lp::AssignmentStmt::evaluate()
 
 
 		/* Get the identifier of the previous asgn in the table of symbols as Variable */
-		lp::Variable *secondVar = (lp::Variable *) table.getSymbol(this->_asgn->_id);
+		lp::Variable *secondVar = (lp::Variable *) table.getSymbol(this->_asgn->_slot);
 
 		// Get the type of the variable of the previous asgn
 		switch(secondVar->getType())
 		{
 			case NUMBER:
 			{
-				/* Get the identifier of the previous asgn in the table of symbols as NumericVariable */
-				lp::NumericVariable *secondVar = (lp::NumericVariable *) table.getSymbol(this->_asgn->_id);
 				// Check the type of the first variable
-				if (firstVar->getType() == NUMBER)
-				{
-				/* Get the identifier of the first variable in the table of symbols as NumericVariable */
-				lp::NumericVariable *firstVar = (lp::NumericVariable *) table.getSymbol(this->_id);
-				  	// Get the identifier o f the in the table of symbols as NumericVariable
-//					lp::NumericVariable *n = (lp::NumericVariable *) table.getSymbol(this->_id);
-
-					// Assignment the value of the second variable to the first variable
-					firstVar->setValue(secondVar->getValue());
-
-				}
-				// The type of variable is not NUMBER
-				else
+				if (firstVar->getType() != NUMBER)
 				{
-					// Delete the first variable from the table of symbols 
-					table.eraseSymbol(this->_id);
-
-					// Insert the first variable in the table of symbols as NumericVariable 
-					// with the type NUMBER and the value of the previous variable 
-					lp::NumericVariable *firstVar = new lp::NumericVariable(this->_id,
-											VARIABLE,NUMBER,secondVar->getValue());
-					table.installSymbol(firstVar);
+					// The first variable is retyped in place
+					firstVar->retype(NUMBER);
+					// The expressions that use the variable may change their type
+					typeEpoch++;
 				}
+
+				// Assignment the value of the second variable to the first variable
+				firstVar->setNumber(secondVar->getNumber());
 			}
 			break;
 
 			case BOOL:
 			{
-				/* Get the identifier of the previous asgn in the table of symbols as LogicalVariable */
-				lp::LogicalVariable *secondVar = (lp::LogicalVariable *) table.getSymbol(this->_asgn->_id);
 				// Check the type of the first variable
-				if (firstVar->getType() == BOOL)
+				if (firstVar->getType() != BOOL)
 				{
-				/* Get the identifier of the first variable in the table of symbols as LogicalVariable */
-				lp::LogicalVariable *firstVar = (lp::LogicalVariable *) table.getSymbol(this->_id);
-				  	// Get the identifier o f the in the table of symbols as NumericVariable
-//					lp::NumericVariable *n = (lp::NumericVariable *) table.getSymbol(this->_id);
-
-					// Assignment the value of the second variable to the first variable
-					firstVar->setValue(secondVar->getValue());
-
-				}
-				// The type of variable is not BOOL
-				else
-				{
-					// Delete the first variable from the table of symbols 
-					table.eraseSymbol(this->_id);
-
-					// Insert the first variable in the table of symbols as NumericVariable 
-					// with the type BOOL and the value of the previous variable 
-					lp::LogicalVariable *firstVar = new lp::LogicalVariable(this->_id,
-											VARIABLE,BOOL,secondVar->getValue());
-					table.installSymbol(firstVar);
+					// The first variable is retyped in place
+					firstVar->retype(BOOL);
+					// The expressions that use the variable may change their type
+					typeEpoch++;
 				}
+
+				// Assignment the value of the second variable to the first variable
+				firstVar->setLogical(secondVar->getLogical());
 			}
 			break;
 
@@ -2020,6 +2617,37 @@ void lp::AssignmentStmt::evaluate()
 	}
 }
 
+/**
+ * @brief Infers the types of the expression of the assignment before the AssignmentStmt is evaluated.
+ */
+void lp::AssignmentStmt::analyze()
+{
+	// Multiple assignment
+	if (this->_exp == NULL)
+		this->_asgn->analyze();
+	else
+		this->_exp->inferType();
+}
+
+/**
+ * @brief Gets the expression appended by an assignment "s := s || e".
+ * @return e, or NULL if the assignment has another form.
+ */
+lp::ExpNode *lp::AssignmentStmt::getAppended() const
+{
+	lp::ConcatenationNode *concatenation = dynamic_cast<lp::ConcatenationNode *>(this->_exp);
+
+	if (concatenation == NULL)
+		return NULL;
+
+	lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(concatenation->getLeft());
+
+	if ((var == NULL) or (var->getSlot() != this->_slot))
+		return NULL;
+
+	return concatenation->getRight();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2030,7 +2658,7 @@ void lp::PlusAssignmentStmt::printAST()
 {
   std::cout << "PlusAssignmentStmt: +="  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;
+  std::cout << this->getId() << std::endl;
   std::cout << "\t";
 
   // Check the expression
@@ -2047,7 +2675,7 @@ void lp::PlusAssignmentStmt::printAST()
 void lp::PlusAssignmentStmt::evaluate() 
 {
 	/* Get the identifier in the table of symbols as Variable */
-	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_id);
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
 	// Check the expression
 	if (this->_exp != NULL)
@@ -2063,8 +2691,8 @@ void lp::PlusAssignmentStmt::evaluate()
 
 				if (var->getType() == NUMBER)
 				{
-					lp::NumericVariable *n = (lp::NumericVariable *) table.getSymbol(this->_id);
-					n->setValue(n->getValue() + value);
+					lp::Variable *n = (lp::Variable *) table.getSymbol(this->_slot);
+					n->setNumber(n->getNumber() + value);
 				}
                 else
                 {
@@ -2093,6 +2721,14 @@ void lp::PlusAssignmentStmt::evaluate()
 	}
 }
 
+/**
+ * @brief Infers the types of the expression of the assignment before the PlusAssignmentStmt is evaluated.
+ */
+void lp::PlusAssignmentStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2103,7 +2739,7 @@ void lp::MinusAssignmentStmt::printAST()
 {
   std::cout << "MinusAssignmentStmt: -="  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id << std::endl;
+  std::cout << this->getId() << std::endl;
   std::cout << "\t";
 
   // Check the expression
@@ -2120,7 +2756,7 @@ void lp::MinusAssignmentStmt::printAST()
 void lp::MinusAssignmentStmt::evaluate() 
 {
 	/* Get the identifier in the table of symbols as Variable */
-	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_id);
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
 	// Check the expression
 	if (this->_exp != NULL)
@@ -2136,8 +2772,8 @@ void lp::MinusAssignmentStmt::evaluate()
 
 				if (var->getType() == NUMBER)
 				{
-					lp::NumericVariable *n = (lp::NumericVariable *) table.getSymbol(this->_id);
-					n->setValue(n->getValue() - value);
+					lp::Variable *n = (lp::Variable *) table.getSymbol(this->_slot);
+					n->setNumber(n->getNumber() - value);
 				}
                 else
                 {
@@ -2166,6 +2802,14 @@ void lp::MinusAssignmentStmt::evaluate()
 	}
 }
 
+/**
+ * @brief Infers the types of the expression of the assignment before the MinusAssignmentStmt is evaluated.
+ */
+void lp::MinusAssignmentStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2185,41 +2829,23 @@ void lp::PrintStmt::printAST()
  */
 void lp::PrintStmt::evaluate() 
 {
+	// Evaluate the expression once, with its type
+	lp::Value value = this->_exp->evaluate();
 
-	switch(this->_exp->getType())
+	switch(value.getTag())
 	{
-		case NUMBER:
-				std::cout << this->_exp->evaluateNumber() << std::endl;
+		case lp::Value::NUMBER:
+				std::cout << value.getNumber() << std::endl;
 				break;
-		case BOOL:
-			if (this->_exp->evaluateBool())
+		case lp::Value::BOOL:
+			if (value.getBool())
 				std::cout << "true" << std::endl;
 			else
 				std::cout << "false" << std::endl;
 			break;
-        case STRING:
-			std::cout << this->_exp->evaluateString() << std::endl;
+        case lp::Value::STRING:
+			std::cout << value.getString() << std::endl;
 			break;
-        case VARIABLE:
-            switch (this->_exp->getType())
-            {
-                case NUMBER:
-                    std::cout << this->_exp->evaluateNumber() << std::endl;
-                    break;
-                case BOOL:
-                    std::cout << (this->_exp->evaluateBool() ? "true" : "false") << std::endl;
-                    break;
-                case STRING:
-                    std::cout << this->_exp->evaluateString() << std::endl;
-                    break;
-                default:
-                    std::string errorMsg = "Unknown variable type in print statement.";
-                    
-                    std::string suggestion = "Check variable type before printing.";
-                    semanticWarning(fileName, _lineNumber, columnNumber, errorMsg,  suggestion);
-                    break;
-            }
-            break;
         
 		default:
 			std::string errorMsg = "Incompatible type for print statement.";
@@ -2230,6 +2856,14 @@ void lp::PrintStmt::evaluate()
 	}
 }
 
+/**
+ * @brief Infers the types of the expression to print before the PrintStmt is evaluated.
+ */
+void lp::PrintStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2241,7 +2875,7 @@ void lp::ReadStmt::printAST()
 {
   std::cout << "ReadStmt: read"  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id;
+  std::cout << this->getId();
   std::cout << std::endl;
 }
 
@@ -2254,30 +2888,18 @@ void lp::ReadStmt::evaluate()
 	std::cin >> value;
 
 	/* Get the identifier in the table of symbols as Variable */
-	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_id);
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
-	// Check if the type of the variable is NUMBER
-	if (var->getType() == NUMBER)
+	// The variable is retyped in place if it is not NUMBER
+	if (var->getType() != NUMBER)
 	{
-		/* Get the identifier in the table of symbols as NumericVariable */
-		lp::NumericVariable *n = (lp::NumericVariable *) table.getSymbol(this->_id);
-						
-		/* Assignment the read value to the identifier */
-		n->setValue(value);
+		var->retype(NUMBER);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
 	}
-	// The type of variable is not NUMBER
-	else
-	{
-		// Delete $1 from the table of symbols as Variable
-		table.eraseSymbol(this->_id);
 
-			// Insert $1 in the table of symbols as NumericVariable 
-		// with the type NUMBER and the read value 
-		lp::NumericVariable *n = new lp::NumericVariable(this->_id, 
-									  VARIABLE,NUMBER,value);
-
-		table.installSymbol(n);
-	}
+	/* Assignment the read value to the identifier */
+	var->setNumber(value);
 }
 
 
@@ -2291,7 +2913,7 @@ void lp::ReadStringStmt::printAST()
 {
   std::cout << "ReadStringStmt: read"  << std::endl;
   std::cout << "\t";
-  std::cout << this->_id;
+  std::cout << this->getId();
   std::cout << std::endl;
 }
 
@@ -2304,20 +2926,17 @@ void lp::ReadStringStmt::evaluate()
 
     std::cin >> value;
 
-    lp::Variable *var = (lp::Variable *) table.getSymbol(this->_id);
+    lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
 
-    if (var && var->getType() == STRING)
+    // The variable is retyped in place if it is not STRING
+    if (var->getType() != STRING)
     {
-        lp::StringVariable *strVar = (lp::StringVariable *) var;
-        strVar->setValue(value);
+        var->retype(STRING);
+        // The expressions that use the variable may change their type
+        typeEpoch++;
     }
-    else
-    {
-        table.eraseSymbol(this->_id);
 
-        lp::StringVariable *strVar = new lp::StringVariable(this->_id, VARIABLE, STRING, value);
-        table.installSymbol(strVar);
-    }
+    var->setString(value);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2377,25 +2996,56 @@ void lp::IfStmt::printAST()
 void lp::IfStmt::evaluate() 
 {
     if (this->_cond->evaluateBool() == true)
-    {
-        for (std::list<Statement*>::iterator stmtIter = _stmt1->begin(); stmtIter != _stmt1->end(); ++stmtIter) 
-        {
-            (*stmtIter)->evaluate();
-        }
-    }
-    else if(this->_stmt2 != NULL)
-    {
-        for (std::list<Statement*>::iterator stmtIter = _stmt2->begin(); stmtIter != _stmt2->end(); ++stmtIter) 
-        {
-            (*stmtIter)->evaluate();
-        }
-    }
+        evaluateBody(this->_body1);
+    else if(this->_body2 != NULL)
+        evaluateBody(this->_body2);
+}
+
+/**
+ * @brief Infers the types of the condition and the branches before the IfStmt is evaluated.
+ */
+void lp::IfStmt::analyze()
+{
+	this->_cond->inferType();
+
+	analyzeStatements(this->_stmt1);
+
+	// The alternative is optional
+	if (this->_stmt2 != NULL)
+		analyzeStatements(this->_stmt2);
+}
+
+/**
+ * @brief Lays out the consequent and the alternative of the IfStmt in arrays.
+ */
+void lp::IfStmt::freeze()
+{
+	this->_body1 = freezeStatements(this->_stmt1);
+
+	if (this->_stmt2 != NULL)
+		this->_body2 = freezeStatements(this->_stmt2);
 }
 
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief Counts an iteration of a loop run by the AST and promotes the loop when it gets hot.
+ * @param loop WhileStmt, DoWhileStmt, RepeatStmt or ForStmt.
+ * @return true if the loop has just been promoted to the tier.
+ * @note The loops are only counted when there is a tier. A loop refused by the tier is not offered again.
+ */
+static bool heat(lp::Statement *loop)
+{
+	if ((tier == NULL) or (++loop->_iterations != tier->getThreshold()))
+		return false;
+
+	loop->_promoted = tier->promote(loop);
+
+	return loop->_promoted;
+}
+
 /**
  * @brief Prints the AST representation of a WhileStmt.
  */
@@ -2421,16 +3071,47 @@ void lp::WhileStmt::printAST()
  */
 void lp::WhileStmt::evaluate() 
 {
+  resetInvariants(this->_invariants);
+
+  // A hot loop is run by the tier
+  if (this->_promoted)
+  {
+	tier->run(this);
+	return;
+  }
+
   // While the condition is true. the body is run 
   while (this->_cond->evaluateBool() == true)
   {	
-	    for (std::list<Statement*>::iterator stmtIter = _stmt->begin(); stmtIter != _stmt->end(); ++stmtIter) 
-        {
-            (*stmtIter)->evaluate();
-        }
+	    evaluateBody(this->_body);
+
+	    // The tier goes on from the next test of the condition
+	    if (heat(this))
+	    {
+	        tier->run(this);
+	        return;
+	    }
   }
 }
 
+/**
+ * @brief Infers the types of the condition and the body before the WhileStmt is evaluated.
+ */
+void lp::WhileStmt::analyze()
+{
+	this->_cond->inferType();
+
+	analyzeStatements(this->_stmt);
+}
+
+/**
+ * @brief Lays out the body of the WhileStmt in an array.
+ */
+void lp::WhileStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmt);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2459,14 +3140,44 @@ void lp::DoWhileStmt::printAST()
  */
 void lp::DoWhileStmt::evaluate() 
 {
+  resetInvariants(this->_invariants);
+
+  // A hot loop is run by the tier
+  if (this->_promoted)
+  {
+	tier->run(this);
+	return;
+  }
+
+  bool hot = false;
+
   // The body is run at least once, then the condition is checked
   do
   {
-	for (std::list<Statement*>::iterator stmtIter = _stmt->begin(); stmtIter != _stmt->end(); ++stmtIter) 
-    {
-        (*stmtIter)->evaluate();
-    }
-  } while (this->_cond->evaluateBool() == true);
+	evaluateBody(this->_body);
+  } while ((this->_cond->evaluateBool() == true) and not (hot = heat(this)));
+
+  // The tier goes on from the next run of the body
+  if (hot)
+	tier->run(this);
+}
+
+/**
+ * @brief Infers the types of the condition and the body before the DoWhileStmt is evaluated.
+ */
+void lp::DoWhileStmt::analyze()
+{
+	this->_cond->inferType();
+
+	analyzeStatements(this->_stmt);
+}
+
+/**
+ * @brief Lays out the body of the DoWhileStmt in an array.
+ */
+void lp::DoWhileStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmt);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2497,12 +3208,43 @@ void lp::RepeatStmt::printAST()
  */
 void lp::RepeatStmt::evaluate() 
 {
+  resetInvariants(this->_invariants);
+
+  // A hot loop is run by the tier
+  if (this->_promoted)
+  {
+	tier->run(this);
+	return;
+  }
+
+  bool hot = false;
+
   // While the condition is false. the body is run 
   do {
-    for (std::list<Statement*>::iterator stmtIter = _stmt->begin(); stmtIter != _stmt->end(); ++stmtIter) {
-        (*stmtIter)->evaluate();
-     }
-  } while (!_cond->evaluateBool());
+    evaluateBody(this->_body);
+  } while (!_cond->evaluateBool() and not (hot = heat(this)));
+
+  // The tier goes on from the next run of the body
+  if (hot)
+	tier->run(this);
+}
+
+/**
+ * @brief Infers the types of the condition and the body before the RepeatStmt is evaluated.
+ */
+void lp::RepeatStmt::analyze()
+{
+	this->_cond->inferType();
+
+	analyzeStatements(this->_stmt);
+}
+
+/**
+ * @brief Lays out the body of the RepeatStmt in an array.
+ */
+void lp::RepeatStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmt);
 }
 
 
@@ -2517,7 +3259,7 @@ void lp::ForStmt::printAST()
     std::cout << "ForStmt: " << std::endl;
     // Identifier to initialize
     std::cout << "\t";
-    std::cout << this->_id;
+    std::cout << this->getId();
 
     // From expresion
     std::cout << "\t";
@@ -2534,9 +3276,12 @@ void lp::ForStmt::printAST()
 }
 
 /**
- * @brief Evaluates the for statement, executing the block for each value in the range.
+ * @brief Checks the bounds and the step of the for statement and gives the loop variable its initial value.
+ * @param step Receives the step of the loop.
+ * @param generation Receives the generation of the loop, to be given to Variable::counter at each step.
+ * @return The loop variable, or NULL if the initial value is not numeric.
  */
-void lp::ForStmt::evaluate()
+lp::Variable *lp::ForStmt::begin(double & step, int & generation)
 {
     // Validate that _from is a numeric expression
     if (this->_from->getType() != NUMBER)
@@ -2545,7 +3290,7 @@ void lp::ForStmt::evaluate()
         suggestion = "Ensure the 'from' expression evaluates to a numeric value.";
         semanticWarning(fileName, _lineNumber, columnNumber, errorMsg,
                      suggestion);
-        return;
+        return NULL;
     }
 
     // Validate that _to is a numeric expression
@@ -2578,35 +3323,33 @@ void lp::ForStmt::evaluate()
                  suggestion);
     }
 
-    lp::NumericVariable *loopVar = NULL;
+    lp::Variable *loopVar = NULL;
 
     // Check if the loop variable already exists in the symbol table
-    if (!table.lookupSymbol(this->_id))
+    if (table.getSymbol(this->_slot) == NULL)
     {
         // If not, create it initialized to 'from' value
-        loopVar = new lp::NumericVariable(this->_id, VARIABLE, NUMBER, this->_from->evaluateNumber());
+        loopVar = new lp::Variable(this->getId(), VARIABLE, NUMBER);
+        loopVar->setNumber(this->_from->evaluateNumber());
         table.installSymbol(loopVar);
     }
     else
     {
         // Get the existing symbol for the loop variable
-        lp::Variable *symbol = (lp::Variable *)table.getSymbol(this->_id);
+        lp::Variable *symbol = (lp::Variable *)table.getSymbol(this->_slot);
 
-        if (symbol->getType() == NUMBER)
-        {
-            // If symbol is numeric, use it as the loop variable
-            loopVar = (lp::NumericVariable *)symbol;
-        }
-        else
+        if (symbol->getType() != NUMBER)
         {
-            // If symbol is not numeric, erase it and recreate as numeric
-            table.eraseSymbol(this->_id);
-            loopVar = new lp::NumericVariable(this->_id, VARIABLE, NUMBER);
-            table.installSymbol(loopVar);
+            // If symbol is not numeric, it is retyped in place
+            symbol->retype(NUMBER);
+            // The expressions that use the variable may change their type
+            typeEpoch++;
         }
 
+        loopVar = symbol;
+
         // Initialize the loop variable value to 'from'
-        loopVar->setValue(this->_from->evaluateNumber());
+        loopVar->setNumber(this->_from->evaluateNumber());
     }
 
     // Default step value
@@ -2617,104 +3360,436 @@ void lp::ForStmt::evaluate()
     {
         double evaluatedStep = this->_step->evaluateNumber();
 
-        if (evaluatedStep <= ERROR_BOUND)
-        {
-            errorMsg = "Step value must be a numeric constant greater than the error bound.";
-            
-            suggestion = "Verify that the step value is numeric and exceeds the defined error bound before use.";
-            semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
-                 suggestion);
-        }
-        else
-        {
-            stepValue = evaluatedStep;
-        }
-    }
+        if (evaluatedStep <= ERROR_BOUND)
+        {
+            errorMsg = "Step value must be a numeric constant greater than the error bound.";
+            
+            suggestion = "Verify that the step value is numeric and exceeds the defined error bound before use.";
+            semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, 
+                 suggestion);
+        }
+        else
+        {
+            stepValue = evaluatedStep;
+        }
+    }
+
+    step = stepValue;
+
+    // A retype of the variable by the body detaches the loop from it
+    generation = loopVar->arm();
+
+    return loopVar;
+}
+
+/**
+ * @brief Evaluates the for statement, executing the block for each value in the range.
+ */
+void lp::ForStmt::evaluate()
+{
+    resetInvariants(this->_invariants);
+
+    // A hot loop is run by the tier
+    if (this->_promoted)
+    {
+        tier->run(this);
+        return;
+    }
+
+    double stepValue;
+    int generation;
+    lp::Variable *loopVar = this->begin(stepValue, generation);
+
+    if (loopVar == NULL)
+        return;
+
+    if (this->_counting)
+    {
+        // Counting loop: the loop variable is kept in a local double
+        double value = loopVar->getNumber();
+
+        while (value <= this->_to->evaluateNumber())
+        {
+            evaluateBody(this->_body);
+
+            value += stepValue;
+
+            // The table of symbols is only updated if the loop variable is read
+            if (this->_observed)
+                loopVar->setNumber(value);
+
+            // The tier goes on from the next test of the upper bound
+            if (heat(this))
+            {
+                loopVar->setNumber(value);
+                tier->resume(this, loopVar, generation, stepValue);
+                return;
+            }
+        }
+
+        loopVar->setNumber(value);
+        loopVar->disarm();
+        return;
+    }
+
+    // Loop execution: increment loopVar by stepValue until it passes 'to'
+    for (; loopVar->getNumber() <= this->_to->evaluateNumber(); loopVar->setNumber(loopVar->getNumber() + stepValue))
+    {
+        // Evaluate all statements inside the loop body
+        evaluateBody(this->_body);
+
+        // The body may have detached the loop from its variable
+        loopVar = loopVar->counter(generation);
+
+        // The tier goes on from the next test of the upper bound
+        if (heat(this))
+        {
+            loopVar->setNumber(loopVar->getNumber() + stepValue);
+            tier->resume(this, loopVar, generation, stepValue);
+            return;
+        }
+    }
+
+    loopVar->disarm();
+}
+
+/**
+ * @brief Infers the types of the bounds, the step and the body before the ForStmt is evaluated.
+ */
+void lp::ForStmt::analyze()
+{
+	this->_from->inferType();
+	this->_to->inferType();
+
+	if (this->_step != NULL)
+		this->_step->inferType();
+
+	analyzeStatements(this->_stmt);
+
+	// A counting loop needs a constant step and a body that never writes the loop variable
+	bool reads = readsSlot(this->_to, this->_slot);
+	bool writes = false;
+
+	findSlot(this->_stmt, this->_slot, reads, writes);
+
+	this->_counting = ((this->_step == NULL) or (dynamic_cast<lp::NumberNode *>(this->_step) != NULL))
+	                  and (writes == false);
+	this->_observed = reads;
+	this->_written = writes;
+}
+
+/**
+ * @brief Lays out the body of the ForStmt in an array.
+ */
+void lp::ForStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmt);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/**
+ * @brief Prints the AST representation of a CaseStmt.
+ */
+void lp::CaseStmt::printAST() {
+	std::cout << "CaseStmt: case" << std::endl;
+	std::cout << "\t";
+	std::cout << std::endl;
+}
+
+/**
+ * @brief Evaluates the case statement, executing all statements in the case block.
+ */
+void lp::CaseStmt::evaluate() {
+
+    evaluateBody(this->_body);
+}
+
+/**
+ * @brief Infers the types of the label and the statements before the CaseStmt is evaluated.
+ */
+void lp::CaseStmt::analyze()
+{
+	this->_exp->inferType();
+
+	analyzeStatements(this->_stmt);
+}
+
+/**
+ * @brief Lays out the statements of the CaseStmt in an array.
+ */
+void lp::CaseStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmt);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/**
+ * @brief Prints the AST representation of a SwitchStmt.
+ */
+void lp::SwitchStmt::printAST() {
+	std::cout << "SwitchStmt: switch" << std::endl;
+	std::cout << "\t";
+	std::cout << std::endl;
+}
+
+/**
+ * @brief Orders the labels of a switch by their values.
+ */
+static bool compareLabels(std::pair<double, lp::CaseStmt *> const & a, std::pair<double, lp::CaseStmt *> const & b)
+{
+	return a.first < b.first;
+}
+
+/**
+ * @brief Hash of a string label of a switch (FNV-1a).
+ * @param text String.
+ * @return The hash of the string.
+ */
+static unsigned long hashLabel(std::string const & text)
+{
+	unsigned long hash = 2166136261UL;
+
+	for (std::string::size_type i = 0; i < text.size(); i++)
+	{
+		hash ^= (unsigned char) text[i];
+		hash *= 16777619UL;
+	}
+
+	return hash;
+}
+
+/**
+ * @brief Checks whether the labels of the switch are string literals.
+ * @return true if there are cases and all their labels are StringNode.
+ */
+bool lp::SwitchStmt::hasStringLabels() const
+{
+	if (this->_caselist->empty())
+		return false;
+
+	for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+		if (dynamic_cast<lp::StringNode *>((*it)->getExp()) == NULL)
+			return false;
+
+	return true;
+}
+
+/**
+ * @brief Chooses how to find the case of a value and builds its table.
+ * @note The labels are evaluated in order unless all of them are integer literals or
+ *       string literals. When a label is repeated, the first case keeps it, as in the evaluation in order.
+ */
+void lp::SwitchStmt::prepare()
+{
+	this->_dispatch = LINEAR;
+
+	if (this->hasStringLabels())
+	{
+		std::vector<std::pair<std::string, lp::CaseStmt *> >::size_type size = 2;
+
+		while (size < 2 * this->_caselist->size())
+			size *= 2;
+
+		this->_buckets.assign(size, std::make_pair(std::string(), (lp::CaseStmt *) NULL));
+
+		for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+		{
+			std::string label = ((lp::StringNode *) (*it)->getExp())->getString();
+			unsigned long bucket = hashLabel(label) & (size - 1);
+
+			while ((this->_buckets[bucket].second != NULL) and (this->_buckets[bucket].first != label))
+				bucket = (bucket + 1) & (size - 1);
+
+			if (this->_buckets[bucket].second == NULL)
+				this->_buckets[bucket] = std::make_pair(label, *it);
+		}
+
+		this->_dispatch = STRINGS;
+		return;
+	}
+
+	std::vector<std::pair<double, lp::CaseStmt *> > labels;
+
+	for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+	{
+		lp::NumberNode *number = dynamic_cast<lp::NumberNode *>((*it)->getExp());
+
+		// A label that is not an integer literal is evaluated every time
+		if ((number == NULL) or (number->getNumber() != std::floor(number->getNumber()))
+		    or (std::fabs(number->getNumber()) > 1.0e9))
+			return;
+
+		labels.push_back(std::make_pair(number->getNumber(), *it));
+	}
 
-    // Loop execution: increment loopVar by stepValue until it passes 'to'
-    for (; loopVar->getValue() <= this->_to->evaluateNumber(); loopVar->setValue(loopVar->getValue() + stepValue))
-    {
-        // Evaluate all statements inside the loop body
-        for (std::list<Statement*>::iterator stmtIter = _stmt->begin(); stmtIter != _stmt->end(); ++stmtIter)
-        {
-            (*stmtIter)->evaluate();
-        }
-    }
-}
+	if (labels.empty())
+		return;
 
+	// Sort keeping the order of the cases of equal labels, then keep the first one
+	std::stable_sort(labels.begin(), labels.end(), compareLabels);
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
+	for (std::vector<std::pair<double, lp::CaseStmt *> >::size_type i = 0; i < labels.size(); i++)
+		if (this->_labels.empty() or (this->_labels.back().first != labels[i].first))
+			this->_labels.push_back(labels[i]);
 
+	double span = this->_labels.back().first - this->_labels.front().first + 1;
 
-/**
- * @brief Prints the AST representation of a CaseStmt.
- */
-void lp::CaseStmt::printAST() {
-	std::cout << "CaseStmt: case" << std::endl;
-	std::cout << "\t";
-	std::cout << std::endl;
+	// The jump table is used when at most three quarters of its entries are empty
+	if (span <= 4 * this->_labels.size() + 8)
+	{
+		this->_first = this->_labels.front().first;
+		this->_jumps.assign((std::vector<lp::CaseStmt *>::size_type) span, (lp::CaseStmt *) NULL);
+
+		for (std::vector<std::pair<double, lp::CaseStmt *> >::size_type i = 0; i < this->_labels.size(); i++)
+			this->_jumps[(std::vector<lp::CaseStmt *>::size_type) (this->_labels[i].first - this->_first)] = this->_labels[i].second;
+
+		this->_labels.clear();
+		this->_dispatch = DENSE;
+	}
+	else
+		this->_dispatch = SORTED;
 }
 
 /**
- * @brief Evaluates the case statement, executing all statements in the case block.
+ * @brief Finds the case of a numeric value when all the labels are integers.
+ * @param value Value of the expression of the switch.
+ * @return The case whose label is within ERROR_BOUND of the value, or NULL.
  */
-void lp::CaseStmt::evaluate() {
+lp::CaseStmt *lp::SwitchStmt::findNumber(double value) const
+{
+	// Only the closest integer can be within ERROR_BOUND of the value
+	double label = std::floor(value + 0.5);
 
-    std::list<Statement*>::iterator stmtIter;
+	if (not (std::fabs(value - label) < ERROR_BOUND))
+		return NULL;
 
-    for(stmtIter = this->_stmt->begin(); stmtIter != this->_stmt->end(); stmtIter++)
-    {
-        (*stmtIter)->evaluate();
-    }
-}
+	if (this->_dispatch == DENSE)
+	{
+		if ((label < this->_first) or (label - this->_first >= this->_jumps.size()))
+			return NULL;
 
+		return this->_jumps[(std::vector<lp::CaseStmt *>::size_type) (label - this->_first)];
+	}
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
+	// Bisection of the sorted labels
+	std::vector<std::pair<double, lp::CaseStmt *> >::size_type low = 0, high = this->_labels.size();
+
+	while (low < high)
+	{
+		std::vector<std::pair<double, lp::CaseStmt *> >::size_type middle = (low + high) / 2;
+
+		if (this->_labels[middle].first < label)
+			low = middle + 1;
+		else
+			high = middle;
+	}
 
+	if ((low < this->_labels.size()) and (this->_labels[low].first == label))
+		return this->_labels[low].second;
+
+	return NULL;
+}
 
 /**
- * @brief Prints the AST representation of a SwitchStmt.
+ * @brief Finds the case of a string in the hash table of the labels.
+ * @param value Value of the expression of the switch.
+ * @return The case whose label is the string, or NULL.
  */
-void lp::SwitchStmt::printAST() {
-	std::cout << "SwitchStmt: switch" << std::endl;
-	std::cout << "\t";
-	std::cout << std::endl;
+lp::CaseStmt *lp::SwitchStmt::findString(std::string const & value) const
+{
+	unsigned long mask = this->_buckets.size() - 1;
+	unsigned long bucket = hashLabel(value) & mask;
+
+	while (this->_buckets[bucket].second != NULL)
+	{
+		if (this->_buckets[bucket].first == value)
+			return this->_buckets[bucket].second;
+
+		bucket = (bucket + 1) & mask;
+	}
+
+	return NULL;
 }
 
 /**
  * @brief Evaluates the switch statement, executing the matching case or the default block.
  */
 void lp::SwitchStmt::evaluate() {
-    double condValue = this->_exp->evaluateNumber();
-    bool matched = false;
+    if (this->_dispatch == UNKNOWN)
+        this->prepare();
+
+    lp::CaseStmt *found = NULL;
 
-    for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+    if (this->_dispatch == STRINGS)
     {
-        double caseValue = (*it)->getExp()->evaluateNumber();
+        lp::Value condValue = this->_exp->evaluate();
 
-        if (fabs(condValue - caseValue) < ERROR_BOUND)
+        if (condValue.getTag() != lp::Value::STRING)
         {
-            matched = true;
-            std::list<lp::Statement *> *stmts = (*it)->getStatements();
-
-            for (std::list<lp::Statement *>::iterator s = stmts->begin(); s != stmts->end(); ++s)
-            {
-                (*s)->evaluate();
-            }
-
-            break;
+            errorMsg = "Incompatible type of expression for switch";
+            suggestion = "Check that the expression of a switch with string labels is a string.";
+            semanticWarning(fileName, _lineNumber, columnNumber, errorMsg, suggestion);
+            return;
         }
-    }
 
-    if (!matched && this->_defaultlist != NULL)
+        found = this->findString(condValue.getString());
+    }
+    else if (this->_dispatch != LINEAR)
+        found = this->findNumber(this->_exp->evaluateNumber());
+    else
     {
-        for (std::list<lp::Statement *>::iterator s = this->_defaultlist->begin(); s != this->_defaultlist->end(); ++s)
+        double condValue = this->_exp->evaluateNumber();
+
+        for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
         {
-            (*s)->evaluate();
+            double caseValue = (*it)->getExp()->evaluateNumber();
+
+            if (fabs(condValue - caseValue) < ERROR_BOUND)
+            {
+                found = *it;
+                break;
+            }
         }
     }
+
+    lp::Statement **body = (found != NULL) ? found->getBody() : this->_defaultBody;
+
+    if (body != NULL)
+        evaluateBody(body);
+}
+
+/**
+ * @brief Infers the types of the expression, the cases and the default statements before the SwitchStmt is evaluated.
+ */
+void lp::SwitchStmt::analyze()
+{
+	this->_exp->inferType();
+
+	for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+		(*it)->analyze();
+
+	if (this->_defaultlist != NULL)
+		analyzeStatements(this->_defaultlist);
+}
+
+/**
+ * @brief Lays out the statements of the cases and of the default of the SwitchStmt in arrays.
+ */
+void lp::SwitchStmt::freeze()
+{
+	for (std::list<lp::CaseStmt *>::iterator it = this->_caselist->begin(); it != this->_caselist->end(); ++it)
+		(*it)->freeze();
+
+	if (this->_defaultlist != NULL)
+		this->_defaultBody = freezeStatements(this->_defaultlist);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2737,11 +3812,10 @@ void lp::UnaryIncrementStmt::printAST() {
 void lp::UnaryIncrementStmt::evaluate() {
 	VariableNode* varNode = dynamic_cast<VariableNode*>(this->_exp);
 	if (varNode) {
-		std::string varName = varNode->getId();
-		lp::Variable *var = (lp::Variable *) table.getSymbol(varName);
+		lp::Variable *var = (lp::Variable *) table.getSymbol(varNode->getSlot());
 		if (var && var->getType() == NUMBER) {
-			lp::NumericVariable *n = (lp::NumericVariable *) var;
-			n->setValue(n->getValue() + 1);
+			lp::Variable *n = var;
+			n->setNumber(n->getNumber() + 1);
 		} else {
 			errorMsg = "Unary increment operation can only be applied to numeric variables.";
 			suggestion = "Ensure that the variable is numeric before applying unary increment.";
@@ -2754,6 +3828,14 @@ void lp::UnaryIncrementStmt::evaluate() {
 	}
 }
 
+/**
+ * @brief Infers the types of the operand before the UnaryIncrementStmt is evaluated.
+ */
+void lp::UnaryIncrementStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2775,11 +3857,10 @@ void lp::UnaryDecrementStmt::printAST() {
 void lp::UnaryDecrementStmt::evaluate() {
 	VariableNode* varNode = dynamic_cast<VariableNode*>(this->_exp);
 	if (varNode) {
-		std::string varName = varNode->getId();
-		lp::Variable *var = (lp::Variable *) table.getSymbol(varName);
+		lp::Variable *var = (lp::Variable *) table.getSymbol(varNode->getSlot());
 		if (var && var->getType() == NUMBER) {
-			lp::NumericVariable *n = (lp::NumericVariable *) var;
-			n->setValue(n->getValue() - 1);
+			lp::Variable *n = var;
+			n->setNumber(n->getNumber() - 1);
 		} else {
 			errorMsg = "Unary decrement operation can only be applied to numeric variables.";
 			suggestion = "Ensure that the variable is numeric before applying unary decrement.";
@@ -2792,6 +3873,14 @@ void lp::UnaryDecrementStmt::evaluate() {
 	}
 }
 
+/**
+ * @brief Infers the types of the operand before the UnaryDecrementStmt is evaluated.
+ */
+void lp::UnaryDecrementStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2812,11 +3901,10 @@ void lp::UnaryFactorialStmt::printAST() {
 void lp::UnaryFactorialStmt::evaluate() {
 	VariableNode* varNode = dynamic_cast<VariableNode*>(this->_exp);
 	if (varNode) {
-		std::string varName = varNode->getId();
-		lp::Variable *var = (lp::Variable *) table.getSymbol(varName);
+		lp::Variable *var = (lp::Variable *) table.getSymbol(varNode->getSlot());
 		if (var && var->getType() == NUMBER) {
-			lp::NumericVariable *n = (lp::NumericVariable *) var;
-			double value = n->getValue();
+			lp::Variable *n = var;
+			double value = n->getNumber();
 			if (value < 0 || value != static_cast<int>(value)) {
 				errorMsg = "Factorial is only defined for non-negative integers.";
 				suggestion = "Ensure the variable is a non-negative integer before applying factorial.";
@@ -2826,7 +3914,7 @@ void lp::UnaryFactorialStmt::evaluate() {
 				for (int i = 2; i <= static_cast<int>(value); ++i) {
 					result *= i;
 				}
-				n->setValue(result);
+				n->setNumber(result);
 			}
 		} else {
 			errorMsg = "Unary factorial operation can only be applied to numeric variables.";
@@ -2840,6 +3928,14 @@ void lp::UnaryFactorialStmt::evaluate() {
 	}
 }
 
+/**
+ * @brief Infers the types of the operand before the UnaryFactorialStmt is evaluated.
+ */
+void lp::UnaryFactorialStmt::analyze()
+{
+	this->_exp->inferType();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -2863,6 +3959,17 @@ int lp::RandomNode::getType() {
     return NUMBER;
 }
 
+/**
+ * @brief Infers the type of the RandomNode (always NUMBER).
+ * @return NUMBER type.
+ */
+int lp::RandomNode::inferType() {
+    this->_min->inferType();
+    this->_max->inferType();
+
+    return this->fixType(NUMBER);
+}
+
 /**
  * @brief Evaluates and returns a random number between the min and max values.
  *        If min and max are strings, they are interpreted as variable names.
@@ -2899,23 +4006,23 @@ double lp::RandomNode::evaluateNumber() {
         lp::Variable *symbolMin = (lp::Variable *)table.getSymbol(this->_min->evaluateString());
         lp::Variable *symbolMax = (lp::Variable *)table.getSymbol(this->_max->evaluateString());
 
-        lp::NumericVariable *randomVarMin = NULL;
-        lp::NumericVariable *randomVarMax = NULL;
+        lp::Variable *randomVarMin = NULL;
+        lp::Variable *randomVarMax = NULL;
 
         if (symbolMin && symbolMin->getType() == NUMBER)
         {
-            randomVarMin = (lp::NumericVariable *)symbolMin;
+            randomVarMin = symbolMin;
         }
 
         if (symbolMax && symbolMax->getType() == NUMBER)
         {
-            randomVarMax = (lp::NumericVariable *)symbolMax;
+            randomVarMax = symbolMax;
         }
 
         if (randomVarMin && randomVarMax)
         {
-            minVal = randomVarMin->getValue();
-            maxVal = randomVarMax->getValue();
+            minVal = randomVarMin->getNumber();
+            maxVal = randomVarMax->getNumber();
 
             int scale = 1000;
             int minScaled = static_cast<int>(minVal * scale);
@@ -2966,12 +4073,23 @@ void lp::BlockStmt::printAST()
  */
 void lp::BlockStmt::evaluate() 
 {
-  std::list<Statement *>::iterator stmtIter;
+  evaluateBody(this->_body);
+}
 
-  for (stmtIter = this->_stmts->begin(); stmtIter != this->_stmts->end(); stmtIter++) 
-  {
-    (*stmtIter)->evaluate();
-  }
+/**
+ * @brief Infers the types of the statements of the block before the BlockStmt is evaluated.
+ */
+void lp::BlockStmt::analyze()
+{
+	analyzeStatements(this->_stmts);
+}
+
+/**
+ * @brief Lays out the statements of the BlockStmt in an array.
+ */
+void lp::BlockStmt::freeze()
+{
+	this->_body = freezeStatements(this->_stmts);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -3025,26 +4143,26 @@ void lp::PlaceStmt::evaluate()
     lp::Variable *symbolX = (lp::Variable *)table.getSymbol(this->_x->evaluateString());
 	lp::Variable *symbolY = (lp::Variable *)table.getSymbol(this->_y->evaluateString());
 
-    lp::NumericVariable * placeVarX = NULL;
-    lp::NumericVariable * placeVarY = NULL;
+    lp::Variable * placeVarX = NULL;
+    lp::Variable * placeVarY = NULL;
 
     if (symbolX->getType() == NUMBER)
     {
         // If symbol is numeric, use it as the loop variable
-        placeVarX = (lp::NumericVariable *)symbolX;
+        placeVarX = symbolX;
     }
 
     if (symbolY->getType() == NUMBER)
     {
         // If symbol is numeric, use it as the loop variable
-        placeVarY = (lp::NumericVariable *)symbolY;
+        placeVarY = symbolY;
     }
 
-    placeVarX->setValue(this->_x->evaluateNumber());
-    placeVarY->setValue(this->_x->evaluateNumber());
+    placeVarX->setNumber(this->_x->evaluateNumber());
+    placeVarY->setNumber(this->_x->evaluateNumber());
 
-    x = placeVarX->getValue();
-    y = placeVarY->getValue();
+    x = placeVarX->getNumber();
+    y = placeVarY->getNumber();
 
     PLACE(x, y);
   }
@@ -3057,6 +4175,212 @@ void lp::PlaceStmt::evaluate()
   }
 }
 
+/**
+ * @brief Infers the types of the coordinates before the PlaceStmt is evaluated.
+ */
+void lp::PlaceStmt::analyze()
+{
+	this->_x->inferType();
+	this->_y->inferType();
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Reads the value of the operand of a fused node.
+ * @param operand Literal or variable.
+ * @param result Value of the operand.
+ * @return false if the variable is not numeric.
+ */
+static inline bool fusedNumber(lp::FusedOperand const & operand, double & result)
+{
+	if (operand.getSlot() < 0)
+	{
+		result = operand.getValue();
+		return true;
+	}
+
+	lp::Variable *var = (lp::Variable *) table.getSymbol(operand.getSlot());
+
+	if (var->getType() != NUMBER)
+		return false;
+
+	result = var->getNumber();
+	return true;
+}
+
+/**
+ * @brief Adds the operand to the variable, or evaluates the original assignment.
+ */
+void lp::FusedAssignmentStmt::evaluate()
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->getSlot());
+	double value;
+
+	// The original assignment reports the errors and changes the type of the variable
+	if ((var->getType() != NUMBER) or not fusedNumber(this->_operand, value))
+	{
+		lp::AssignmentStmt::evaluate();
+		return;
+	}
+
+	lp::Variable *n = var;
+
+	n->setNumber(n->getNumber() + this->_sign * value);
+	(*this->_fired)++;
+}
+
+/**
+ * @brief Appends the tail to the string of the variable, or evaluates the original assignment.
+ * @note The type of the concatenation is checked as the original does, so the errors are the same.
+ */
+void lp::FusedAppendStmt::evaluate()
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->getSlot());
+
+	if ((var->getType() != STRING) or (this->getExp()->getType() != STRING))
+	{
+		lp::AssignmentStmt::evaluate();
+		return;
+	}
+
+	lp::Value tail = this->_tail->evaluate();
+
+	var->append(tail.getString());
+	(*this->_fired)++;
+}
+
+/**
+ * @brief Sign of the operand of a plus assignment.
+ */
+static inline double fusedSign(lp::PlusAssignmentStmt *)
+{
+	return 1.0;
+}
+
+/**
+ * @brief Sign of the operand of a minus assignment.
+ */
+static inline double fusedSign(lp::MinusAssignmentStmt *)
+{
+	return -1.0;
+}
+
+/**
+ * @brief Adds or subtracts the operand to the variable, or evaluates the original assignment.
+ */
+template <class Stmt>
+void lp::FusedCompoundStmt<Stmt>::evaluate()
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->getSlot());
+	double value;
+
+	// The original assignment reports the errors
+	if ((var->getType() != NUMBER) or not fusedNumber(this->_operand, value))
+	{
+		Stmt::evaluate();
+		return;
+	}
+
+	lp::Variable *n = var;
+
+	n->setNumber(n->getNumber() + fusedSign((Stmt *) NULL) * value);
+	(*this->_fired)++;
+}
+
+template class lp::FusedCompoundStmt<lp::PlusAssignmentStmt>;
+template class lp::FusedCompoundStmt<lp::MinusAssignmentStmt>;
+
+/**
+ * @brief Prints the value of the variable, or evaluates the original print statement.
+ */
+void lp::FusedPrintStmt::evaluate()
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(this->_slot);
+
+	switch (var->getType())
+	{
+		case NUMBER:
+			std::cout << var->getNumber() << std::endl;
+			break;
+		case BOOL:
+			if (var->getLogical())
+				std::cout << "true" << std::endl;
+			else
+				std::cout << "false" << std::endl;
+			break;
+		case STRING:
+			std::cout << var->getString() << std::endl;
+			break;
+		default:
+			// The original statement reports the error
+			lp::PrintStmt::evaluate();
+			return;
+	}
+
+	(*this->_fired)++;
+}
+
+/**
+ * @brief Comparisons of the fused relational nodes, as in their original nodes.
+ */
+static inline bool fusedCompare(lp::GreaterThanNode *, double a, double b)
+{
+	return a > b;
+}
+
+static inline bool fusedCompare(lp::GreaterOrEqualNode *, double a, double b)
+{
+	return a >= b;
+}
+
+static inline bool fusedCompare(lp::LessThanNode *, double a, double b)
+{
+	return a < b;
+}
+
+static inline bool fusedCompare(lp::LessOrEqualNode *, double a, double b)
+{
+	return a <= b;
+}
+
+static inline bool fusedCompare(lp::EqualNode *, double a, double b)
+{
+	// ERROR_BOUND to control the precision of real numbers
+	return std::abs(a - b) < ERROR_BOUND;
+}
+
+static inline bool fusedCompare(lp::NotEqualNode *, double a, double b)
+{
+	return std::abs(a - b) >= ERROR_BOUND;
+}
+
+/**
+ * @brief Compares the values of the operands, or evaluates the original node.
+ * @return The result of the comparison.
+ */
+template <class Node>
+bool lp::FusedRelationNode<Node>::evaluateBool()
+{
+	double first, second;
+
+	// The original node compares the other types and reports the errors
+	if (not fusedNumber(this->_first, first) or not fusedNumber(this->_second, second))
+		return Node::evaluateBool();
+
+	(*this->_fired)++;
+	return fusedCompare((Node *) NULL, first, second);
+}
+
+template class lp::FusedRelationNode<lp::GreaterThanNode>;
+template class lp::FusedRelationNode<lp::GreaterOrEqualNode>;
+template class lp::FusedRelationNode<lp::LessThanNode>;
+template class lp::FusedRelationNode<lp::LessOrEqualNode>;
+template class lp::FusedRelationNode<lp::EqualNode>;
+template class lp::FusedRelationNode<lp::NotEqualNode>;
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -3080,10 +4404,44 @@ void lp::AST::printAST()
  */
 void lp::AST::evaluate() 
 {
-  std::list<Statement *>::iterator stmtIter;
+  evaluateBody(this->_body);
+}
 
-  for (stmtIter = stmts->begin(); stmtIter != stmts->end(); stmtIter++) 
-  {
-    (*stmtIter)->evaluate();
-  }
-}
\ No newline at end of file
+/**
+ * @brief Infers the types of all the statements of the program before the AST is evaluated.
+ */
+void lp::AST::analyze()
+{
+	analyzeStatements(this->stmts);
+}
+
+/**
+ * @brief Lays out the statements of the program, and the bodies of its statements, in arrays.
+ */
+void lp::AST::freeze()
+{
+	unsigned long bodies = frozenBodies, statements = frozenStatements;
+
+	this->_body = freezeStatements(this->stmts);
+
+	this->_bodies = frozenBodies - bodies;
+	this->_frozen = frozenStatements - statements;
+}
+
+/**
+ * @brief Prints the bytes per statement taken by the lists of statements and by their arrays.
+ * @param out Stream of the report.
+ * @note A list takes its own object and one element, with two links, per statement;
+ *       an array takes a pointer per statement and the final NULL.
+ */
+void lp::AST::reportLayout(std::ostream & out) const
+{
+	unsigned long lists = this->_bodies * sizeof(std::list<lp::Statement *>)
+	                      + this->_frozen * (sizeof(lp::Statement *) + 2 * sizeof(void *));
+	unsigned long arrays = (this->_frozen + this->_bodies) * sizeof(lp::Statement *);
+	double statements = (this->_frozen > 0) ? this->_frozen : 1;
+
+	out << "freeze: " << this->_frozen << " statements in " << this->_bodies << " bodies, "
+	    << lists / statements << " bytes per statement in lists, "
+	    << arrays / statements << " in arrays" << std::endl;
+}
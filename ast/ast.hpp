@@ -10,14 +10,28 @@
 #define _AST_HPP_
 
 // Standard C++ libraries
+#include <cassert>
 #include <iostream>
 #include <stdlib.h>
 #include <string>
 #include <list>
 #include <sstream>
+#include <vector>
+#include <utility>
+
+#include "../includes/globals.hpp"
+#include "../table/table.hpp"
+#include "../table/value.hpp"
+#include "../table/numericVariable.hpp"
+
+#include "arena.hpp"
 
 #define ERROR_BOUND 1.0e-6  //!< Error bound for the comparison of real numbers.
 
+extern lp::Table table; //!< Reference to the Table of Symbols, used to bind the identifiers to their slots
+
+extern lp::Arena *arena; //!< Arena of the program being parsed, NULL to allocate the nodes on the heap
+
 namespace lp
 {
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,6 +53,121 @@ namespace lp
     virtual int getType() = 0;
     int _lineNumber; //!< Line number for error
 
+    int _type;                //!< Cached type of the expression, 0 while it is unknown
+    bool _typeFixed;          //!< The cached type can never change (no variables below)
+    unsigned long _typeEpoch; //!< Value of typeEpoch when the type was cached
+
+	/*!
+		\brief Constructor of ExpNode
+		\post  The type of the new expression is unknown
+		\note  Inline function
+	*/
+	ExpNode(): _lineNumber(0), _type(0), _typeFixed(false), _typeEpoch(0)
+	{
+		// Empty
+	}
+
+	/*!
+		\brief Destructor of ExpNode
+		\note  Run by the arena of the program when it is released, only for the nodes it has adopted
+	*/
+	virtual ~ExpNode()
+	{
+		// Empty
+	}
+
+	/*!
+		\brief   Allocate a node in the arena of the program
+		\param   size: size of the node
+		\return  void *
+	*/
+	static void *operator new(size_t size)
+	{
+		return ExpNode::operator new(size, arena);
+	}
+
+	/*!
+		\brief   Allocate a node in the arena of a context, as the parser does
+		\param   size: size of the node
+		\param   nodes: arena of the program, or NULL to allocate the node on the heap
+		\return  void *
+		\note    The node is never destroyed: a node that owns memory must be adopted by the arena once it is constructed
+	*/
+	static void *operator new(size_t size, lp::Arena *nodes)
+	{
+		if (nodes == NULL)
+			return ::operator new(size);
+
+		return nodes->allocate(size);
+	}
+
+	/*!
+		\brief   The nodes are released with the arena of the program
+		\param   node: node allocated by operator new
+		\return  void
+		\note    A node of the heap is a node that nobody releases: it is asserted
+		         that the node is in the arena, and it is freed if the assertions are off
+	*/
+	static void operator delete(void *node)
+	{
+		assert((arena != NULL) and arena->contains(node));
+
+		if ((arena == NULL) or not arena->contains(node))
+			::operator delete(node);
+	}
+
+	/*!
+		\brief   The nodes are released with the arena of the program, also if their constructors throw
+		\param   node: node allocated by operator new
+		\param   nodes: arena of the program, or NULL if the node is on the heap
+		\return  void
+	*/
+	static void operator delete(void *node, lp::Arena *nodes)
+	{
+		if (nodes == NULL)
+			::operator delete(node);
+	}
+
+	/*!
+		\brief   Infer the type of the expression before it is evaluated
+		\note    Only the types that do not depend on variables are fixed;
+		         the rest are cached by getType during the evaluation
+		\warning Virtual function: could be redefined in the heir classes
+		\return  int: the fixed type or 0 if it depends on the state of the program
+		\sa		 getType
+	*/
+    virtual int inferType()
+	{
+		return 0;
+	}
+
+	/*!
+		\brief   Check if the cached type of the expression is still valid
+		\return  bool
+		\sa		 cacheType, fixType
+	*/
+	inline bool hasCachedType() const
+	{
+		return this->_typeFixed or this->_typeEpoch == typeEpoch;
+	}
+
+	/*!
+		\brief   Cache the type computed by getType until a variable changes its type
+		\param   type: type of the expression
+		\return  int: the same type
+		\note    Erroneous or undefined types are never cached
+		\sa		 hasCachedType, fixType
+	*/
+	int cacheType(int type);
+
+	/*!
+		\brief   Cache a type that can never change
+		\param   type: type of the expression
+		\return  int: the same type
+		\sa		 hasCachedType, cacheType
+	*/
+	int fixType(int type);
+
 
 	/*!	
 		\brief   Print the AST for expression
@@ -82,6 +211,15 @@ namespace lp
 		return "";
 	}
 
+	/*!	
+		\brief   Evaluate the expression as a value tagged with its type
+		\note    The type is checked once; the strings are shared, not copied
+		\warning Virtual function: could be redefined in the heir classes
+		\return  lp::Value: EMPTY if the type of the expression is not valid
+		\sa		 getType, evaluateNumber, evaluateBool, evaluateString
+	*/
+    virtual lp::Value evaluate();
+
 };
 
 
@@ -96,20 +234,20 @@ namespace lp
 class VariableNode : public ExpNode 
 {
 	private:
-	  std::string _id; //!< Name of the VariableNode
+	  int _slot; //!< Slot of the variable in the table of symbols, where its name is interned
 
 	public:
 
 	/*!   
 		\brief Constructor of VariableNode
-		\param value: double
+		\param slot: slot of the variable in the table of symbols, given by the scanner
 		\param lineNumber: int
-		\post  A new NumericVariableNode is created with the name of the parameter
+		\post  A new VariableNode is created with the slot of the parameter
 		\note  Inline function
 	*/
-	  VariableNode(std::string const & value, int lineNumber)
+	  VariableNode(int slot, int lineNumber)
 		{
-			this->_id = value; 
+			this->_slot = slot;
 			this->_lineNumber = lineNumber;
 		}
 
@@ -148,13 +286,29 @@ class VariableNode : public ExpNode
 	*/
 	  std::string evaluateString();
 
+	/*!	
+		\brief   Evaluate the Variable sharing its string, if any
+		\return  lp::Value
+		\sa		   getType, evaluateNumber, evaluateBool, evaluateString
+	*/
+	  lp::Value evaluate();
+
 	/*!	
 		\brief   Get variable id
 		\return  string
 		\sa		   getType, printAST, evaluateNumber
 	*/
-	  std::string getId() {
-        return _id;
+	  const std::string & getId() {
+        return table.getName(this->_slot);
+      }
+
+	/*!	
+		\brief   Get the slot of the variable in the table of symbols
+		\return  int
+		\sa		   getId
+	*/
+	  int getSlot() {
+        return _slot;
       }
 };
 
@@ -169,19 +323,19 @@ class VariableNode : public ExpNode
 class ConstantNode : public ExpNode 
 {
 	private:
-	  std::string _id; //!< Name of the ConstantNode
+	  int _slot; //!< Slot of the constant in the table of symbols
 
 	public:
 
 	/*!		
 		\brief Constructor of ConstantNode
-		\param value: double
+		\param slot: slot of the constant in the table of symbols, given by the scanner
 		\param lineNumber: int
-		\post  A new ConstantNode is created with the name of the parameter
+		\post  A new ConstantNode is created with the slot of the parameter
 	*/
-	  ConstantNode(std::string value, int lineNumber)
+	  ConstantNode(int slot, int lineNumber)
 		{
-			this->_id = value; 
+			this->_slot = slot;
 			this->_lineNumber = lineNumber;
 		}
 
@@ -192,6 +346,13 @@ class ConstantNode : public ExpNode
 	*/
 	 int getType();
 
+	/*!	
+		\brief   Infer the type of the Constant without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 	/*!
 		\brief   Print the AST for Constant
 		\return  void
@@ -212,6 +373,25 @@ class ConstantNode : public ExpNode
 		\sa		   getType, printAST, evaluateNumber, evaluateBool
 	*/
 	  bool evaluateBool();
+
+/*!	
+	\brief   Get the name of the constant
+	\return  std::string: interned in the table of symbols
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the constant in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,6 +434,13 @@ class NumberNode : public ExpNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the Number without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 	/*!
 		\brief   Print the AST for expression
 		\return  void
@@ -267,6 +454,16 @@ class NumberNode : public ExpNode
 		\sa		   getType, printAST
 	*/
 	double evaluateNumber();
+
+/*!	
+	\brief   Get the value of the number
+	\return  double
+*/
+  inline double getNumber() const
+  {
+	return this->_number;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +479,7 @@ class StringNode : public ExpNode
 {
 private:
     std::string _string; //!< \brief Stored string value of this node
+    lp::Value _value;    //!< \brief The same string, shared with the values returned by evaluate
 
 public:
     /*!
@@ -293,6 +491,7 @@ public:
     StringNode(std::string value, int lineNumber)
     {
         this->_string = value;
+        this->_value = lp::Value(value);
         this->_lineNumber = lineNumber;
     }
 
@@ -303,6 +502,13 @@ public:
     */
     int getType();
 
+	/*!	
+		\brief   Infer the type of the String without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
     /*!
         \brief   Prints the string value of this node
         \return  void
@@ -316,8 +522,187 @@ public:
         \sa      getType()
     */
     std::string evaluateString();
+
+    /*!
+        \brief   Evaluates the string without copying it
+        \return  lp::Value sharing the node's string
+        \sa      evaluateString()
+    */
+    lp::Value evaluate();
+
+/*!	
+	\brief   Get the value of the string
+	\return  std::string
+*/
+  inline std::string getString() const
+  {
+	return this->_string;
+  }
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class BoolNode
+  \brief Definition of atributes and methods of BoolNode class
+  \note  BoolNode Class publicly inherits from ExpNode class.
+         It is not written by the parser: the optimizer folds the
+         constant logical expressions into it
+*/
+class BoolNode : public ExpNode 
+{
+ private: 	
+   bool _logic; //!< \brief value of the BoolNode
+ 
+ public:
+
+/*!		
+	\brief Constructor of BoolNode
+	\param value: bool
+	\param lineNumber: int
+	\post  A new BoolNode is created with the value of the parameter
+	\note  Inline function
+*/
+  BoolNode(bool value, int lineNumber)
+	{
+	    this->_logic = value;
+	    this->_lineNumber = lineNumber;
+	}
+
+	/*!	
+	\brief   Get the type of the expression: BOOL
+	\return  int
+	\sa		   printAST, evaluateBool
+	*/
+	int getType();
+
+	/*!	
+		\brief   Infer the type of the Bool without evaluating it
+		\return  int: the fixed type
+		\sa		   getType
+	*/
+	int inferType();
+
+	/*!
+		\brief   Print the AST for expression
+		\return  void
+		\sa		   getType, evaluateBool
+	*/
+	void printAST();
+
+	/*!	
+		\brief   Evaluate the expression
+		\return  bool
+		\sa		   getType, printAST
+	*/
+	bool evaluateBool();
+
+/*!	
+	\brief   Get the value of the bool
+	\return  bool
+*/
+  inline bool getBool() const
+  {
+	return this->_logic;
+  }
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class InvariantNode
+  \brief Definition of atributes and methods of InvariantNode class
+  \note  InvariantNode Class publicly inherits from ExpNode class.
+         The optimizer wraps with it the expressions of the condition of a loop
+         that the body cannot change: the expression is evaluated the first time
+         that it is needed, and its value is kept until the loop starts again
+*/
+class InvariantNode : public ExpNode 
+{
+ private: 	
+   ExpNode *_exp;     //!< \brief Expression that does not change in the loop
+   lp::Value _value;  //!< \brief Value of the expression, EMPTY until it is evaluated
+ 
+ public:
+
+/*!		
+	\brief Constructor of InvariantNode
+	\param exp: pointer to ExpNode
+	\post  A new InvariantNode is created without value
+	\note  Inline function
+*/
+  InvariantNode(ExpNode *exp)
+	{
+	    this->_exp = exp;
+	    this->_lineNumber = exp->_lineNumber;
+	}
+
+	/*!	
+	\brief   Get the type of the expression
+	\return  int
+	\sa		   printAST
+	*/
+	int getType();
+
+	/*!	
+		\brief   Infer the type of the expression without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
+	/*!
+		\brief   Print the AST for expression
+		\return  void
+		\sa		   getType
+	*/
+	void printAST();
+
+	/*!	
+		\brief   Evaluate the expression once
+		\return  lp::Value
+		\sa		   reset
+	*/
+	lp::Value evaluate();
+
+	/*!	
+		\name    Typed evaluations of the kept value
+	*/
+	double evaluateNumber();
+	bool evaluateBool();
+	std::string evaluateString();
+
+/*!	
+	\brief   Forget the value, because the loop starts again
+	\return  void
+*/
+  inline void reset()
+  {
+	this->_value = lp::Value();
+  }
+
+/*!	
+	\brief   Get the expression
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
 };
 
+/*!
+	\brief   Forget the values of the expressions hoisted out of a loop
+	\param   invariants: expressions of the loop, NULL if there are none
+	\return  void
+*/
+void resetInvariants(std::list<InvariantNode *> *invariants);
+
 ///////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -356,6 +741,36 @@ class UnaryOperatorNode : public ExpNode
 	{
 		return this->_exp->getType();
 	}
+
+	/*!	
+		\brief   Infer the type of the child expression without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	inline int inferType()
+	{
+		return this->_exp->inferType();
+	}
+
+/*!	
+	\brief   Get the child expression
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the child expression
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 
@@ -390,6 +805,13 @@ class NumericUnaryOperatorNode : public UnaryOperatorNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the NumericUnaryOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 };
 
 
@@ -424,6 +846,13 @@ class LogicalUnaryOperatorNode : public UnaryOperatorNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the LogicalUnaryOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 };
 
 
@@ -649,22 +1078,61 @@ class OperatorNode : public ExpNode
         this->_lineNumber = lineNumber;
 	}
 
-};
-
 
+/*!	
+	\brief   Get the left expression
+	\return  ExpNode *
+*/
+  inline ExpNode *getLeft() const
+  {
+	return this->_left;
+  }
 
-//////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
+/*!	
+	\brief   Set the left expression
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setLeft(ExpNode *exp)
+  {
+	this->_left = exp;
+  }
 
 /*!	
-  \class   NumericOperatorNode
-  \brief   Definition of atributes and methods of NumericOperatorNode class
-  \note    NumericOperatorNode Class publicly inherits from OperatorNode class
-  \warning Abstract class, because it does not redefine the printAST method of ExpNode
+	\brief   Get the right expression
+	\return  ExpNode *
 */
-class NumericOperatorNode : public OperatorNode 
-{
-	public:
+  inline ExpNode *getRight() const
+  {
+	return this->_right;
+  }
+
+/*!	
+	\brief   Set the right expression
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setRight(ExpNode *exp)
+  {
+	this->_right = exp;
+  }
+
+};
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class   NumericOperatorNode
+  \brief   Definition of atributes and methods of NumericOperatorNode class
+  \note    NumericOperatorNode Class publicly inherits from OperatorNode class
+  \warning Abstract class, because it does not redefine the printAST method of ExpNode
+*/
+class NumericOperatorNode : public OperatorNode 
+{
+	public:
 
 	/*!		
 		\brief Constructor of NumericOperatorNode uses OperatorNode's constructor as members initializer
@@ -682,6 +1150,13 @@ class NumericOperatorNode : public OperatorNode
 	\return  int
 	*/
 	int getType();
+
+	/*!	
+		\brief   Infer the type of the NumericOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
 };
 
 
@@ -714,6 +1189,13 @@ class StringOperatorNode : public OperatorNode
 		\return  int
 	*/
 	int getType();
+
+	/*!	
+		\brief   Infer the type of the StringOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////
@@ -745,6 +1227,13 @@ public:
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the RelationalOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 };
 
 
@@ -777,6 +1266,13 @@ class LogicalOperatorNode : public OperatorNode
 	\return  int
 	*/
 	int getType();
+
+	/*!	
+		\brief   Infer the type of the LogicalOperatorNode without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
 };
 
 
@@ -1009,6 +1505,13 @@ class ConcatenationNode : public StringOperatorNode
 	\sa		   printAST
 */
   std::string evaluateString();
+
+/*!	
+	\brief   Evaluate the ConcatenationNode into a new shared string
+	\return  lp::Value
+	\sa		   evaluateString
+*/
+  lp::Value evaluate();
 };
 
 
@@ -1100,20 +1603,39 @@ class PowerNode : public NumericOperatorNode
 class BuiltinFunctionNode : public ExpNode 
 {
   protected: 
-	std::string _id; //!< Name of the BuiltinFunctionNode
+	int _slot; //!< Slot of the function in the table of symbols
 	
   public:
 /*!		
 	\brief Constructor of BuiltinFunctionNode
-	\param id: string, name of the BuiltinFunction
+	\param slot: slot of the BuiltinFunction in the table of symbols, given by the scanner
 	\post  A new BuiltinFunctionNode is created with the parameter
 */
-  BuiltinFunctionNode(std::string id, int lineNumber)
+  BuiltinFunctionNode(int slot, int lineNumber)
 	{
-		this->_id = id;
+		this->_slot = slot;
 		this->_lineNumber = lineNumber;
 	}
 
+
+/*!	
+	\brief   Get the name of the function
+	\return  std::string: interned in the table of symbols
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the function in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
 };
 
 
@@ -1134,10 +1656,10 @@ class BuiltinFunctionNode_0 : public BuiltinFunctionNode
   public:
 /*!		
 	\brief Constructor of BuiltinFunctionNode_0 uses BuiltinFunctionNode's constructor as member initializer
-	\param id: string, name of the BuiltinFunction
+	\param slot: slot of the BuiltinFunction in the table of symbols
 	\post  A new BuiltinFunctionNode_2 is created with the parameter
 */
-  BuiltinFunctionNode_0(std::string id, int lineNumber): BuiltinFunctionNode(id, lineNumber)
+  BuiltinFunctionNode_0(int slot, int lineNumber): BuiltinFunctionNode(slot, lineNumber)
 	{
 		// 
 	}
@@ -1149,6 +1671,13 @@ class BuiltinFunctionNode_0 : public BuiltinFunctionNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the BuiltinFunctionNode_0 without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 
 
 	/*!
@@ -1186,11 +1715,11 @@ class BuiltinFunctionNode_1: public BuiltinFunctionNode
   public:
 /*!		
 	\brief Constructor of BuiltinFunctionNode_1 uses BuiltinFunctionNode's constructor as member initializer
-	\param id: string, name of the BuiltinFunction
+	\param slot: slot of the BuiltinFunction in the table of symbols
 	\param expression: pointer to ExpNode, argument of the BuiltinFunctionNode_1
 	\post  A new BuiltinFunctionNode_1 is created with the parameters
 */
-  BuiltinFunctionNode_1(std::string id, ExpNode *expression, int lineNumber): BuiltinFunctionNode(id, lineNumber)
+  BuiltinFunctionNode_1(int slot, ExpNode *expression, int lineNumber): BuiltinFunctionNode(slot, lineNumber)
 	{
 		this->_exp = expression;
 	}
@@ -1202,6 +1731,13 @@ class BuiltinFunctionNode_1: public BuiltinFunctionNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the BuiltinFunctionNode_1 without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 	/*!
 		\brief   Print the AST for BuiltinFunctionNode_1
 		\return  void
@@ -1215,6 +1751,26 @@ class BuiltinFunctionNode_1: public BuiltinFunctionNode
 		\sa		   getType, printAST
 	*/
 	  double evaluateNumber();
+
+/*!	
+	\brief   Get the argument of the function
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the argument of the function
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 
@@ -1238,12 +1794,12 @@ class BuiltinFunctionNode_2 : public BuiltinFunctionNode
 	public:
 	/*!		
 		\brief Constructor of BuiltinFunctionNode_2 uses BuiltinFunctionNode's constructor as member initializer
-		\param id: string, name of the BuiltinFunction_2
+		\param slot: slot of the BuiltinFunction_2 in the table of symbols
 		\param expression1: pointer to ExpNode, first argument of the BuiltinFunctionNode
 		\param expression2: pointer to ExpNode, second argument of the BuiltinFunctionNode
 		\post  A new BuiltinFunctionNode_2 is created with the parameters
 	*/
-	  BuiltinFunctionNode_2(std::string id,ExpNode *expression1,ExpNode *expression2, int lineNumber): BuiltinFunctionNode(id, lineNumber)
+	  BuiltinFunctionNode_2(int slot,ExpNode *expression1,ExpNode *expression2, int lineNumber): BuiltinFunctionNode(slot, lineNumber)
 	{
 		this->_exp1 = expression1;
 		this->_exp2 = expression2;
@@ -1256,6 +1812,13 @@ class BuiltinFunctionNode_2 : public BuiltinFunctionNode
 	*/
 	int getType();
 
+	/*!	
+		\brief   Infer the type of the BuiltinFunctionNode_2 without evaluating it
+		\return  int: the fixed type or 0 if it depends on the variables
+		\sa		   getType
+	*/
+	int inferType();
+
 
 
 	/*!
@@ -1271,6 +1834,45 @@ class BuiltinFunctionNode_2 : public BuiltinFunctionNode
 		\sa		   getType, printAST
 	*/
 	  double evaluateNumber();
+
+/*!	
+	\brief   Get the first argument of the function
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp1() const
+  {
+	return this->_exp1;
+  }
+
+/*!	
+	\brief   Set the first argument of the function
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp1(ExpNode *exp)
+  {
+	this->_exp1 = exp;
+  }
+
+/*!	
+	\brief   Get the second argument of the function
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp2() const
+  {
+	return this->_exp2;
+  }
+
+/*!	
+	\brief   Set the second argument of the function
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp2(ExpNode *exp)
+  {
+	this->_exp2 = exp;
+  }
+
 };
 
 
@@ -1659,6 +2261,77 @@ class NotNode : public LogicalUnaryOperatorNode
 class Statement {
  public:
     int _lineNumber; //!< Line number for error
+    unsigned long _iterations; //!< Iterations of a loop run by the AST, counted when there is a tier
+    bool _promoted; //!< The loop is run by the tier instead of the AST
+
+/*!	
+	\brief Constructor of Statement
+	\post  The loops start cold
+*/
+  Statement(): _iterations(0), _promoted(false)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief Destructor of Statement
+	\note  Run by the arena of the program when it is released, only for the statements it has adopted
+*/
+  virtual ~Statement()
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Allocate a statement in the arena of the program
+	\param   size: size of the statement
+	\return  void *
+*/
+  static void *operator new(size_t size)
+  {
+	return Statement::operator new(size, arena);
+  }
+
+/*!	
+	\brief   Allocate a statement in the arena of a context, as the parser does
+	\param   size: size of the statement
+	\param   nodes: arena of the program, or NULL to allocate the statement on the heap
+	\return  void *
+	\note    The statement is never destroyed: a statement that owns memory must be adopted by the arena once it is constructed
+*/
+  static void *operator new(size_t size, lp::Arena *nodes)
+  {
+	if (nodes == NULL)
+		return ::operator new(size);
+
+	return nodes->allocate(size);
+  }
+
+/*!	
+	\brief   The statements are released with the arena of the program
+	\param   stmt: statement allocated by operator new
+	\return  void
+	\note    As the nodes, a statement of the heap is asserted against and freed if the assertions are off
+*/
+  static void operator delete(void *stmt)
+  {
+	assert((arena != NULL) and arena->contains(stmt));
+
+	if ((arena == NULL) or not arena->contains(stmt))
+		::operator delete(stmt);
+  }
+
+/*!	
+	\brief   The statements are released with the arena of the program, also if their constructors throw
+	\param   stmt: statement allocated by operator new
+	\param   nodes: arena of the program, or NULL if the statement is on the heap
+	\return  void
+*/
+  static void operator delete(void *stmt, lp::Arena *nodes)
+  {
+	if (nodes == NULL)
+		::operator delete(stmt);
+  }
 
 /*!	
 	\brief   Print the AST for Statement
@@ -1676,6 +2349,75 @@ class Statement {
 	\sa		   printAST
 */
   virtual void evaluate() = 0;
+
+/*!	
+	\brief   Infer the types of the expressions of the Statement before it is evaluated
+	\note    Virtual function: can be redefined in the heir classes
+	\return  void
+	\sa		   evaluate
+*/
+  virtual void analyze() {}
+
+/*!	
+	\brief   Lay out the bodies of the Statement in contiguous arrays before it is evaluated
+	\note    Virtual function: redefined by the statements with bodies
+	\return  void
+	\sa		   evaluate
+*/
+  virtual void freeze() {}
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+
+/*!	
+  \class   Tier
+  \brief   Faster way of running the loops that the AST has run many times
+  \note    The loops count their iterations and ask the tier to promote them
+		   when the count reaches its threshold. A promoted loop goes on in the
+		   tier from its next iteration and runs there every time it starts again.
+  \warning Abstract class
+*/
+class Tier
+{
+ public:
+
+/*!	
+	\brief Destructor of Tier
+*/
+  virtual ~Tier() {}
+
+/*!	
+	\brief   Iterations run by the AST before a loop is promoted
+	\return  unsigned long
+*/
+  virtual unsigned long getThreshold() const = 0;
+
+/*!	
+	\brief   Prepare the code of a hot loop
+	\param   loop: WhileStmt, DoWhileStmt, RepeatStmt or ForStmt
+	\return  bool: false if the loop has to stay in the AST
+*/
+  virtual bool promote(Statement *loop) = 0;
+
+/*!	
+	\brief   Run a promoted loop from its beginning
+	\param   loop: statement accepted by promote
+	\return  void
+*/
+  virtual void run(Statement *loop) = 0;
+
+/*!	
+	\brief   Go on with a promoted for statement from the test of its next iteration
+	\param   loop: ForStmt accepted by promote
+	\param   loopVar: variable of the loop, already incremented
+	\param   generation: generation of the loop given by Variable::arm
+	\param   step: step of the loop
+	\return  void
+*/
+  virtual void resume(Statement *loop, lp::Variable *loopVar, int generation, double step) = 0;
 };
 
 
@@ -1692,7 +2434,7 @@ class Statement {
 class AssignmentStmt : public Statement 
 {
  private:
-  std::string _id; //!< Name of the variable of the assignment statement
+  int _slot; //!< Slot of the variable in the table of symbols
   ExpNode *_exp; 	 //!< Expresssion the assignment statement
 
   AssignmentStmt *_asgn;  //!< Allow multiple assigment -> a = b = 2 
@@ -1701,11 +2443,11 @@ class AssignmentStmt : public Statement
 
 /*!		
 	\brief Constructor of AssignmentStmt 
-	\param id: string, variable of the AssignmentStmt
+	\param slot: slot of the variable of the AssignmentStmt in the table of symbols
 	\param expression: pointer to ExpNode
 	\post  A new AssignmentStmt is created with the parameters
 */
-  AssignmentStmt(std::string id, ExpNode *expression, int lineNumber): _id(id), _exp(expression)
+  AssignmentStmt(int slot, ExpNode *expression, int lineNumber): _slot(slot), _exp(expression)
 	{
 		this->_asgn = NULL; 
 		this->_lineNumber = lineNumber;
@@ -1713,13 +2455,13 @@ class AssignmentStmt : public Statement
 
 /*!		
 	\brief Constructor of AssignmentStmt 
-	\param id: string, variable of the AssignmentStmt
+	\param slot: slot of the variable of the AssignmentStmt in the table of symbols
 	\param asgn: pointer to AssignmentStmt
 	\post  A new AssignmentStmt is created with the parameters
 	\note  Allow multiple assigment -> a = b = 2 
 */
 
-  AssignmentStmt(std::string id, AssignmentStmt *asgn, int lineNumber): _id(id), _asgn(asgn)
+  AssignmentStmt(int slot, AssignmentStmt *asgn, int lineNumber): _slot(slot), _asgn(asgn)
 	{
 		this->_exp = NULL;
 		this->_lineNumber = lineNumber;
@@ -1740,6 +2482,67 @@ class AssignmentStmt : public Statement
 */
     void evaluate();
 
+/*!	
+	\brief   Infer the types of the expressions of the AssignmentStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+
+/*!	
+	\brief   Get the name of the variable
+	\return  std::string
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the variable in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
+/*!	
+	\brief   Get the expression of the assignment, NULL in a multiple assignment
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression of the assignment, NULL in a multiple assignment
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
+/*!	
+	\brief   Get the previous assignment of a multiple assignment
+	\return  AssignmentStmt *
+*/
+  inline AssignmentStmt *getAssignment() const
+  {
+	return this->_asgn;
+  }
+
+/*!	
+	\brief   Get the expression appended by an assignment "s := s || e"
+	\return  ExpNode *: e, or NULL if the assignment has another form
+	\note    The engines append e to the string of the variable instead of copying it
+*/
+  ExpNode *getAppended() const;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -1755,19 +2558,19 @@ class AssignmentStmt : public Statement
 class PlusAssignmentStmt : public Statement 
 {
  private:
-  std::string _id; 	//!< Name of the variable of the assignment statement
+  int _slot; //!< Slot of the variable in the table of symbols
   ExpNode *_exp; 	//!< Expresssion the assignment statement
 
  public:
 
 /*!		
 	\brief Constructor of Plus3 
-	\param id: string, variable of the PlusAssignmentStmt
+	\param slot: slot of the variable of the PlusAssignmentStmt in the table of symbols
 	\param expression: pointer to ExpNode
 	\post  A new PlusAssignmentStmt is created with the parameters
 	\note  This class is used for the statement "a += b"
 */
-  PlusAssignmentStmt(std::string id, ExpNode *expression, int lineNumber): _id(id), _exp(expression)
+  PlusAssignmentStmt(int slot, ExpNode *expression, int lineNumber): _slot(slot), _exp(expression)
 	{
 		this->_lineNumber = lineNumber;
 	}
@@ -1787,6 +2590,51 @@ class PlusAssignmentStmt : public Statement
 */
     void evaluate();
 
+/*!	
+	\brief   Infer the types of the expressions of the PlusAssignmentStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+
+/*!	
+	\brief   Get the name of the variable
+	\return  std::string
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the variable in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
+/*!	
+	\brief   Get the expression of the assignment
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression of the assignment
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -1802,19 +2650,19 @@ class PlusAssignmentStmt : public Statement
 class MinusAssignmentStmt : public Statement 
 {
  private:
-  std::string _id; 	//!< Name of the variable of the assignment statement
+  int _slot; //!< Slot of the variable in the table of symbols
   ExpNode *_exp; 	//!< Expresssion the assignment statement
 
  public:
 
 /*!		
 	\brief Constructor of MinusAssignmentStmt 
-	\param id: string, variable of the MinusAssignmentStmt
+	\param slot: slot of the variable of the MinusAssignmentStmt in the table of symbols
 	\param expression: pointer to ExpNode
 	\post  A new MinusAssignmentStmt is created with the parameters
 	\note  This class is used for the statement "a += b"
 */
-  MinusAssignmentStmt(std::string id, ExpNode *expression, int lineNumber): _id(id), _exp(expression)
+  MinusAssignmentStmt(int slot, ExpNode *expression, int lineNumber): _slot(slot), _exp(expression)
 	{
 		this->_lineNumber = lineNumber;
 	}
@@ -1834,26 +2682,71 @@ class MinusAssignmentStmt : public Statement
 */
     void evaluate();
 
-};
+/*!	
+	\brief   Infer the types of the expressions of the MinusAssignmentStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
 
 /*!	
-  \class   PrintStmt
-  \brief   Definition of atributes and methods of PrintStmt class
-  \note    PrintStmt Class publicly inherits from Statement class 
-		   and adds its own print and evaluate functions
-  \warning  In this class, printAST and evaluate functions have the same meaning.
+	\brief   Get the name of the variable
+	\return  std::string
 */
-class PrintStmt: public Statement 
-{
- private:
-  ExpNode *_exp; //!< Expresssion the print statement
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
 
- public:
-/*!		
-	\brief Constructor of PrintStmt 
+/*!	
+	\brief   Get the slot of the variable in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
+/*!	
+	\brief   Get the expression of the assignment
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression of the assignment
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class   PrintStmt
+  \brief   Definition of atributes and methods of PrintStmt class
+  \note    PrintStmt Class publicly inherits from Statement class 
+		   and adds its own print and evaluate functions
+  \warning  In this class, printAST and evaluate functions have the same meaning.
+*/
+class PrintStmt: public Statement 
+{
+ private:
+  ExpNode *_exp; //!< Expresssion the print statement
+
+ public:
+/*!		
+	\brief Constructor of PrintStmt 
 	\param expression: pointer to ExpNode
 	\post  A new PrintStmt is created with the parameter
 */
@@ -1876,6 +2769,33 @@ class PrintStmt: public Statement
 	\sa		   printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the PrintStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Get the expression to print
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression to print
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 
@@ -1892,18 +2812,18 @@ class PrintStmt: public Statement
 class ReadStmt : public Statement 
 {
   private:
-	std::string _id; //!< Name of the ReadStmt
+	int _slot; //!< Slot of the variable in the table of symbols
 	
 
   public:
 /*!		
 	\brief Constructor of ReadStmt
-	\param id: string, name of the variable of the ReadStmt
+	\param slot: slot of the variable of the ReadStmt in the table of symbols
 	\post  A new ReadStmt is created with the parameter
 */
-  ReadStmt(std::string id, int lineNumber)
+  ReadStmt(int slot, int lineNumber)
 	{
-		this->_id = id;
+		this->_slot = slot;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -1920,6 +2840,25 @@ class ReadStmt : public Statement
 	\sa		   printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Get the name of the variable
+	\return  std::string
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the variable in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
 };
 
 
@@ -1936,18 +2875,18 @@ class ReadStmt : public Statement
 class ReadStringStmt : public Statement 
 {
   private:
-	std::string _id; //!< Name of the ReadStringStmt
+	int _slot; //!< Slot of the variable in the table of symbols
 	
 
   public:
 /*!		
 	\brief Constructor of ReadStringStmt
-	\param id: string, name of the variable of the ReadStringStmt
+	\param slot: slot of the variable of the ReadStringStmt in the table of symbols
 	\post  A new ReadStringStmt is created with the parameter
 */
-  ReadStringStmt(std::string id, int lineNumber)
+  ReadStringStmt(int slot, int lineNumber)
 	{
-		this->_id = id;
+		this->_slot = slot;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -1964,6 +2903,25 @@ class ReadStringStmt : public Statement
 	\sa		   printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Get the name of the variable
+	\return  std::string
+*/
+  inline const std::string & getId() const
+  {
+	return table.getName(this->_slot);
+  }
+
+/*!	
+	\brief   Get the slot of the variable in the table of symbols
+	\return  int
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
 };
 
 
@@ -2025,6 +2983,8 @@ class IfStmt : public Statement
   ExpNode *_cond;    //!< Condicion of the if statement
   std::list<Statement *> *_stmt1; //!< Statement of the consequent
   std::list<Statement *> *_stmt2; //!< Statement of the alternative
+  Statement **_body1; //!< Array of the consequent, ended by NULL, once frozen
+  Statement **_body2; //!< Array of the alternative, NULL if there is none
 
   public:
 /*!		
@@ -2038,6 +2998,8 @@ class IfStmt : public Statement
 		this->_cond = condition;
 		this->_stmt1 = statement1;
         this->_stmt2 = NULL;
+		this->_body1 = NULL;
+		this->_body2 = NULL;
         this->_lineNumber = lineNumber;
 	}
 
@@ -2054,6 +3016,8 @@ class IfStmt : public Statement
 		this->_cond = condition;
 		this->_stmt1 = statement1;
 		this->_stmt2 = statement2;
+		this->_body1 = NULL;
+		this->_body2 = NULL;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -2071,6 +3035,58 @@ class IfStmt : public Statement
 	\sa	   	 printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the IfStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the consequent and the alternative of the IfStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the condition
+	\return  ExpNode *
+*/
+  inline ExpNode *getCondition() const
+  {
+	return this->_cond;
+  }
+
+/*!	
+	\brief   Set the condition
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setCondition(ExpNode *exp)
+  {
+	this->_cond = exp;
+  }
+
+/*!	
+	\brief   Get the statements of the consequent
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getConsequent() const
+  {
+	return this->_stmt1;
+  }
+
+/*!	
+	\brief   Get the statements of the alternative, NULL if there is none
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getAlternative() const
+  {
+	return this->_stmt2;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2087,6 +3103,8 @@ class WhileStmt : public Statement
  private:
   ExpNode *_cond; //!< Condicion of the while statement
   std::list<Statement *> *_stmt; //!< Statements of the body of the while loop
+  Statement **_body; //!< Array of the statements of the body, ended by NULL, once frozen
+  std::list<InvariantNode *> *_invariants; //!< Expressions of the condition hoisted out of the loop, NULL if none
 
   public:
 /*!		
@@ -2099,6 +3117,8 @@ class WhileStmt : public Statement
 	{
 		this->_cond = condition;
 		this->_stmt = statement;
+		this->_body = NULL;
+		this->_invariants = NULL;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -2116,6 +3136,59 @@ class WhileStmt : public Statement
 	\sa	   	 printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the WhileStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the body of the WhileStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the condition
+	\return  ExpNode *
+*/
+  inline ExpNode *getCondition() const
+  {
+	return this->_cond;
+  }
+
+/*!	
+	\brief   Set the condition
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setCondition(ExpNode *exp)
+  {
+	this->_cond = exp;
+  }
+
+/*!	
+	\brief   Get the statements of the body
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->_stmt;
+  }
+
+/*!	
+	\brief   Set the expressions hoisted out of the loop
+	\param   invariants: list of InvariantNode, NULL if there are none
+	\return  void
+*/
+  inline void setInvariants(std::list<InvariantNode *> *invariants)
+  {
+	this->_invariants = invariants;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2132,6 +3205,8 @@ class DoWhileStmt : public Statement
  private:
   ExpNode *_cond; //!< Condicion of the do while statement
   std::list<Statement *> *_stmt; //!< Statements of the body of the do while loop
+  Statement **_body; //!< Array of the statements of the body, ended by NULL, once frozen
+  std::list<InvariantNode *> *_invariants; //!< Expressions of the condition hoisted out of the loop, NULL if none
 
   public:
 /*!		
@@ -2144,6 +3219,8 @@ class DoWhileStmt : public Statement
 	{
 		this->_cond = condition;
 		this->_stmt = statement;
+		this->_body = NULL;
+		this->_invariants = NULL;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -2161,6 +3238,59 @@ class DoWhileStmt : public Statement
 	\sa	   	 printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the DoWhileStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the body of the DoWhileStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the condition
+	\return  ExpNode *
+*/
+  inline ExpNode *getCondition() const
+  {
+	return this->_cond;
+  }
+
+/*!	
+	\brief   Set the condition
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setCondition(ExpNode *exp)
+  {
+	this->_cond = exp;
+  }
+
+/*!	
+	\brief   Get the statements of the body
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->_stmt;
+  }
+
+/*!	
+	\brief   Set the expressions hoisted out of the loop
+	\param   invariants: list of InvariantNode, NULL if there are none
+	\return  void
+*/
+  inline void setInvariants(std::list<InvariantNode *> *invariants)
+  {
+	this->_invariants = invariants;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2177,6 +3307,8 @@ class RepeatStmt : public Statement
  private:
   ExpNode *_cond; //!< Condicion of the Repeat statement
   std::list<Statement *> *_stmt; //!< Statements of the body of the Repeat loop
+  Statement **_body; //!< Array of the statements of the body, ended by NULL, once frozen
+  std::list<InvariantNode *> *_invariants; //!< Expressions of the condition hoisted out of the loop, NULL if none
 
   public:
 /*!		
@@ -2189,6 +3321,8 @@ class RepeatStmt : public Statement
 	{
 		this->_cond = condition;
 		this->_stmt = statement;
+		this->_body = NULL;
+		this->_invariants = NULL;
 		this->_lineNumber = lineNumber;
 	}
 
@@ -2206,6 +3340,59 @@ class RepeatStmt : public Statement
 	\sa	   	 printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the RepeatStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the body of the RepeatStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the condition
+	\return  ExpNode *
+*/
+  inline ExpNode *getCondition() const
+  {
+	return this->_cond;
+  }
+
+/*!	
+	\brief   Set the condition
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setCondition(ExpNode *exp)
+  {
+	this->_cond = exp;
+  }
+
+/*!	
+	\brief   Get the statements of the body
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->_stmt;
+  }
+
+/*!	
+	\brief   Set the expressions hoisted out of the loop
+	\param   invariants: list of InvariantNode, NULL if there are none
+	\return  void
+*/
+  inline void setInvariants(std::list<InvariantNode *> *invariants)
+  {
+	this->_invariants = invariants;
+  }
+
 };
 
 
@@ -2221,27 +3408,37 @@ class RepeatStmt : public Statement
 class ForStmt : public Statement 
 {
  private:
-  std::string _id;                        //!< Identifier (loop variable) of the For statement
+  int _slot;                           //!< Slot of the variable in the table of symbols
   ExpNode *_from;                         //!< Initial value expression
   ExpNode *_to;                           //!< Final value expression
   ExpNode *_step;                         //!< Step expression
   std::list<Statement *> *_stmt;          //!< Statements in the body of the For loop
+  Statement **_body;                      //!< Array of the statements of the body, ended by NULL, once frozen
+  std::list<InvariantNode *> *_invariants; //!< Expressions of the bound hoisted out of the loop, NULL if none
+  bool _counting;                         //!< The body never writes the loop variable and the step is constant
+  bool _observed;                         //!< The body or the final value read the loop variable
+  bool _written;                          //!< The body writes the loop variable
 
   public:
 /*!		
     \brief Constructor of the ForStmt class without step
-    \param id: Identifier of the loop variable
+    \param slot: Slot of the loop variable in the table of symbols
     \param from: Expression representing the initial value
     \param to: Expression representing the final value
     \param stmt: List of statements inside the loop body
     \post  A new ForStmt is created with the provided parameters
 */
-  ForStmt(const std::string &id, ExpNode *from, ExpNode *to, std::list<Statement *> *stmt, int lineNumber)
+  ForStmt(int slot, ExpNode *from, ExpNode *to, std::list<Statement *> *stmt, int lineNumber)
   {
-    this->_id = id;
+    this->_slot = slot;
     this->_from = from;
     this->_to = to;
     this->_stmt = stmt;
+    this->_body = NULL;
+    this->_invariants = NULL;
+    this->_counting = false;
+    this->_observed = true;
+    this->_written = true;
     this->_step = NULL;
     this->_lineNumber = lineNumber;
   }
@@ -2249,19 +3446,24 @@ class ForStmt : public Statement
   
 /*!		
     \brief Constructor of the ForStmt class with step
-    \param id: Identifier of the loop variable
+    \param slot: Slot of the loop variable in the table of symbols
     \param from: Expression representing the initial value
     \param to: Expression representing the final value
     \param step: Expression representing the increment step
     \param stmt: List of statements inside the loop body
     \post  A new ForStmt is created with the provided parameters
 */
-  ForStmt(const std::string &id, ExpNode *from, ExpNode *to, ExpNode *step, std::list<Statement *> *stmt, int lineNumber)
+  ForStmt(int slot, ExpNode *from, ExpNode *to, ExpNode *step, std::list<Statement *> *stmt, int lineNumber)
   {
-    this->_id = id;
+    this->_slot = slot;
     this->_from = from;
     this->_to = to;
     this->_stmt = stmt;
+    this->_body = NULL;
+    this->_invariants = NULL;
+    this->_counting = false;
+    this->_observed = true;
+    this->_written = true;
     this->_step = step;
   }
 
@@ -2273,62 +3475,223 @@ class ForStmt : public Statement
 */
   void printAST();
 
+/*!	
+	\brief   Check the bounds and the step and give the loop variable its initial value
+	\param   step: receives the step of the loop
+	\param   generation: receives the generation of the loop, given by Variable::arm
+	\return  Variable *: the loop variable, NULL if the initial value is not numeric
+	\note    The engines that run the body themselves start the loop with it, and count
+	         after each iteration on the Variable returned by counter(generation)
+	\sa	   	 evaluate
+*/
+  lp::Variable *begin(double & step, int & generation);
+
 /*!	
 	\brief   Evaluate the RepeatStmt
 	\return  void
 	\sa	   	 printAST
 */
   void evaluate();
-};
-
-///////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////
 
 /*!	
-  \class   CaseStmt
-  \brief   Definition of atributes and methods of CaseStmt class
-  \note    CaseStmt Class publicly inherits from Statement class 
-		       and adds its own printAST and evaluate functions
+	\brief   Infer the types of the expressions of the ForStmt
+	\return  void
+	\post    A loop whose body never writes the loop variable and whose step is constant
+	         is run as a counting loop: the loop variable is kept in a local double
+	         and only stored in the table of symbols when it is read or the loop ends
+	\sa		   evaluate
 */
-class CaseStmt : public Statement 
-{
- private:
-  ExpNode *_exp;
-  std::list<Statement *> *_stmt;
+  void analyze();
 
-  public:
-/*!		
+/*!	
+	\brief   Lay out the statements of the body of the ForStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
 
+/*!	
+	\brief   Get the name of the loop variable
+	\return  std::string
 */
-  CaseStmt(ExpNode * exp, std::list<lp::Statement *> *stmt, int lineNumber)
+  inline const std::string & getId() const
   {
-    this->_exp = exp;
-    this->_stmt = stmt;
-    this->_lineNumber = lineNumber;
+	return table.getName(this->_slot);
   }
 
-
-/*!
-	\brief   Print the AST for RepeatStmt
-	\return  void
-	\sa		   evaluate
+/*!	
+	\brief   Get the slot of the loop variable in the table of symbols
+	\return  int
 */
-  void printAST();
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
 
 /*!	
-	\brief   Evaluate the RepeatStmt
-	\return  void
-	\sa	   	 printAST
+	\brief   Whether the body writes the loop variable
+	\return  bool: true until the ForStmt is analyzed
 */
-  void evaluate();
+  inline bool writesVariable() const
+  {
+	return this->_written;
+  }
+
+/*!	
+	\brief   Get the initial value
+	\return  ExpNode *
+*/
+  inline ExpNode *getFrom() const
+  {
+	return this->_from;
+  }
+
+/*!	
+	\brief   Set the initial value
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setFrom(ExpNode *exp)
+  {
+	this->_from = exp;
+  }
+
+/*!	
+	\brief   Get the final value
+	\return  ExpNode *
+*/
+  inline ExpNode *getTo() const
+  {
+	return this->_to;
+  }
+
+/*!	
+	\brief   Set the final value
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setTo(ExpNode *exp)
+  {
+	this->_to = exp;
+  }
+
+/*!	
+	\brief   Get the step, NULL if there is none
+	\return  ExpNode *
+*/
+  inline ExpNode *getStep() const
+  {
+	return this->_step;
+  }
+
+/*!	
+	\brief   Set the step, NULL if there is none
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setStep(ExpNode *exp)
+  {
+	this->_step = exp;
+  }
+
+/*!	
+	\brief   Get the statements of the body
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->_stmt;
+  }
+
+/*!	
+	\brief   Set the expressions hoisted out of the loop
+	\param   invariants: list of InvariantNode, NULL if there are none
+	\return  void
+*/
+  inline void setInvariants(std::list<InvariantNode *> *invariants)
+  {
+	this->_invariants = invariants;
+  }
+
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class   CaseStmt
+  \brief   Definition of atributes and methods of CaseStmt class
+  \note    CaseStmt Class publicly inherits from Statement class 
+		       and adds its own printAST and evaluate functions
+*/
+class CaseStmt : public Statement 
+{
+ private:
+  ExpNode *_exp;
+  std::list<Statement *> *_stmt;
+  Statement **_body; //!< Array of the statements, ended by NULL, once frozen
+
+  public:
+/*!		
+
+*/
+  CaseStmt(ExpNode * exp, std::list<lp::Statement *> *stmt, int lineNumber)
+  {
+    this->_exp = exp;
+    this->_stmt = stmt;
+    this->_body = NULL;
+    this->_lineNumber = lineNumber;
+  }
+
+
+/*!
+	\brief   Print the AST for RepeatStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void printAST();
+
+/*!	
+	\brief   Evaluate the RepeatStmt
+	\return  void
+	\sa	   	 printAST
+*/
+  void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the CaseStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the CaseStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
 
   ExpNode* getExp() {
     return _exp;
   }
 
+  void setExp(ExpNode *exp) {
+    _exp = exp;
+  }
+
   std::list<Statement *>* getStatements() {
     return _stmt;
   }
+
+/*!	
+	\brief   Get the array of the statements, once frozen
+	\return  Statement **: ended by NULL
+*/
+  inline Statement **getBody() const
+  {
+	return this->_body;
+  }
 };
 
 
@@ -2339,7 +3702,12 @@ class CaseStmt : public Statement
   \class   SwitchStmt
   \brief   Definition of atributes and methods of SwitchStmt class
   \note    SwitchStmt Class publicly inherits from Statement class 
-		       and adds its own printAST and evaluate functions
+		       and adds its own printAST and evaluate functions.
+		   The first time that it is evaluated, the SwitchStmt chooses how to find
+		   its case: a jump table when all the labels are integer literals close
+		   to each other, a sorted table when they are integer literals far apart,
+		   a hash table when they are all string literals, and the evaluation of
+		   the labels in order for any other labels.
 */
 class SwitchStmt : public Statement 
 {
@@ -2347,6 +3715,25 @@ class SwitchStmt : public Statement
   ExpNode *_exp;                 //!< Expression to evaluate for switching
   std::list<lp::CaseStmt *> *_caselist; //!< List of case statements
   std::list<lp::Statement *> *_defaultlist; //!< List of statements for the default case
+  Statement **_defaultBody;      //!< Array of the statements of the default case, NULL if there is none
+
+  /*!
+	\brief Ways of finding the case of the value
+  */
+  enum Dispatch
+  {
+	UNKNOWN,   //!< Not chosen yet
+	LINEAR,    //!< Evaluation of the labels in order
+	DENSE,     //!< Jump table indexed by the value minus the first label
+	SORTED,    //!< Labels in increasing order, searched by bisection
+	STRINGS    //!< Hash table of the string labels
+  };
+
+  Dispatch _dispatch;                                        //!< Way of finding the case
+  double _first;                                             //!< Smallest label of the jump table
+  std::vector<lp::CaseStmt *> _jumps;                        //!< DENSE: case of each value, NULL if none
+  std::vector<std::pair<double, lp::CaseStmt *> > _labels;   //!< SORTED: labels and their cases
+  std::vector<std::pair<std::string, lp::CaseStmt *> > _buckets; //!< STRINGS: open addressing, NULL case if empty
 
  public:
   /**
@@ -2355,10 +3742,12 @@ class SwitchStmt : public Statement
    * @param caselist List of case statements.
    * @param lineNumber Line number for error reporting.
    */
-  SwitchStmt(ExpNode * exp, std::list<lp::CaseStmt *> *caselist, int lineNumber)
+  SwitchStmt(ExpNode * exp, std::list<lp::CaseStmt *> *caselist, int lineNumber): _dispatch(UNKNOWN), _first(0.0)
   {
     this->_exp = exp;
     this->_caselist = caselist;
+    this->_defaultlist = NULL;
+    this->_defaultBody = NULL;
     this->_lineNumber = lineNumber;
   }
 
@@ -2369,12 +3758,14 @@ class SwitchStmt : public Statement
    * @param defaultlist List of statements for the default case.
    * @param lineNumber Line number for error reporting.
    */
-  SwitchStmt(ExpNode * exp, std::list<lp::CaseStmt *> *caselist, std::list<lp::Statement *> *defaultlist, int lineNumber)
+  SwitchStmt(ExpNode * exp, std::list<lp::CaseStmt *> *caselist, std::list<lp::Statement *> *defaultlist, int lineNumber):
+	_dispatch(UNKNOWN), _first(0.0)
   {
     this->_exp = exp;
     this->_caselist = caselist;
     this->_lineNumber = lineNumber;
     this->_defaultlist = defaultlist;
+    this->_defaultBody = NULL;
   }
 
   /**
@@ -2390,6 +3781,86 @@ class SwitchStmt : public Statement
    * @sa printAST
    */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the SwitchStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the cases and the default of the SwitchStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the expression to switch on
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression to switch on
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
+/*!	
+	\brief   Get the list of cases
+	\return  std::list<lp::CaseStmt *> *
+*/
+  inline std::list<lp::CaseStmt *> *getCases() const
+  {
+	return this->_caselist;
+  }
+
+/*!	
+	\brief   Get the statements of the default case, NULL if there is none
+	\return  std::list<lp::Statement *> *
+*/
+  inline std::list<lp::Statement *> *getDefault() const
+  {
+	return this->_defaultlist;
+  }
+
+/*!	
+	\brief   Check if the switch compares strings
+	\return  bool: true if there are cases and all their labels are string literals
+*/
+  bool hasStringLabels() const;
+
+ private:
+
+/*!	
+	\brief   Choose the way of finding the case and build its table
+	\return  void
+*/
+  void prepare();
+
+/*!	
+	\brief   Find the case of a numeric value in the jump table or the sorted table
+	\param   value: value of the expression
+	\return  lp::CaseStmt *: NULL if no label matches
+*/
+  lp::CaseStmt *findNumber(double value) const;
+
+/*!	
+	\brief   Find the case of a string in the hash table
+	\param   value: value of the expression
+	\return  lp::CaseStmt *: NULL if no label matches
+*/
+  lp::CaseStmt *findString(std::string const & value) const;
+
 };
 
 
@@ -2406,7 +3877,6 @@ class UnaryIncrementStmt : public Statement
 {
  private:
 	  ExpNode *_exp;   //!< Expression to increment
-	  int _lineNumber; //!< Line number for error reporting
 
  public:
   /**
@@ -2434,6 +3904,33 @@ class UnaryIncrementStmt : public Statement
    * @sa printAST
    */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the UnaryIncrementStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Get the expression to increment
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression to increment
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2448,7 +3945,6 @@ class UnaryDecrementStmt : public Statement
 {
  private:
 	  ExpNode *_exp;   //!< Expression to decrement
-	  int _lineNumber; //!< Line number for error reporting
 
  public:
   /**
@@ -2476,6 +3972,33 @@ class UnaryDecrementStmt : public Statement
    * @sa printAST
    */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the UnaryDecrementStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Get the expression to decrement
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression to decrement
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2490,7 +4013,6 @@ class UnaryFactorialStmt : public Statement
 {
  private:
 	  ExpNode *_exp;   //!< Expression to apply factorial
-	  int _lineNumber; //!< Line number for error reporting
 
  public:
   /**
@@ -2518,6 +4040,33 @@ class UnaryFactorialStmt : public Statement
    * @sa printAST
    */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the UnaryFactorialStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Get the expression to apply factorial
+	\return  ExpNode *
+*/
+  inline ExpNode *getExp() const
+  {
+	return this->_exp;
+  }
+
+/*!	
+	\brief   Set the expression to apply factorial
+	\param   exp: new expression
+	\return  void
+*/
+  inline void setExp(ExpNode *exp)
+  {
+	this->_exp = exp;
+  }
+
 };
 
 
@@ -2550,9 +4099,29 @@ class RandomNode : public ExpNode
 
     int getType();
 
+    int inferType();
+
     double evaluateNumber();
 
     void printAST();
+
+/*!
+	\brief   Get the lower bound of the random number
+	\return  ExpNode *
+*/
+  inline ExpNode *getMinimum() const
+  {
+	return this->_min;
+  }
+
+/*!
+	\brief   Get the upper bound of the random number
+	\return  ExpNode *
+*/
+  inline ExpNode *getMaximum() const
+  {
+	return this->_max;
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2568,6 +4137,7 @@ class BlockStmt : public Statement
 {
 private:
     std::list<Statement *> *_stmts;  //!< List of statements in the block
+    Statement **_body;               //!< Array of the statements, ended by NULL, once frozen
 public:
     /**
      * @brief Constructor for BlockStmt.
@@ -2575,7 +4145,7 @@ public:
      * @param lineNumber Line number for error reporting.
      * @post A new BlockStmt is created with the provided statements.
      */
-    BlockStmt(std::list<Statement *> *stmtList, int lineNumber): _stmts(stmtList)
+    BlockStmt(std::list<Statement *> *stmtList, int lineNumber): _stmts(stmtList), _body(NULL)
     {
         // Empty
     }
@@ -2591,6 +4161,30 @@ public:
      * @sa printAST
      */
     void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the BlockStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+
+/*!	
+	\brief   Lay out the statements of the BlockStmt in contiguous arrays
+	\return  void
+	\sa		   evaluate
+*/
+  void freeze();
+
+/*!	
+	\brief   Get the statements of the block
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->_stmts;
+  }
+
 };
 
 
@@ -2671,6 +4265,248 @@ inline PlaceStmt(ExpNode * x, ExpNode * y, int lineNumber)
   \sa      printAST
 */
   void evaluate();
+
+/*!	
+	\brief   Infer the types of the expressions of the PlaceStmt
+	\return  void
+	\sa		   evaluate
+*/
+  void analyze();
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!	
+  \class   FusedOperand
+  \brief   Operand of a fused node: a numeric literal or a variable
+  \note    The fusion pass replaces the common shapes of statements with nodes
+		   that read and write the slots of their variables directly. Every
+		   fused node inherits from the node that it replaces, so the rest of
+		   the interpreter sees the original statement, and falls back to it
+		   when a variable is not numeric, which reports the same errors.
+*/
+class FusedOperand
+{
+ private:
+  int _slot;      //!< Slot of the variable in the table of symbols, -1 for a literal
+  double _value;  //!< Value of the literal
+
+ public:
+
+/*!		
+	\brief Constructor of FusedOperand
+	\param slot: slot of the variable, -1 for a literal
+	\param value: value of the literal
+*/
+  FusedOperand(int slot = -1, double value = 0.0): _slot(slot), _value(value)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Get the slot of the variable
+	\return  int: -1 for a literal
+*/
+  inline int getSlot() const
+  {
+	return this->_slot;
+  }
+
+/*!	
+	\brief   Get the value of the literal
+	\return  double
+*/
+  inline double getValue() const
+  {
+	return this->_value;
+  }
+};
+
+
+/*!	
+  \class   FusedAssignmentStmt
+  \brief   Assignment "x := x + y", "x := y + x" or "x := x - y" of a numeric variable
+  \note    The operand y is a numeric literal or a variable
+*/
+class FusedAssignmentStmt : public AssignmentStmt
+{
+ private:
+  FusedOperand _operand;    //!< Operand added to or subtracted from the variable
+  double _sign;             //!< 1 to add the operand, -1 to subtract it
+  unsigned long *_fired;    //!< Counter of the form, incremented by the fused evaluations
+
+ public:
+
+/*!		
+	\brief Constructor of FusedAssignmentStmt
+	\param slot: slot of the variable of the assignment
+	\param expression: expression of the original assignment
+	\param operand: literal or variable of the expression that is not the variable
+	\param sign: 1 for an addition, -1 for a subtraction
+	\param fired: counter of the form
+	\param lineNumber: line of the assignment
+*/
+  FusedAssignmentStmt(int slot, ExpNode *expression, FusedOperand operand, double sign,
+                      unsigned long *fired, int lineNumber):
+	AssignmentStmt(slot, expression, lineNumber), _operand(operand), _sign(sign), _fired(fired)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Update the variable in its slot, or evaluate the original assignment
+	\return  void
+*/
+  void evaluate();
+};
+
+
+/*!	
+  \class   FusedCompoundStmt
+  \brief   Plus or minus assignment "x +:= y" or "x -:= y" of a numeric variable
+  \note    Stmt is PlusAssignmentStmt or MinusAssignmentStmt; the operand y is
+		   a numeric literal or a variable
+*/
+template <class Stmt>
+class FusedCompoundStmt : public Stmt
+{
+ private:
+  FusedOperand _operand;    //!< Operand added to or subtracted from the variable
+  unsigned long *_fired;    //!< Counter of the form, incremented by the fused evaluations
+
+ public:
+
+/*!		
+	\brief Constructor of FusedCompoundStmt
+	\param slot: slot of the variable of the assignment
+	\param expression: expression of the original assignment
+	\param operand: literal or variable of the expression
+	\param fired: counter of the form
+	\param lineNumber: line of the assignment
+*/
+  FusedCompoundStmt(int slot, ExpNode *expression, FusedOperand operand,
+                    unsigned long *fired, int lineNumber):
+	Stmt(slot, expression, lineNumber), _operand(operand), _fired(fired)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Update the variable in its slot, or evaluate the original assignment
+	\return  void
+*/
+  void evaluate();
+};
+
+
+/*!	
+  \class   FusedAppendStmt
+  \brief   Assignment "s := s || e" of a string variable
+  \note    The characters of e are appended to the string of the variable, in place
+		   when no other value shares it, instead of copying the whole string
+*/
+class FusedAppendStmt : public AssignmentStmt
+{
+ private:
+  ExpNode *_tail;           //!< Expression e, the right operand of the concatenation
+  unsigned long *_fired;    //!< Counter of the form, incremented by the fused evaluations
+
+ public:
+
+/*!		
+	\brief Constructor of FusedAppendStmt
+	\param slot: slot of the variable of the assignment
+	\param expression: concatenation of the original assignment
+	\param tail: right operand of the concatenation
+	\param fired: counter of the form
+	\param lineNumber: line of the assignment
+*/
+  FusedAppendStmt(int slot, ExpNode *expression, ExpNode *tail, unsigned long *fired, int lineNumber):
+	AssignmentStmt(slot, expression, lineNumber), _tail(tail), _fired(fired)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Append to the string of the variable, or evaluate the original assignment
+	\return  void
+*/
+  void evaluate();
+};
+
+
+/*!	
+  \class   FusedPrintStmt
+  \brief   Print statement of a variable, "print x"
+*/
+class FusedPrintStmt : public PrintStmt
+{
+ private:
+  int _slot;                //!< Slot of the variable in the table of symbols
+  unsigned long *_fired;    //!< Counter of the form, incremented by the fused evaluations
+
+ public:
+
+/*!		
+	\brief Constructor of FusedPrintStmt
+	\param expression: VariableNode of the original print statement
+	\param slot: slot of the variable
+	\param fired: counter of the form
+	\param lineNumber: line of the print statement
+*/
+  FusedPrintStmt(ExpNode *expression, int slot, unsigned long *fired, int lineNumber):
+	PrintStmt(expression, lineNumber), _slot(slot), _fired(fired)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Print the value of the variable, or evaluate the original print statement
+	\return  void
+*/
+  void evaluate();
+};
+
+
+/*!	
+  \class   FusedRelationNode
+  \brief   Comparison of two numeric operands, as in "i < n", in the condition of a statement
+  \note    Node is one of the relational operator nodes; its operands are
+		   numeric literals or variables, and at least one of them is a variable
+*/
+template <class Node>
+class FusedRelationNode : public Node
+{
+ private:
+  FusedOperand _first;      //!< Left operand
+  FusedOperand _second;     //!< Right operand
+  unsigned long *_fired;    //!< Counter of the form, incremented by the fused evaluations
+
+ public:
+
+/*!		
+	\brief Constructor of FusedRelationNode
+	\param L: left expression of the original node
+	\param R: right expression of the original node
+	\param first: literal or variable of L
+	\param second: literal or variable of R
+	\param fired: counter of the form
+	\param lineNumber: line of the comparison
+*/
+  FusedRelationNode(ExpNode *L, ExpNode *R, FusedOperand first, FusedOperand second,
+                    unsigned long *fired, int lineNumber):
+	Node(L, R, lineNumber), _first(first), _second(second), _fired(fired)
+  {
+	// Empty
+  }
+
+/*!	
+	\brief   Compare the values of the slots, or evaluate the original node
+	\return  bool
+*/
+  bool evaluateBool();
 };
 
 
@@ -2684,16 +4520,45 @@ inline PlaceStmt(ExpNode * x, ExpNode * y, int lineNumber)
 class AST {
 private:
     std::list<Statement *> *stmts;  //!< List of statements in the AST
+    Arena *_arena;                  //!< Arena of the nodes of the program, NULL if they are on the heap
+    Statement **_body;              //!< Array of the statements of the program, ended by NULL, once frozen
+    unsigned long _bodies;          //!< Number of lists of statements laid out in arrays by freeze
+    unsigned long _frozen;          //!< Number of statements in those arrays
+
+    // Copying an AST would release its arena twice
+    AST(AST const &);
+    AST & operator=(AST const &);
+
 public:
     /**
      * @brief Constructor for AST.
      * @param stmtList Pointer to a list of Statement pointers.
-     * @post A new AST is created with the provided list of statements.
+     * @param nodes Arena where the nodes of the program were allocated, or NULL.
+     * @post A new AST is created with the provided list of statements, and owns the arena.
      */
-    AST(std::list<Statement *> *stmtList): stmts(stmtList)
+    AST(std::list<Statement *> *stmtList, Arena *nodes = NULL): stmts(stmtList), _arena(nodes), _body(NULL),
+                                                             _bodies(0), _frozen(0)
     {
         // Empty
     }
+
+    /**
+     * @brief Destructor for AST.
+     * @post All the nodes of the program are released at once with their arena.
+     */
+    ~AST()
+    {
+        delete this->_arena;
+    }
+
+/*!	
+	\brief   Get the arena of the nodes of the program
+	\return  Arena *: NULL if they are on the heap
+*/
+  inline Arena *getArena() const
+  {
+	return this->_arena;
+  }
     /**
      * @brief Prints the AST by traversing and printing all statements.
      * @return void
@@ -2706,10 +4571,42 @@ public:
      * @sa printAST
      */
     void evaluate();
+    /**
+     * @brief Infers the types of the expressions of all statements before they are evaluated.
+     * @return void
+     * @sa evaluate
+     */
+    void analyze();
+    /**
+     * @brief Lays out every list of statements of the program in a contiguous array, in the arena.
+     * @return void
+     * @note The AST is evaluated through the arrays, which must be frozen after the last
+     *       rewrite of the lists. The lists are kept for the compilers and printAST.
+     * @sa evaluate
+     */
+    void freeze();
+    /**
+     * @brief Prints the memory taken by the lists of statements and by their arrays.
+     * @param out Stream of the report.
+     * @return void
+     */
+    void reportLayout(std::ostream & out) const;
+
+/*!	
+	\brief   Get the statements of the program
+	\return  std::list<Statement *> *
+*/
+  inline std::list<Statement *> *getStatements() const
+  {
+	return this->stmts;
+  }
+
 };
 
 // End of name space lp
 }
 
+extern lp::Tier *tier; //!< Tier of the hot loops, NULL if the AST runs all of them
+
 // End of _AST_HPP_
 #endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#!/bin/bash
+# Microbenchmark of the dispatch of the virtual machines.
+#
+# The body of a counting loop is a run of cheap statements, so the time
+# per executed instruction is mostly the cost of going from an instruction
+# to the next one. Build the interpreter with "make DISPATCH=goto" and
+# "make DISPATCH=switch" (after "make clean") to compare both dispatches.
+#
+# Usage: dispatch.sh [interpreter] [engines]
+
+INTERPRETER=${1:-../interpreter.exe}
+shift
+ENGINES=${@:-vm register}
+ITERATIONS=${ITERATIONS:-200000}
+STATEMENTS=${STATEMENTS:-32}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Loop whose body repeats x := x + 1
+BODY=""
+for ((k = 1; k <= STATEMENTS; k++))
+do
+	BODY="$BODY  x := x + 1;
+"
+done
+
+cat > "$TMP/dispatch.p" <<END
+x := 0;
+for i from 1 to $ITERATIONS do
+$BODY
+end_for;
+print x;
+END
+
+printf "%10s %16s %12s %12s\n" "engine" "instr/iteration" "time (ms)" "ns/instr"
+
+for ENGINE in $ENGINES
+do
+	# Instructions of one iteration: from the test of the loop to FOR_NEXT
+	INSTRUCTIONS=$("$INTERPRETER" --engine=$ENGINE --disassemble "$TMP/dispatch.p" \
+		| awk '/FOR_STEP/ { inside = 1; next } inside { n++ } /FOR_NEXT/ { print n; exit }')
+
+	START=$(date +%s%N)
+	"$INTERPRETER" --engine=$ENGINE "$TMP/dispatch.p" > /dev/null || exit 1
+	END=$(date +%s%N)
+
+	ELAPSED=$((END - START))
+	printf "%10s %16d %12d %12s\n" $ENGINE $INSTRUCTIONS $((ELAPSED / 1000000)) \
+		$(awk "BEGIN { printf \"%.2f\", $ELAPSED / ($ITERATIONS * $INSTRUCTIONS) }")
+done
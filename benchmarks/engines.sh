@@ -0,0 +1,85 @@
+#!/bin/bash
+# Benchmark of the execution engines on numeric programs.
+#
+# Every program is run by each engine and the elapsed times are compared
+# with the ones of the abstract syntax tree. The programs are the kind of
+# numeric loops of examples/binario.p and examples/conversion.p.
+#
+# Usage: engines.sh [interpreter] [engines]
+
+INTERPRETER=${1:-../interpreter.exe}
+shift
+ENGINES=${@:-ast closure vm register}
+SCALE=${SCALE:-1000000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Arithmetic: a := b * c + d and friends in a counting loop
+cat > "$TMP/arithmetic.p" <<END
+b := 3; c := 4; d := 5; a := 0;
+for i from 1 to $((SCALE * 5)) do
+  a := b * c + d;
+  b := a - c * d;
+  c := c + 1 - 1;
+end_for;
+print a;
+END
+
+# Conversion of numbers to binary digits, as examples/binario.p
+cat > "$TMP/binary.p" <<END
+ones := 0;
+for n from 1 to $SCALE do
+  m := n;
+  while (m > 0) do
+    ones := ones + m mod 2;
+    m := m // 2;
+  end_while;
+end_for;
+print ones;
+END
+
+# Nested loops with comparisons and a polynomial
+cat > "$TMP/polynomial.p" <<END
+s := 0;
+for x from 1 to $((SCALE / 100)) do
+  for y from 1 to 100 do
+    p := 2 * x * x - 3 * y + 7;
+    if (p > 100) then
+      s := s + 1;
+    else
+      s := s - 1;
+    end_if;
+  end_for;
+end_for;
+print s;
+END
+
+printf "%12s" "program"
+for ENGINE in $ENGINES
+do
+	printf "%15s" "$ENGINE (ms)"
+done
+printf "%12s\n" "speedup"
+
+for PROGRAM in arithmetic binary polynomial
+do
+	printf "%12s" $PROGRAM
+	FIRST=""
+	LAST=""
+
+	for ENGINE in $ENGINES
+	do
+		START=$(date +%s%N)
+		"$INTERPRETER" --engine=$ENGINE "$TMP/$PROGRAM.p" > /dev/null || exit 1
+		END=$(date +%s%N)
+
+		ELAPSED=$(((END - START) / 1000000))
+		printf "%15d" $ELAPSED
+
+		FIRST=${FIRST:-$ELAPSED}
+		LAST=$ELAPSED
+	done
+
+	# Speedup of the last engine over the first one
+	printf "%11sx\n" $(awk "BEGIN { printf \"%.2f\", $FIRST / ($LAST > 0 ? $LAST : 1) }")
+done
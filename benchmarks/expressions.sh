@@ -0,0 +1,51 @@
+#!/bin/bash
+# Benchmark of the evaluation of long expressions.
+#
+# Each program evaluates a left-deep sum of N variables inside a loop,
+# keeping the total number of evaluated nodes constant, so the time per
+# node must stay flat when the type of every node is computed only once.
+#
+# Usage: expressions.sh [interpreter] [interpreter options]
+
+INTERPRETER=${1:-../interpreter.exe}
+shift
+NODES=${NODES:-524288}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+printf "%8s %10s %12s %12s\n" "vars" "iterations" "time (ms)" "ns/node"
+
+for N in 8 16 32 64 128 256
+do
+	PROGRAM=$TMP/sum$N.p
+	ITERATIONS=$((NODES / N))
+
+	# Variables of the expression
+	: > "$PROGRAM"
+	for ((v = 1; v <= N; v++))
+	do
+		echo "v$v := $v;" >> "$PROGRAM"
+	done
+
+	# Left-deep sum: ((v1 + v2) + v3) + ...
+	EXPRESSION="v1"
+	for ((v = 2; v <= N; v++))
+	do
+		EXPRESSION="$EXPRESSION + v$v"
+	done
+
+	cat >> "$PROGRAM" <<END
+i := 0;
+while (i < $ITERATIONS) do
+  s := $EXPRESSION;
+  i := i + 1;
+end_while
+END
+
+	START=$(date +%s%N)
+	"$INTERPRETER" "$@" "$PROGRAM" > /dev/null || exit 1
+	END=$(date +%s%N)
+
+	ELAPSED=$((END - START))
+	printf "%8d %10d %12d %12d\n" $N $ITERATIONS $((ELAPSED / 1000000)) $((ELAPSED / (ITERATIONS * (2 * N - 1))))
+done
@@ -0,0 +1,93 @@
+#!/bin/bash
+# Benchmark of the machine code of the numeric loops.
+#
+# Every program is run by the register machine alone and with its loops
+# translated to machine code (--engine=jit). The programs are loops such as
+# the one of examples/binario.p, with the input replaced by constants.
+# The last column is the number of loops that run as machine code.
+#
+# Usage: jit.sh [interpreter]
+
+INTERPRETER=${1:-../interpreter.exe}
+SCALE=${SCALE:-1000000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Number of ones of the binary digits, as examples/binario.p
+cat > "$TMP/binary.p" <<END
+ones := 0;
+for n from 1 to $SCALE do
+  m := n;
+  while (m > 0) do
+    ones := ones + m mod 2;
+    m := m // 2;
+  end_while;
+end_for;
+print ones;
+END
+
+# Primes by trial division
+cat > "$TMP/primes.p" <<END
+count := 0;
+for n from 2 to $((SCALE / 10)) do
+  d := 2;
+  prime := 1;
+  while (d * d <= n and prime = 1) do
+    if (n mod d = 0) then
+      prime := 0;
+    end_if;
+    d := d + 1;
+  end_while;
+  count := count + prime;
+end_for;
+print count;
+END
+
+# Square roots by the method of Newton, with divisions and a builtin
+cat > "$TMP/newton.p" <<END
+error := 0;
+for n from 1 to $((SCALE / 5)) do
+  x := n;
+  repeat
+    x := (x + n / x) / 2;
+  until (abs(x * x - n) < 0.001)
+  error := error + abs(x - sqrt(n));
+end_for;
+print error;
+END
+
+# Factorials computed again and again
+cat > "$TMP/factorial.p" <<END
+total := 0;
+for n from 1 to $SCALE do
+  f := 1;
+  for k from 1 to n mod 15 + 1 do
+    f := f * k;
+  end_for;
+  total := total + f / 1000000;
+end_for;
+print total;
+END
+
+printf "%12s%17s%12s%12s%8s\n" "program" "register (ms)" "jit (ms)" "speedup" "loops"
+
+for PROGRAM in binary primes newton factorial
+do
+	printf "%12s" $PROGRAM
+	TIMES=""
+
+	for ENGINE in register jit
+	do
+		START=$(date +%s%N)
+		"$INTERPRETER" --engine=$ENGINE "$TMP/$PROGRAM.p" > /dev/null || exit 1
+		END=$(date +%s%N)
+
+		ELAPSED=$(((END - START) / 1000000))
+		TIMES="$TIMES $ELAPSED"
+	done
+
+	set -- $TIMES
+	LOOPS=$("$INTERPRETER" --engine=jit --disassemble "$TMP/$PROGRAM.p" | sed -n 's/^jit: \([0-9]*\) loops.*/\1/p')
+
+	printf "%17d%12d%11sx%8s\n" $1 $2 $(awk "BEGIN { printf \"%.2f\", $1 / ($2 > 0 ? $2 : 1) }") "$LOOPS"
+done
@@ -0,0 +1,42 @@
+#!/bin/bash
+# Benchmark of the scanner.
+#
+# A synthetic program of LINES lines (one million by default), full of
+# keywords, constants, builtins and variables, is scanned by every interpreter
+# given with --tokens, which prints the number of tokens without parsing them.
+#
+# Usage: lexer.sh [interpreter ...]
+
+LINES=${LINES:-1000000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]
+then
+	set -- ../interpreter.exe
+fi
+
+# Blocks of five lines with as many keywords and builtins as variables
+awk -v lines=$LINES 'BEGIN {
+	for (n = 1; n + 5 <= lines; n += 5)
+	{
+		print "while (not (limite >= " n ") and true) do"
+		print "  if (sqrt(x" n % 97 ") < pi * deg) then Valor := abs(x" n % 97 " mod 7); end_if;"
+		print "  for i from 1 to Total step 2 do print(integer(i) // e); end_for;"
+		print "  repeat read(Entrada); until (Entrada <> false or phi > gamma);"
+		print "end_while;"
+	}
+}' > "$TMP/lexer.p"
+
+printf "%-32s%12s%12s%16s\n" "interpreter" "time (ms)" "tokens" "tokens/s"
+
+for INTERPRETER in "$@"
+do
+	START=$(date +%s%N)
+	TOKENS=$("$INTERPRETER" --tokens "$TMP/lexer.p") || exit 1
+	END=$(date +%s%N)
+
+	ELAPSED=$(((END - START) / 1000000))
+
+	printf "%-32s%12d%12d%16d\n" "$INTERPRETER" $ELAPSED $TOKENS $((TOKENS * 1000 / (ELAPSED > 0 ? ELAPSED : 1)))
+done
@@ -0,0 +1,51 @@
+#!/bin/bash
+# Benchmark of the parser and of the construction of the AST.
+#
+# A synthetic program of LINES lines (one million by default) is parsed by
+# every interpreter given. Its statements are in loops whose conditions are
+# false, and the optimizer is disabled, so almost all the time is spent
+# scanning, parsing, allocating the nodes and releasing them.
+#
+# Usage: parse.sh [interpreter ...]
+
+LINES=${LINES:-1000000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]
+then
+	set -- ../interpreter.exe
+fi
+
+# Blocks of ten lines with assignments, expressions, conditions and calls
+awk -v lines=$LINES 'BEGIN {
+	print "limite := 0;"
+	for (n = 1; n + 10 <= lines; n += 10)
+	{
+		print "while (limite > 1) do"
+		print "  a" n % 97 " := (limite + " n ") * 2 - limite / 3;"
+		print "  b := a" n % 97 " mod 7 + abs(limite - " n ");"
+		print "  if (b >= 3 and not (a" n % 97 " = 0)) then"
+		print "    nombre := \x27texto " n "\x27 || \x27.\x27;"
+		print "  else"
+		print "    b +:= sqrt(limite) ^ 2;"
+		print "  end_if;"
+		print "  print(b);"
+		print "end_while;"
+	}
+}' > "$TMP/parse.p"
+
+PROGRAM_LINES=$(wc -l < "$TMP/parse.p")
+
+printf "%-32s%12s%16s\n" "interpreter" "time (ms)" "lines/s"
+
+for INTERPRETER in "$@"
+do
+	START=$(date +%s%N)
+	"$INTERPRETER" -O0 "$TMP/parse.p" > /dev/null || exit 1
+	END=$(date +%s%N)
+
+	ELAPSED=$(((END - START) / 1000000))
+
+	printf "%-32s%12d%16d\n" "$INTERPRETER" $ELAPSED $((PROGRAM_LINES * 1000 / (ELAPSED > 0 ? ELAPSED : 1)))
+done
@@ -0,0 +1,74 @@
+#!/bin/bash
+# Benchmark of the variables that change their type.
+#
+# The program assigns a number, a string and a logical value to the same
+# variable ITERATIONS times (two million by default), in every engine of each
+# interpreter given. The resident memory of the interpreter is sampled while
+# it runs: it must stay flat, since the variable is retyped in place.
+#
+# Usage: soak.sh [interpreter ...]
+
+ITERATIONS=${ITERATIONS:-2000000}
+ENGINES=${ENGINES:-"ast closure vm register"}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]
+then
+	set -- ../interpreter.exe
+fi
+
+cat > "$TMP/soak.p" <<END
+i := 0;
+x := 0;
+while (i < $ITERATIONS) do
+  x := i;
+  x := 'texto';
+  x := x || ' largo';
+  x := true;
+  i := i + 1;
+end_while;
+print(x);
+END
+
+# Resident memory, in KB, of a running process
+rss()
+{
+	awk '/^VmRSS:/ { print $2 }' /proc/$1/status 2>/dev/null
+}
+
+printf "%-32s%10s%12s%14s%14s\n" "interpreter" "engine" "time (ms)" "first (KB)" "peak (KB)"
+
+for INTERPRETER in "$@"
+do
+	for ENGINE in $ENGINES
+	do
+		START=$(date +%s%N)
+		"$INTERPRETER" --engine=$ENGINE "$TMP/soak.p" > /dev/null &
+		PID=$!
+		FIRST=""
+		PEAK=0
+
+		while kill -0 $PID 2> /dev/null
+		do
+			KB=$(rss $PID)
+
+			if [ -n "$KB" ]
+			then
+				FIRST=${FIRST:-$KB}
+
+				if [ $KB -gt $PEAK ]
+				then
+					PEAK=$KB
+				fi
+			fi
+
+			sleep 0.05
+		done
+
+		wait $PID || exit 1
+		END=$(date +%s%N)
+
+		printf "%-32s%10s%12d%14s%14d\n" "$INTERPRETER" $ENGINE $(((END - START) / 1000000)) "${FIRST:--}" $PEAK
+	done
+done
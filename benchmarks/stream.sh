@@ -0,0 +1,50 @@
+#!/bin/bash
+# Benchmark of the time to the first output of a long program.
+#
+# A synthetic program of LINES lines (one million by default) prints a line
+# at its beginning and another one at its end; the rest are loops whose
+# conditions are false. Every interpreter given runs it as usual, parsing the
+# whole file first, and with --stream, running each statement as soon as it
+# is parsed. The time to the first line printed and the total time are shown.
+#
+# Usage: stream.sh [interpreter ...]
+
+LINES=${LINES:-1000000}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+if [ $# -eq 0 ]
+then
+	set -- ../interpreter.exe
+fi
+
+# Blocks of five lines between the two prints
+awk -v lines=$LINES 'BEGIN {
+	print "limite := 0;"
+	print "print(\x27primera\x27);"
+	for (n = 1; n + 5 <= lines; n += 5)
+	{
+		print "while (limite > 1) do"
+		print "  a" n % 97 " := (limite + " n ") * 2 - limite / 3;"
+		print "  if (a" n % 97 " >= 3) then b := sqrt(limite) ^ 2; end_if;"
+		print "  print(b);"
+		print "end_while;"
+	}
+	print "print(\x27ultima\x27);"
+}' > "$TMP/stream.p"
+
+printf "%-32s%-12s%16s%12s\n" "interpreter" "mode" "first (ms)" "total (ms)"
+
+for INTERPRETER in "$@"
+do
+	for MODE in "" --stream
+	do
+		START=$(date +%s%N)
+		"$INTERPRETER" $MODE "$TMP/stream.p" | { read -r LINE; date +%s%N > "$TMP/first"; cat > /dev/null; }
+		END=$(date +%s%N)
+
+		FIRST=$(cat "$TMP/first")
+
+		printf "%-32s%-12s%16d%12d\n" "$INTERPRETER" "${MODE:-parse}" $(((FIRST - START) / 1000000)) $(((END - START) / 1000000))
+	done
+done
@@ -0,0 +1,76 @@
+#!/bin/bash
+# Benchmark of a string built by repeated concatenation.
+#
+# The program appends a piece of 100 characters to a string, "s := s || piece",
+# until it has SIZE megabytes (10 by default), and prints it. Every engine and
+# --stream append in place; the abstract syntax tree at -O0 copies the whole
+# string in every assignment, so its time grows with the square of the size
+# and it is only run up to COPY_LIMIT megabytes.
+#
+# Usage: strings.sh [interpreter] [engines]
+
+INTERPRETER=${1:-../interpreter.exe}
+shift
+ENGINES=${@:-ast vm register jit tiered closure}
+SIZE=${SIZE:-10}
+COPY_LIMIT=${COPY_LIMIT:-1}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+PIECE=$(printf '%0100d' 0)
+
+# Each column is a set of options of the interpreter
+COLUMNS="-O0"
+for ENGINE in $ENGINES
+do
+	COLUMNS="$COLUMNS --engine=$ENGINE"
+done
+COLUMNS="$COLUMNS --stream"
+
+printf "%10s" "size (MB)"
+for COLUMN in $COLUMNS
+do
+	printf "%15s" "${COLUMN#--engine=} (ms)"
+done
+echo
+
+for MB in 1 2 5 $SIZE
+do
+	if [ $MB -gt $SIZE ]
+	then
+		continue
+	fi
+
+	cat > "$TMP/strings.p" <<END
+s := '';
+for i from 1 to $((MB * 10000)) do
+  s := s || '$PIECE';
+end_for;
+print(s);
+END
+
+	printf "%10d" $MB
+
+	for COLUMN in $COLUMNS
+	do
+		if [ $COLUMN = -O0 ] && [ $MB -gt $COPY_LIMIT ]
+		then
+			printf "%15s" "-"
+			continue
+		fi
+
+		START=$(date +%s%N)
+		"$INTERPRETER" $COLUMN "$TMP/strings.p" > /dev/null || exit 1
+		END=$(date +%s%N)
+
+		printf "%15d" $(((END - START) / 1000000))
+	done
+
+	echo
+
+	# The sizes are increasing
+	if [ $MB -eq $SIZE ]
+	then
+		break
+	fi
+done
@@ -0,0 +1,153 @@
+/*!
+	\file    closure.hpp
+	\brief   Declaration of the closures that run a program compiled from the AST
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _CLOSURE_HPP_
+#define _CLOSURE_HPP_
+
+#include "../table/value.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class   NumberClosure
+  \brief   Function object that computes a numeric expression
+  \warning Abstract class
+*/
+class NumberClosure
+{
+	public:
+
+	/*!
+		\brief Type of the result
+	*/
+		typedef double Result;
+
+	/*!
+		\brief Destructor
+		\post  The closures of the operands are released
+	*/
+		virtual ~NumberClosure()
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compute the value of the expression
+		\warning Pure virtual function: must be redefined in the heir classes
+		\return  double
+	*/
+		virtual double operator()() = 0;
+};
+
+
+/*!
+  \class   BoolClosure
+  \brief   Function object that computes a logical expression
+  \warning Abstract class
+*/
+class BoolClosure
+{
+	public:
+
+	/*!
+		\brief Type of the result
+	*/
+		typedef bool Result;
+
+	/*!
+		\brief Destructor
+		\post  The closures of the operands are released
+	*/
+		virtual ~BoolClosure()
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compute the value of the expression
+		\warning Pure virtual function: must be redefined in the heir classes
+		\return  bool
+	*/
+		virtual bool operator()() = 0;
+};
+
+
+/*!
+  \class   StringClosure
+  \brief   Function object that computes a string expression
+  \note    The strings are shared, as in the values of the AST
+  \warning Abstract class
+*/
+class StringClosure
+{
+	public:
+
+	/*!
+		\brief Type of the result
+	*/
+		typedef lp::Value Result;
+
+	/*!
+		\brief Destructor
+		\post  The closures of the operands are released
+	*/
+		virtual ~StringClosure()
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compute the value of the expression
+		\warning Pure virtual function: must be redefined in the heir classes
+		\return  lp::Value: a STRING
+	*/
+		virtual lp::Value operator()() = 0;
+};
+
+
+/*!
+  \class   Action
+  \brief   Function object that runs a statement
+  \warning Abstract class
+*/
+class Action
+{
+	public:
+
+	/*!
+		\brief Type of the result
+	*/
+		typedef void Result;
+
+	/*!
+		\brief Destructor
+		\post  The closures of the statement are released
+	*/
+		virtual ~Action()
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Run the statement
+		\warning Pure virtual function: must be redefined in the heir classes
+		\return  void
+	*/
+		virtual void operator()() = 0;
+};
+
+// End of name space lp
+}
+
+// End of _CLOSURE_HPP_
+#endif
@@ -0,0 +1,1409 @@
+/*!
+	\file    closureCompiler.cpp
+	\brief   Code of the closures and of the functions of the ClosureCompiler class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <vector>
+#include <cmath>
+
+#include "closureCompiler.hpp"
+
+#include "../table/table.hpp"
+#include "../table/variable.hpp"
+#include "../table/numericConstant.hpp"
+#include "../table/logicalConstant.hpp"
+#include "../table/builtinParameter0.hpp"
+#include "../table/builtinParameter1.hpp"
+#include "../table/builtinParameter2.hpp"
+
+#include "../includes/globals.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief Specializations of a site before it is left to the AST for good
+*/
+static const int MAX_SPECIALIZATIONS = 8;
+
+/*!
+  \brief Number of specializations of the sites of every program
+*/
+static unsigned long specializations = 0;
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \struct Capture
+  \brief  Symbols read while a site is specialized
+*/
+struct Capture
+{
+	std::vector<int> slots;                //!< Slots of the variables
+	std::vector<lp::Symbol *> symbols;     //!< Symbols bound to the slots, NULL if none
+	std::vector<int> types;                //!< Types of the symbols
+	bool generic;                          //!< The site is left to the AST
+
+	Capture(bool g): generic(g)
+	{
+		// Empty
+	}
+};
+
+
+/*!
+  \brief  Type of the symbol of a slot
+  \return NUMBER, BOOL, STRING or 0 if it has no value
+*/
+static int typeOfSlot(int slot)
+{
+	lp::Symbol *symbol = table.getSymbol(slot);
+
+	if (symbol == NULL)
+		return 0;
+
+	int type = ((lp::Variable *) symbol)->getType();
+
+	return ((type == NUMBER) or (type == BOOL) or (type == STRING)) ? type : 0;
+}
+
+
+/*!
+  \brief  Read a variable: its symbol is captured by the site
+  \return Type of the variable, 0 if it has no value
+*/
+static int capture(Capture & capture, int slot)
+{
+	int type = typeOfSlot(slot);
+
+	for (size_t i = 0; i < capture.slots.size(); i++)
+		if (capture.slots[i] == slot)
+			return type;
+
+	capture.slots.push_back(slot);
+	capture.symbols.push_back(table.getSymbol(slot));
+	capture.types.push_back(type);
+
+	return type;
+}
+
+
+/*!
+  \brief  Type of an expression with the current types of its variables
+  \note   The same rules as getType, without reporting any error
+  \return NUMBER, BOOL, STRING or 0 if the type is not valid
+*/
+static int typeOf(lp::ExpNode *node, Capture & c)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+		return capture(c, var->getSlot());
+
+	if (dynamic_cast<lp::ConstantNode *>(node))
+		return node->getType();
+
+	if (dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::RandomNode *>(node)
+		or dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+		return NUMBER;
+
+	if (dynamic_cast<lp::StringNode *>(node))
+		return STRING;
+
+	if (dynamic_cast<lp::BoolNode *>(node))
+		return BOOL;
+
+	if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+		return (typeOf(unary->getExp(), c) == NUMBER) ? NUMBER : 0;
+
+	if (lp::LogicalUnaryOperatorNode *unary = dynamic_cast<lp::LogicalUnaryOperatorNode *>(node))
+		return (typeOf(unary->getExp(), c) == BOOL) ? BOOL : 0;
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return (typeOf(f->getExp(), c) == NUMBER) ? NUMBER : 0;
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		int left = typeOf(f->getExp1(), c);
+		int right = typeOf(f->getExp2(), c);
+
+		return ((left == NUMBER) and (right == NUMBER)) ? NUMBER : 0;
+	}
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+	{
+		int left = typeOf(binary->getLeft(), c);
+		int right = typeOf(binary->getRight(), c);
+
+		if ((left == 0) or (left != right))
+			return 0;
+
+		if (dynamic_cast<lp::NumericOperatorNode *>(node))
+			return (left == NUMBER) ? NUMBER : 0;
+
+		if (dynamic_cast<lp::StringOperatorNode *>(node))
+			return (left == STRING) ? STRING : 0;
+
+		if (dynamic_cast<lp::LogicalOperatorNode *>(node))
+			return (left == BOOL) ? BOOL : 0;
+
+		if (dynamic_cast<lp::RelationalOperatorNode *>(node))
+			return BOOL;
+	}
+
+	// Unknown nodes are evaluated by the AST
+	return 0;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+// The closures are only known by the compiler
+namespace {
+
+/*!
+  \class AstNumber
+  \brief Numeric expression evaluated by the AST
+*/
+class AstNumber: public lp::NumberClosure
+{
+	lp::ExpNode *_node;
+
+	public:
+		AstNumber(lp::ExpNode *node): _node(node) {}
+		double operator()() { return this->_node->evaluateNumber(); }
+};
+
+/*!
+  \class Literal
+  \brief Numeric value known when the site is specialized
+*/
+class Literal: public lp::NumberClosure
+{
+	double _value;
+
+	public:
+		Literal(double value): _value(value) {}
+		double operator()() { return this->_value; }
+};
+
+/*!
+  \class NumberVariable
+  \brief Value of a numeric variable, read through its symbol
+*/
+class NumberVariable: public lp::NumberClosure
+{
+	lp::Variable *_var;
+
+	public:
+		NumberVariable(lp::Variable *var): _var(var) {}
+		double operator()() { return this->_var->getNumber(); }
+};
+
+/*!
+  \class Offset
+  \brief Unary minus, increment and decrement: sign * x + offset
+*/
+class Offset: public lp::NumberClosure
+{
+	lp::NumberClosure *_exp;
+	double _sign;
+	double _offset;
+
+	public:
+		Offset(lp::NumberClosure *exp, double sign, double offset): _exp(exp), _sign(sign), _offset(offset) {}
+		~Offset() { delete this->_exp; }
+		double operator()() { return this->_sign * (*this->_exp)() + this->_offset; }
+};
+
+/*!
+  \class Factorial
+  \brief Factorial of a non-negative integer; the AST reports the other values
+*/
+class Factorial: public lp::NumberClosure
+{
+	lp::ExpNode *_node;
+	lp::NumberClosure *_exp;
+
+	public:
+		Factorial(lp::ExpNode *node, lp::NumberClosure *exp): _node(node), _exp(exp) {}
+		~Factorial() { delete this->_exp; }
+
+		double operator()()
+		{
+			double value = (*this->_exp)();
+
+			if ((value < 0) or (floor(value) != value))
+				return this->_node->evaluateNumber();
+
+			double result = 1.0;
+
+			for (int i = 1; i <= (int) value; ++i)
+				result *= i;
+
+			return result;
+		}
+};
+
+/*!
+  \class Binary
+  \brief Numeric operator that cannot report an error
+*/
+template <class Operation>
+class Binary: public lp::NumberClosure
+{
+	lp::NumberClosure *_left;
+	lp::NumberClosure *_right;
+
+	public:
+		Binary(lp::NumberClosure *left, lp::NumberClosure *right): _left(left), _right(right) {}
+		~Binary() { delete this->_left; delete this->_right; }
+
+		double operator()()
+		{
+			double left = (*this->_left)();
+
+			return Operation::apply(left, (*this->_right)());
+		}
+};
+
+struct Add      { static double apply(double a, double b) { return a + b; } };
+struct Subtract { static double apply(double a, double b) { return a - b; } };
+struct Multiply { static double apply(double a, double b) { return a * b; } };
+
+/*!
+  \class Power
+  \brief Power: the exponent is computed first, as the AST passes both operands to pow
+*/
+class Power: public lp::NumberClosure
+{
+	lp::NumberClosure *_left;
+	lp::NumberClosure *_right;
+
+	public:
+		Power(lp::NumberClosure *left, lp::NumberClosure *right): _left(left), _right(right) {}
+		~Power() { delete this->_left; delete this->_right; }
+
+		double operator()()
+		{
+			double right = (*this->_right)();
+
+			return pow((*this->_left)(), right);
+		}
+};
+
+/*!
+  \class Division
+  \brief Division, integer division and modulo; the AST reports the zero divisors
+*/
+template <class Operation>
+class Division: public lp::NumberClosure
+{
+	lp::ExpNode *_node;
+	lp::NumberClosure *_left;
+	lp::NumberClosure *_right;
+
+	public:
+		Division(lp::ExpNode *node, lp::NumberClosure *left, lp::NumberClosure *right): _node(node), _left(left), _right(right) {}
+		~Division() { delete this->_left; delete this->_right; }
+
+		double operator()()
+		{
+			double left = (*this->_left)();
+			double right = (*this->_right)();
+			double result;
+
+			if (Operation::apply(left, right, result))
+				return result;
+
+			return this->_node->evaluateNumber();
+		}
+};
+
+struct Divide
+{
+	static bool apply(double a, double b, double & result)
+	{
+		if (std::abs(b) <= ERROR_BOUND)
+			return false;
+
+		result = a / b;
+		return true;
+	}
+};
+
+struct IntegerDivide
+{
+	static bool apply(double a, double b, double & result)
+	{
+		if ((std::abs(b) <= ERROR_BOUND) or (static_cast<int>(b) == 0))
+			return false;
+
+		result = static_cast<double>(static_cast<int>(a) / static_cast<int>(b));
+		return true;
+	}
+};
+
+struct Modulo
+{
+	static bool apply(double a, double b, double & result)
+	{
+		if (std::abs(b) <= ERROR_BOUND)
+			return false;
+
+		result = (int) a % (int) b;
+		return true;
+	}
+};
+
+/*!
+  \class Call0
+  \brief Builtin without parameters, bound to its C function
+*/
+class Call0: public lp::NumberClosure
+{
+	lp::TypePointerDoubleFunction_0 _function;
+
+	public:
+		Call0(lp::TypePointerDoubleFunction_0 function): _function(function) {}
+		double operator()() { return this->_function(); }
+};
+
+/*!
+  \class Call1
+  \brief Builtin with one parameter, bound to its C function
+*/
+class Call1: public lp::NumberClosure
+{
+	lp::TypePointerDoubleFunction_1 _function;
+	lp::NumberClosure *_exp;
+
+	public:
+		Call1(lp::TypePointerDoubleFunction_1 function, lp::NumberClosure *exp): _function(function), _exp(exp) {}
+		~Call1() { delete this->_exp; }
+		double operator()() { return this->_function((*this->_exp)()); }
+};
+
+/*!
+  \class Call2
+  \brief Builtin with two parameters, bound to its C function
+  \note  The second parameter is computed first, as in the AST
+*/
+class Call2: public lp::NumberClosure
+{
+	lp::TypePointerDoubleFunction_2 _function;
+	lp::NumberClosure *_exp1;
+	lp::NumberClosure *_exp2;
+
+	public:
+		Call2(lp::TypePointerDoubleFunction_2 function, lp::NumberClosure *exp1, lp::NumberClosure *exp2):
+			_function(function), _exp1(exp1), _exp2(exp2) {}
+		~Call2() { delete this->_exp1; delete this->_exp2; }
+
+		double operator()()
+		{
+			double y = (*this->_exp2)();
+
+			return this->_function((*this->_exp1)(), y);
+		}
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \class AstBool
+  \brief Logical expression evaluated by the AST
+*/
+class AstBool: public lp::BoolClosure
+{
+	lp::ExpNode *_node;
+
+	public:
+		AstBool(lp::ExpNode *node): _node(node) {}
+		bool operator()() { return this->_node->evaluateBool(); }
+};
+
+/*!
+  \class BoolLiteral
+  \brief Logical value known when the site is specialized
+*/
+class BoolLiteral: public lp::BoolClosure
+{
+	bool _value;
+
+	public:
+		BoolLiteral(bool value): _value(value) {}
+		bool operator()() { return this->_value; }
+};
+
+/*!
+  \class BoolVariable
+  \brief Value of a logical variable, read through its symbol
+*/
+class BoolVariable: public lp::BoolClosure
+{
+	lp::Variable *_var;
+
+	public:
+		BoolVariable(lp::Variable *var): _var(var) {}
+		bool operator()() { return this->_var->getLogical(); }
+};
+
+/*!
+  \class Relation
+  \brief Relational operator between two operands of the same type
+*/
+template <class Operand, class Compare>
+class Relation: public lp::BoolClosure
+{
+	Operand *_left;
+	Operand *_right;
+
+	public:
+		Relation(Operand *left, Operand *right): _left(left), _right(right) {}
+		~Relation() { delete this->_left; delete this->_right; }
+
+		bool operator()()
+		{
+			typename Operand::Result left = (*this->_left)();
+
+			return Compare::apply(left, (*this->_right)());
+		}
+};
+
+/*!
+  \brief Comparisons of the relational operators; the numbers are equal within ERROR_BOUND
+*/
+struct Greater      { template <class T> static bool apply(T const & a, T const & b) { return a > b; } };
+struct GreaterEqual { template <class T> static bool apply(T const & a, T const & b) { return a >= b; } };
+struct Less         { template <class T> static bool apply(T const & a, T const & b) { return a < b; } };
+struct LessEqual    { template <class T> static bool apply(T const & a, T const & b) { return a <= b; } };
+
+struct Equal
+{
+	template <class T> static bool apply(T const & a, T const & b) { return a == b; }
+	static bool apply(double const & a, double const & b) { return std::abs(a - b) < ERROR_BOUND; }
+};
+
+struct NotEqual
+{
+	template <class T> static bool apply(T const & a, T const & b) { return a != b; }
+	static bool apply(double const & a, double const & b) { return std::abs(a - b) >= ERROR_BOUND; }
+};
+
+/*!
+  \brief The strings are compared by their characters
+*/
+template <class Compare>
+struct Text
+{
+	static bool apply(lp::Value const & a, lp::Value const & b) { return Compare::apply(a.getString(), b.getString()); }
+};
+
+/*!
+  \class Logical
+  \brief and, or: both operands are evaluated, as in the AST
+*/
+template <bool And>
+class Logical: public lp::BoolClosure
+{
+	lp::BoolClosure *_left;
+	lp::BoolClosure *_right;
+
+	public:
+		Logical(lp::BoolClosure *left, lp::BoolClosure *right): _left(left), _right(right) {}
+		~Logical() { delete this->_left; delete this->_right; }
+
+		bool operator()()
+		{
+			bool left = (*this->_left)();
+			bool right = (*this->_right)();
+
+			return And ? (left and right) : (left or right);
+		}
+};
+
+/*!
+  \class Not
+  \brief Logical negation
+*/
+class Not: public lp::BoolClosure
+{
+	lp::BoolClosure *_exp;
+
+	public:
+		Not(lp::BoolClosure *exp): _exp(exp) {}
+		~Not() { delete this->_exp; }
+		bool operator()() { return not (*this->_exp)(); }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \class AstString
+  \brief String expression evaluated by the AST
+*/
+class AstString: public lp::StringClosure
+{
+	lp::ExpNode *_node;
+
+	public:
+		AstString(lp::ExpNode *node): _node(node) {}
+		lp::Value operator()() { return lp::Value(this->_node->evaluateString()); }
+};
+
+/*!
+  \class StringLiteral
+  \brief String known when the site is specialized, shared by its values
+*/
+class StringLiteral: public lp::StringClosure
+{
+	lp::Value _value;
+
+	public:
+		StringLiteral(std::string const & value): _value(value) {}
+		lp::Value operator()() { return this->_value; }
+};
+
+/*!
+  \class StringVariable
+  \brief Value of a string variable, shared with its symbol
+*/
+class StringVariable: public lp::StringClosure
+{
+	lp::Variable *_var;
+
+	public:
+		StringVariable(lp::Variable *var): _var(var) {}
+		lp::Value operator()() { return this->_var->getSharedString(); }
+};
+
+/*!
+  \class Concatenate
+  \brief Concatenation of two strings
+*/
+class Concatenate: public lp::StringClosure
+{
+	lp::StringClosure *_left;
+	lp::StringClosure *_right;
+
+	public:
+		Concatenate(lp::StringClosure *left, lp::StringClosure *right): _left(left), _right(right) {}
+		~Concatenate() { delete this->_left; delete this->_right; }
+
+		lp::Value operator()()
+		{
+			lp::Value left = (*this->_left)();
+			lp::Value right = (*this->_right)();
+			std::string result;
+
+			result.reserve(left.getString().size() + right.getString().size());
+			result.append(left.getString());
+			result.append(right.getString());
+
+			return lp::Value(result);
+		}
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \class AstAction
+  \brief Statement evaluated by the AST
+*/
+class AstAction: public lp::Action
+{
+	lp::Statement *_stmt;
+
+	public:
+		AstAction(lp::Statement *stmt): _stmt(stmt) {}
+		void operator()() { this->_stmt->evaluate(); }
+};
+
+/*!
+  \class AssignNumber
+  \brief Assignment of a numeric expression to a numeric variable
+*/
+class AssignNumber: public lp::Action
+{
+	lp::Variable *_var;
+	lp::NumberClosure *_exp;
+
+	public:
+		AssignNumber(lp::Variable *var, lp::NumberClosure *exp): _var(var), _exp(exp) {}
+		~AssignNumber() { delete this->_exp; }
+		void operator()() { this->_var->setNumber((*this->_exp)()); }
+};
+
+/*!
+  \class AssignBool
+  \brief Assignment of a logical expression to a logical variable
+*/
+class AssignBool: public lp::Action
+{
+	lp::Variable *_var;
+	lp::BoolClosure *_exp;
+
+	public:
+		AssignBool(lp::Variable *var, lp::BoolClosure *exp): _var(var), _exp(exp) {}
+		~AssignBool() { delete this->_exp; }
+		void operator()() { this->_var->setLogical((*this->_exp)()); }
+};
+
+/*!
+  \class AssignString
+  \brief Assignment of a string expression to a string variable, which shares it
+*/
+class AssignString: public lp::Action
+{
+	lp::Variable *_var;
+	lp::StringClosure *_exp;
+
+	public:
+		AssignString(lp::Variable *var, lp::StringClosure *exp): _var(var), _exp(exp) {}
+		~AssignString() { delete this->_exp; }
+		void operator()() { this->_var->setString((*this->_exp)()); }
+};
+
+/*!
+  \class Append
+  \brief s := s || e: the string of the variable grows in place
+*/
+class Append: public lp::Action
+{
+	lp::Variable *_var;
+	lp::StringClosure *_exp;
+
+	public:
+		Append(lp::Variable *var, lp::StringClosure *exp): _var(var), _exp(exp) {}
+		~Append() { delete this->_exp; }
+		void operator()() { this->_var->append((*this->_exp)().getString()); }
+};
+
+/*!
+  \class Accumulate
+  \brief +:=, -:=, ++ and --: the variable adds sign * expression
+*/
+class Accumulate: public lp::Action
+{
+	lp::Variable *_var;
+	lp::NumberClosure *_exp;
+	double _sign;
+
+	public:
+		Accumulate(lp::Variable *var, lp::NumberClosure *exp, double sign): _var(var), _exp(exp), _sign(sign) {}
+		~Accumulate() { delete this->_exp; }
+
+		void operator()()
+		{
+			double value = (*this->_exp)();
+
+			this->_var->setNumber(this->_var->getNumber() + this->_sign * value);
+		}
+};
+
+/*!
+  \class PrintNumber
+  \brief print of a numeric expression
+*/
+class PrintNumber: public lp::Action
+{
+	lp::NumberClosure *_exp;
+
+	public:
+		PrintNumber(lp::NumberClosure *exp): _exp(exp) {}
+		~PrintNumber() { delete this->_exp; }
+		void operator()() { std::cout << (*this->_exp)() << std::endl; }
+};
+
+/*!
+  \class PrintBool
+  \brief print of a logical expression
+*/
+class PrintBool: public lp::Action
+{
+	lp::BoolClosure *_exp;
+
+	public:
+		PrintBool(lp::BoolClosure *exp): _exp(exp) {}
+		~PrintBool() { delete this->_exp; }
+		void operator()() { std::cout << ((*this->_exp)() ? "true" : "false") << std::endl; }
+};
+
+/*!
+  \class PrintString
+  \brief print of a string expression
+*/
+class PrintString: public lp::Action
+{
+	lp::StringClosure *_exp;
+
+	public:
+		PrintString(lp::StringClosure *exp): _exp(exp) {}
+		~PrintString() { delete this->_exp; }
+		void operator()() { std::cout << (*this->_exp)().getString() << std::endl; }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \class Sequence
+  \brief Statements run in order
+*/
+class Sequence: public lp::Action
+{
+	std::vector<lp::Action *> _actions;
+
+	public:
+		Sequence(std::vector<lp::Action *> const & actions): _actions(actions) {}
+
+		~Sequence()
+		{
+			for (size_t i = 0; i < this->_actions.size(); i++)
+				delete this->_actions[i];
+		}
+
+		void operator()()
+		{
+			for (std::vector<lp::Action *>::iterator it = this->_actions.begin(); it != this->_actions.end(); ++it)
+				(**it)();
+		}
+};
+
+/*!
+  \class If
+  \brief if statement, with an optional alternative
+*/
+class If: public lp::Action
+{
+	lp::BoolClosure *_cond;
+	lp::Action *_consequent;
+	lp::Action *_alternative;
+
+	public:
+		If(lp::BoolClosure *cond, lp::Action *consequent, lp::Action *alternative):
+			_cond(cond), _consequent(consequent), _alternative(alternative) {}
+		~If() { delete this->_cond; delete this->_consequent; delete this->_alternative; }
+
+		void operator()()
+		{
+			if ((*this->_cond)())
+				(*this->_consequent)();
+			else if (this->_alternative != NULL)
+				(*this->_alternative)();
+		}
+};
+
+/*!
+  \class While
+  \brief while statement
+*/
+class While: public lp::Action
+{
+	lp::BoolClosure *_cond;
+	lp::Action *_body;
+
+	public:
+		While(lp::BoolClosure *cond, lp::Action *body): _cond(cond), _body(body) {}
+		~While() { delete this->_cond; delete this->_body; }
+
+		void operator()()
+		{
+			while ((*this->_cond)())
+				(*this->_body)();
+		}
+};
+
+/*!
+  \class Loop
+  \brief do-while (Until false) and repeat (Until true): the body runs first
+*/
+template <bool Until>
+class Loop: public lp::Action
+{
+	lp::Action *_body;
+	lp::BoolClosure *_cond;
+
+	public:
+		Loop(lp::Action *body, lp::BoolClosure *cond): _body(body), _cond(cond) {}
+		~Loop() { delete this->_body; delete this->_cond; }
+
+		void operator()()
+		{
+			do
+				(*this->_body)();
+			while ((*this->_cond)() != Until);
+		}
+};
+
+/*!
+  \class For
+  \brief for statement: the ForStmt checks its bounds and step, the body runs here
+*/
+class For: public lp::Action
+{
+	lp::ForStmt *_stmt;
+	lp::NumberClosure *_to;
+	lp::Action *_body;
+
+	public:
+		For(lp::ForStmt *stmt, lp::NumberClosure *to, lp::Action *body): _stmt(stmt), _to(to), _body(body) {}
+		~For() { delete this->_to; delete this->_body; }
+
+		void operator()()
+		{
+			double step;
+			int generation;
+			lp::Variable *loopVar = this->_stmt->begin(step, generation);
+
+			if (loopVar == NULL)
+				return;
+
+			for (; loopVar->getNumber() <= (*this->_to)(); loopVar->setNumber(loopVar->getNumber() + step))
+			{
+				(*this->_body)();
+
+				// The body may have detached the loop from its variable
+				loopVar = loopVar->counter(generation);
+			}
+
+			loopVar->disarm();
+		}
+};
+
+/*!
+  \class Switch
+  \brief switch statement: the labels are evaluated until one matches
+*/
+class Switch: public lp::Action
+{
+	lp::NumberClosure *_exp;
+	std::vector<lp::NumberClosure *> _labels;
+	std::vector<lp::Action *> _cases;
+	lp::Action *_default;
+
+	public:
+		Switch(lp::NumberClosure *exp, std::vector<lp::NumberClosure *> const & labels,
+		       std::vector<lp::Action *> const & cases, lp::Action *byDefault):
+			_exp(exp), _labels(labels), _cases(cases), _default(byDefault) {}
+
+		~Switch()
+		{
+			delete this->_exp;
+			delete this->_default;
+
+			for (size_t i = 0; i < this->_labels.size(); i++)
+			{
+				delete this->_labels[i];
+				delete this->_cases[i];
+			}
+		}
+
+		void operator()()
+		{
+			double value = (*this->_exp)();
+
+			for (size_t i = 0; i < this->_labels.size(); i++)
+				if (fabs(value - (*this->_labels[i])()) < ERROR_BOUND)
+				{
+					(*this->_cases[i])();
+					return;
+				}
+
+			if (this->_default != NULL)
+				(*this->_default)();
+		}
+};
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \class Site
+  \brief Expression or statement specialized for the types of its variables
+  \note  The closures are kept while typeEpoch does not change or, when it
+         changes, while every slot that was read is bound to the same symbol
+         with the same type. A site specialized too many times is left to
+         the AST.
+*/
+template <class Closure, class Node>
+class Site: public Closure
+{
+	public:
+		typedef Closure *(*Specializer)(Node *node, Capture & capture);
+
+	private:
+		Node *_node;                          //!< Expression or statement of the AST
+		Specializer _specializer;             //!< Builder of the closures of the node
+		Closure *_code;                       //!< Closures for the current types, NULL before the first run
+		unsigned long _epoch;                 //!< Value of typeEpoch when the closures were checked
+		std::vector<int> _slots;              //!< Slots read by the closures
+		std::vector<lp::Symbol *> _symbols;   //!< Symbols captured by the closures
+		std::vector<int> _types;              //!< Types of the symbols
+		int _specializations;                 //!< Times that the node has been specialized
+
+		// A site owns its closures
+		Site(Site const &);
+		Site & operator=(Site const &);
+
+	/*!
+		\brief   Check the captured symbols and specialize the node again if one has changed
+		\return  void
+	*/
+		void check()
+		{
+			bool same = (this->_code != NULL);
+
+			for (size_t i = 0; same and (i < this->_slots.size()); i++)
+				same = (table.getSymbol(this->_slots[i]) == this->_symbols[i])
+				       and (typeOfSlot(this->_slots[i]) == this->_types[i]);
+
+			if (not same)
+			{
+				Capture c(this->_specializations >= MAX_SPECIALIZATIONS);
+
+				delete this->_code;
+				this->_code = this->_specializer(this->_node, c);
+
+				this->_slots = c.slots;
+				this->_symbols = c.symbols;
+				this->_types = c.types;
+				this->_specializations++;
+				specializations++;
+			}
+
+			this->_epoch = typeEpoch;
+		}
+
+	public:
+		Site(Node *node, Specializer specializer):
+			_node(node), _specializer(specializer), _code(NULL), _epoch(0), _specializations(0)
+		{
+			// Empty
+		}
+
+		~Site()
+		{
+			delete this->_code;
+		}
+
+		typename Closure::Result operator()()
+		{
+			if (this->_epoch != typeEpoch)
+				this->check();
+
+			return (*this->_code)();
+		}
+};
+
+// End of the closures
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+static lp::NumberClosure *number(lp::ExpNode *node, Capture & c);
+static lp::BoolClosure *boolean(lp::ExpNode *node, Capture & c);
+static lp::StringClosure *string(lp::ExpNode *node, Capture & c);
+
+
+/*!
+  \brief  Closures of a numeric expression
+  \pre    typeOf(node) is NUMBER
+*/
+static lp::NumberClosure *number(lp::ExpNode *node, Capture & c)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		capture(c, var->getSlot());
+		return new NumberVariable((lp::Variable *) table.getSymbol(var->getSlot()));
+	}
+
+	if (lp::ConstantNode *constant = dynamic_cast<lp::ConstantNode *>(node))
+		return new Literal(((lp::NumericConstant *) table.getSymbol(constant->getSlot()))->getValue());
+
+	if (lp::NumberNode *literal = dynamic_cast<lp::NumberNode *>(node))
+		return new Literal(literal->getNumber());
+
+	if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+	{
+		if (dynamic_cast<lp::UnaryMinusNode *>(node))
+			return new Offset(number(unary->getExp(), c), -1.0, 0.0);
+
+		if (dynamic_cast<lp::UnaryPlusNode *>(node))
+			return number(unary->getExp(), c);
+
+		if (dynamic_cast<lp::UnaryIncrementNode *>(node))
+			return new Offset(number(unary->getExp(), c), 1.0, 1.0);
+
+		if (dynamic_cast<lp::UnaryDecrementNode *>(node))
+			return new Offset(number(unary->getExp(), c), 1.0, -1.0);
+
+		if (dynamic_cast<lp::UnaryFactorialNode *>(node))
+			return new Factorial(node, number(unary->getExp(), c));
+	}
+
+	if (lp::NumericOperatorNode *binary = dynamic_cast<lp::NumericOperatorNode *>(node))
+	{
+		lp::ExpNode *left = binary->getLeft();
+		lp::ExpNode *right = binary->getRight();
+
+		if (dynamic_cast<lp::PlusNode *>(node))
+			return new Binary<Add>(number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::MinusNode *>(node))
+			return new Binary<Subtract>(number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::MultiplicationNode *>(node))
+			return new Binary<Multiply>(number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::PowerNode *>(node))
+			return new Power(number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::DivisionNode *>(node))
+			return new Division<Divide>(node, number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::IntegerDivisionNode *>(node))
+			return new Division<IntegerDivide>(node, number(left, c), number(right, c));
+
+		if (dynamic_cast<lp::ModuloNode *>(node))
+			return new Division<Modulo>(node, number(left, c), number(right, c));
+	}
+
+	if (lp::BuiltinFunctionNode_0 *f = dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+		return new Call0(((lp::BuiltinParameter0 *) table.getSymbol(f->getSlot()))->getFunction());
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return new Call1(((lp::BuiltinParameter1 *) table.getSymbol(f->getSlot()))->getFunction(),
+		                 number(f->getExp(), c));
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return new Call2(((lp::BuiltinParameter2 *) table.getSymbol(f->getSlot()))->getFunction(),
+		                 number(f->getExp1(), c), number(f->getExp2(), c));
+
+	// random and the unknown nodes
+	return new AstNumber(node);
+}
+
+
+/*!
+  \brief  Closures of a relational operator
+  \pre    Both operands have the type "type"
+*/
+template <class Compare>
+static lp::BoolClosure *relation(lp::OperatorNode *node, int type, Capture & c)
+{
+	switch (type)
+	{
+		case NUMBER:
+			return new Relation<lp::NumberClosure, Compare>(number(node->getLeft(), c), number(node->getRight(), c));
+		case BOOL:
+			return new Relation<lp::BoolClosure, Compare>(boolean(node->getLeft(), c), boolean(node->getRight(), c));
+		default:
+			return new Relation<lp::StringClosure, Text<Compare> >(string(node->getLeft(), c), string(node->getRight(), c));
+	}
+}
+
+
+/*!
+  \brief  Closures of a logical expression
+  \pre    typeOf(node) is BOOL
+*/
+static lp::BoolClosure *boolean(lp::ExpNode *node, Capture & c)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		capture(c, var->getSlot());
+		return new BoolVariable((lp::Variable *) table.getSymbol(var->getSlot()));
+	}
+
+	if (lp::ConstantNode *constant = dynamic_cast<lp::ConstantNode *>(node))
+		return new BoolLiteral(((lp::LogicalConstant *) table.getSymbol(constant->getSlot()))->getValue());
+
+	if (lp::BoolNode *literal = dynamic_cast<lp::BoolNode *>(node))
+		return new BoolLiteral(literal->getBool());
+
+	if (lp::NotNode *unary = dynamic_cast<lp::NotNode *>(node))
+		return new Not(boolean(unary->getExp(), c));
+
+	if (dynamic_cast<lp::AndNode *>(node) or dynamic_cast<lp::OrNode *>(node))
+	{
+		lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node);
+		lp::BoolClosure *left = boolean(binary->getLeft(), c);
+		lp::BoolClosure *right = boolean(binary->getRight(), c);
+
+		if (dynamic_cast<lp::AndNode *>(node))
+			return new Logical<true>(left, right);
+
+		return new Logical<false>(left, right);
+	}
+
+	if (lp::RelationalOperatorNode *binary = dynamic_cast<lp::RelationalOperatorNode *>(node))
+	{
+		int type = typeOf(binary->getLeft(), c);
+
+		if (dynamic_cast<lp::GreaterThanNode *>(node))
+			return relation<Greater>(binary, type, c);
+
+		if (dynamic_cast<lp::GreaterOrEqualNode *>(node))
+			return relation<GreaterEqual>(binary, type, c);
+
+		if (dynamic_cast<lp::LessThanNode *>(node))
+			return relation<Less>(binary, type, c);
+
+		if (dynamic_cast<lp::LessOrEqualNode *>(node))
+			return relation<LessEqual>(binary, type, c);
+
+		if (dynamic_cast<lp::EqualNode *>(node))
+			return relation<Equal>(binary, type, c);
+
+		if (dynamic_cast<lp::NotEqualNode *>(node))
+			return relation<NotEqual>(binary, type, c);
+	}
+
+	// Unknown nodes
+	return new AstBool(node);
+}
+
+
+/*!
+  \brief  Closures of a string expression
+  \pre    typeOf(node) is STRING
+*/
+static lp::StringClosure *string(lp::ExpNode *node, Capture & c)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		capture(c, var->getSlot());
+		return new StringVariable((lp::Variable *) table.getSymbol(var->getSlot()));
+	}
+
+	if (lp::StringNode *literal = dynamic_cast<lp::StringNode *>(node))
+		return new StringLiteral(literal->getString());
+
+	if (lp::ConcatenationNode *binary = dynamic_cast<lp::ConcatenationNode *>(node))
+		return new Concatenate(string(binary->getLeft(), c), string(binary->getRight(), c));
+
+	// Unknown nodes
+	return new AstString(node);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  \brief  Specialize a numeric site; the AST evaluates it if its type is not valid
+*/
+static lp::NumberClosure *specializeNumber(lp::ExpNode *node, Capture & c)
+{
+	if (not c.generic and (typeOf(node, c) == NUMBER))
+		return number(node, c);
+
+	return new AstNumber(node);
+}
+
+
+/*!
+  \brief  Specialize a logical site; the AST evaluates it if its type is not valid
+*/
+static lp::BoolClosure *specializeBool(lp::ExpNode *node, Capture & c)
+{
+	if (not c.generic and (typeOf(node, c) == BOOL))
+		return boolean(node, c);
+
+	return new AstBool(node);
+}
+
+
+/*!
+  \brief  Specialize a simple statement; the AST evaluates the statements whose types
+          are not valid or that change the type of a variable
+*/
+static lp::Action *specializeStatement(lp::Statement *stmt, Capture & c)
+{
+	if (c.generic)
+		return new AstAction(stmt);
+
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		lp::ExpNode *exp = asgn->getExp();
+
+		// The multiple assignments are evaluated by the AST
+		if (exp != NULL)
+		{
+			int type = typeOf(exp, c);
+			lp::Variable *symbol = (lp::Variable *) table.getSymbol(asgn->getSlot());
+
+			if ((type != 0) and (capture(c, asgn->getSlot()) == type))
+			{
+				// The string of the variable is not copied
+				if ((type == STRING) and (asgn->getAppended() != NULL))
+					return new Append(symbol, string(asgn->getAppended(), c));
+
+				switch (type)
+				{
+					case NUMBER: return new AssignNumber(symbol, number(exp, c));
+					case BOOL:   return new AssignBool(symbol, boolean(exp, c));
+					default:     return new AssignString(symbol, string(exp, c));
+				}
+			}
+		}
+	}
+	else if ((dynamic_cast<lp::PlusAssignmentStmt *>(stmt) != NULL) or (dynamic_cast<lp::MinusAssignmentStmt *>(stmt) != NULL))
+	{
+		lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt);
+		lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt);
+		lp::ExpNode *exp = (plus != NULL) ? plus->getExp() : minus->getExp();
+		int slot = (plus != NULL) ? plus->getSlot() : minus->getSlot();
+
+		if ((exp != NULL) and (typeOf(exp, c) == NUMBER) and (capture(c, slot) == NUMBER))
+			return new Accumulate((lp::Variable *) table.getSymbol(slot), number(exp, c), (plus != NULL) ? 1.0 : -1.0);
+	}
+	else if ((dynamic_cast<lp::UnaryIncrementStmt *>(stmt) != NULL) or (dynamic_cast<lp::UnaryDecrementStmt *>(stmt) != NULL))
+	{
+		lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt);
+		lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt);
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>((inc != NULL) ? inc->getExp() : dec->getExp());
+
+		if ((var != NULL) and (capture(c, var->getSlot()) == NUMBER))
+			return new Accumulate((lp::Variable *) table.getSymbol(var->getSlot()), new Literal(1.0), (inc != NULL) ? 1.0 : -1.0);
+	}
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+	{
+		lp::ExpNode *exp = print->getExp();
+
+		switch (typeOf(exp, c))
+		{
+			case NUMBER: return new PrintNumber(number(exp, c));
+			case BOOL:   return new PrintBool(boolean(exp, c));
+			case STRING: return new PrintString(string(exp, c));
+		}
+	}
+
+	return new AstAction(stmt);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long lp::ClosureCompiler::getSpecializations()
+{
+	return specializations;
+}
+
+
+lp::Action *lp::ClosureCompiler::compile(lp::AST *root)
+{
+	return this->compileStatements(root->getStatements());
+}
+
+
+lp::Action *lp::ClosureCompiler::compileStatements(std::list<lp::Statement *> *stmts)
+{
+	std::vector<lp::Action *> actions;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		actions.push_back(this->compileStatement(*it));
+
+	return new Sequence(actions);
+}
+
+
+lp::Action *lp::ClosureCompiler::compileStatement(lp::Statement *stmt)
+{
+	if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		lp::Action *alternative = NULL;
+
+		if (ifStmt->getAlternative() != NULL)
+			alternative = this->compileStatements(ifStmt->getAlternative());
+
+		return new If(this->boolSite(ifStmt->getCondition()), this->compileStatements(ifStmt->getConsequent()), alternative);
+	}
+
+	if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+		return new While(this->boolSite(whileStmt->getCondition()), this->compileStatements(whileStmt->getStatements()));
+
+	if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+		return new Loop<false>(this->compileStatements(doWhile->getStatements()), this->boolSite(doWhile->getCondition()));
+
+	if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+		return new Loop<true>(this->compileStatements(repeat->getStatements()), this->boolSite(repeat->getCondition()));
+
+	if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+		return new For(forStmt, this->numberSite(forStmt->getTo()), this->compileStatements(forStmt->getStatements()));
+
+	if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		// The strings are compared by the AST, which finds their case in a hash table
+		if (switchStmt->hasStringLabels())
+			return new AstAction(stmt);
+
+		std::vector<lp::NumberClosure *> labels;
+		std::vector<lp::Action *> cases;
+		lp::Action *byDefault = NULL;
+
+		for (std::list<lp::CaseStmt *>::iterator it = switchStmt->getCases()->begin(); it != switchStmt->getCases()->end(); ++it)
+		{
+			labels.push_back(this->numberSite((*it)->getExp()));
+			cases.push_back(this->compileStatements((*it)->getStatements()));
+		}
+
+		if (switchStmt->getDefault() != NULL)
+			byDefault = this->compileStatements(switchStmt->getDefault());
+
+		return new Switch(this->numberSite(switchStmt->getExp()), labels, cases, byDefault);
+	}
+
+	if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		return this->compileStatements(block->getStatements());
+
+	if (dynamic_cast<lp::AssignmentStmt *>(stmt) or dynamic_cast<lp::PlusAssignmentStmt *>(stmt)
+		or dynamic_cast<lp::MinusAssignmentStmt *>(stmt) or dynamic_cast<lp::UnaryIncrementStmt *>(stmt)
+		or dynamic_cast<lp::UnaryDecrementStmt *>(stmt) or dynamic_cast<lp::PrintStmt *>(stmt))
+	{
+		this->_sites++;
+		return new Site<lp::Action, lp::Statement>(stmt, specializeStatement);
+	}
+
+	// read, read_string, place, clear_screen and the rest are evaluated by the AST
+	return new AstAction(stmt);
+}
+
+
+lp::NumberClosure *lp::ClosureCompiler::numberSite(lp::ExpNode *node)
+{
+	this->_sites++;
+
+	return new Site<lp::NumberClosure, lp::ExpNode>(node, specializeNumber);
+}
+
+
+lp::BoolClosure *lp::ClosureCompiler::boolSite(lp::ExpNode *node)
+{
+	this->_sites++;
+
+	return new Site<lp::BoolClosure, lp::ExpNode>(node, specializeBool);
+}
@@ -0,0 +1,99 @@
+/*!
+	\file    closureCompiler.hpp
+	\brief   Declaration of the compiler from the AST to closures
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _CLOSURECOMPILER_HPP_
+#define _CLOSURECOMPILER_HPP_
+
+#include <list>
+
+#include "../ast/ast.hpp"
+
+#include "closure.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class ClosureCompiler
+  \brief Translation of the AST into a tree of closures
+  \note  The control statements become closures that call the closures of
+         their conditions and bodies. Every simple statement and every
+         condition, bound or label is a site: the first time it runs, it is
+         specialized for the types that its variables have then. A numeric
+         operator over two numeric variables becomes one closure that reads
+         both doubles through pointers to the variables and adds them, with
+         no getType() or lookup in the table of symbols. The builtins are
+         bound to their C functions.
+
+         A site keeps its closures while the variables that it read are the
+         same symbols, which is checked again only when typeEpoch changes.
+         The expressions whose types are not valid, and the values that
+         would report an error, are evaluated by the AST, which reports the
+         same errors.
+*/
+class ClosureCompiler
+{
+	private:
+		unsigned long _sites;      //!< Number of sites created by the compiler
+
+	public:
+
+	/*!
+		\brief Constructor of ClosureCompiler
+	*/
+		ClosureCompiler(): _sites(0)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compile the whole program
+		\param   root: AST of the program, already analyzed
+		\return  lp::Action *: closure of the program, to be deleted by the caller
+	*/
+		lp::Action *compile(lp::AST *root);
+
+	/*!
+		\brief   Number of sites of the compiled program
+		\return  unsigned long
+	*/
+		inline unsigned long getSites() const
+		{
+			return this->_sites;
+		}
+
+	/*!
+		\brief   Number of times that the sites of every program have been specialized
+		\return  unsigned long
+	*/
+		static unsigned long getSpecializations();
+
+	private:
+
+	/*!
+		\name Statements
+	*/
+		lp::Action *compileStatements(std::list<lp::Statement *> *stmts);
+		lp::Action *compileStatement(lp::Statement *stmt);
+
+	/*!
+		\name Sites of the expressions
+	*/
+		lp::NumberClosure *numberSite(lp::ExpNode *node);
+		lp::BoolClosure *boolSite(lp::ExpNode *node);
+};
+
+// End of name space lp
+}
+
+// End of _CLOSURECOMPILER_HPP_
+#endif
@@ -0,0 +1,65 @@
+#!/bin/bash
+# Test of the lines that the errors show.
+#
+# Every program of error/corpus/ stops with a lexical, syntax or semantic
+# error found while it is parsed, in the middle of a line or at its end, where
+# the scanner has replaced the character that follows the current token with
+# a null character. The program is run as a whole and with --stream, and its
+# standard output, its errors and its exit code must be equal to those kept in
+# the .out file of the same name.
+#
+# Usage: compare.sh [interpreter]
+#        compare.sh --update [interpreter]   writes the .out files
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+UPDATE=0
+
+if [ "$1" == "--update" ]
+then
+	UPDATE=1
+	shift
+fi
+
+INTERPRETER=${1:-$ROOT/interpreter.exe}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Whole program and statement by statement
+OPTIONS=("" "--stream")
+
+FAILED=0
+
+# The programs are run from their directory, as the errors show the file name
+cd "$ROOT/error/corpus"
+
+for PROGRAM in *.p
+do
+	NAME=$(basename "$PROGRAM" .p)
+
+	if [ $UPDATE -eq 1 ]
+	then
+		"$INTERPRETER" $PROGRAM < /dev/null > $NAME.out 2>&1
+		echo "exit $?" >> $NAME.out
+		echo "$NAME.out written"
+		continue
+	fi
+
+	for OPTION in "${OPTIONS[@]}"
+	do
+		printf "%-16s%-12s" $NAME "$OPTION"
+
+		"$INTERPRETER" $OPTION $PROGRAM < /dev/null > "$TMP/$NAME" 2>&1
+		echo "exit $?" >> "$TMP/$NAME"
+
+		if cmp -s $NAME.out "$TMP/$NAME"
+		then
+			echo "ok"
+		else
+			echo "different"
+			diff $NAME.out "$TMP/$NAME" | head -10
+			FAILED=1
+		fi
+	done
+done
+
+exit $FAILED
@@ -0,0 +1,2 @@
+x := 1;
+pi := 3; print(pi);
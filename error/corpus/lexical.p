@@ -0,0 +1,3 @@
+x := 1;
+y := 2 $ 3 + 4;
+print(y);
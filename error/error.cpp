@@ -9,15 +9,14 @@
 #include <setjmp.h>
 #include <errno.h>
 #include <iomanip>
-#include <sstream>
 #include <cstdlib>
 
 // Project-specific headers
 #include "error.hpp"
 #include "../includes/macros.hpp"
 #include "../includes/globals.hpp"
+#include "../parser/context.hpp"
 
-extern int lineNumber; //!< Reference to line counter
 extern std::string progname; //!< Reference to program name
 extern jmp_buf begin; //!< Used for error recovery
 extern int errno; //!< Reference to the global variable that controls errors in the mathematical code
@@ -37,6 +36,22 @@ int countDigits(int number) {
     return digits;
 }
 
+/**
+ * @brief Gets the text of a line of the program, to be shown by an error.
+ * @param line Line number.
+ * @return The line of the program file, or of the last lines typed in interactive mode; empty if it is not known.
+ */
+static std::string lineOf(int line)
+{
+  std::string text = "";
+
+  // The lines of the program file are located when the first error is reported
+  if (!source.getLine(line, text) && interactiveMode)
+    recentLines.getLine(line, text);
+
+  return text;
+}
+
 /**
  * @brief Prints a formatted lexical warning message with context and highlighting.
  * @param filename Name of the source file.
@@ -51,22 +66,7 @@ void lexicalWarning(const std::string& filename,
              const std::string& token,
              const std::string& errorMsg)
 {
-  std::string sourceLine = "";
-  if (line - 1 >= 0 && (size_t)(line - 1) < sourceLines.size())
-    sourceLine = sourceLines[line - 1];
-  else if (interactiveMode && !currentLine.empty()) {
-    // Extract the specific line from currentLine corresponding to 'line'
-    std::istringstream iss(currentLine);
-    std::string tempLine;
-    int current = 1;
-    while (std::getline(iss, tempLine)) {
-        if (current == line) {
-            sourceLine = tempLine;
-            break;
-        }
-        ++current;
-    }
-  }
+  std::string sourceLine = lineOf(line);
 
   std::cerr << filename << ":" << line << ":" << column << ": " << BIRED <<"Lexical error: " << RESET
             << "'" << token << "'" << std::endl;
@@ -82,7 +82,6 @@ void lexicalWarning(const std::string& filename,
   std::cerr << " " << std::setw(lineWidth) << line << " | " << before << BIRED << highlighted << RESET << after << std::endl;
   std::cerr << " " << std::setw(lineWidth) << "" << " | " << std::string(start, ' ') << BIRED << "^" << RESET << std::endl;
   std::cerr << BIYELLOW << "    Hint: " << RESET << errorMsg << std::endl;
-  currentLine = "";
 
   exit(EXIT_FAILURE);
 }
@@ -101,22 +100,7 @@ void semanticWarning(const std::string& filename,
              const std::string& errorMsg,
              const std::string& suggestion)
 {
-  std::string sourceLine = "";
-  if (line - 1 >= 0 && (size_t)(line - 1) < sourceLines.size())
-    sourceLine = sourceLines[line - 1];
-  else if (interactiveMode && !currentLine.empty()) {
-    // Extract the specific line from currentLine corresponding to 'line'
-    std::istringstream iss(currentLine);
-    std::string tempLine;
-    int current = 1;
-    while (std::getline(iss, tempLine)) {
-        if (current == line) {
-            sourceLine = tempLine;
-            break;
-        }
-        ++current;
-    }
-  }
+  std::string sourceLine = lineOf(line);
 
   std::cerr << filename << ":" << line << ":" << column << ": " << BIRED <<"Semantic error: " << RESET
             << errorMsg << std::endl;
@@ -125,7 +109,6 @@ void semanticWarning(const std::string& filename,
   std::cerr << " " << std::setw(lineWidth) << line << " | " << sourceLine << std::endl;
   std::cerr << " " << std::setw(lineWidth) << ""   << " | " << std::endl;
   std::cerr << BIYELLOW << "    Suggestion: " << RESET << suggestion << std::endl;
-  currentLine = "";
 
   exit(EXIT_FAILURE);
 }
@@ -142,27 +125,11 @@ void syntaxWarning(const std::string& filename,
              int column,
              const std::string& errorMsg)
 {
-  std::string sourceLine = "";
-  if (line - 1 >= 0 && (size_t)(line - 1) < sourceLines.size())
-    sourceLine = sourceLines[line - 1];
-  else if (interactiveMode && !currentLine.empty()) {
-    // Extract the specific line from currentLine corresponding to 'line'
-    std::istringstream iss(currentLine);
-    std::string tempLine;
-    int current = 1;
-    while (std::getline(iss, tempLine)) {
-        if (current == line) {
-            sourceLine = tempLine;
-            break;
-        }
-        ++current;
-    }
-  }
+  std::string sourceLine = lineOf(line);
 
   std::cerr << filename << ":" << line << ":" << column << ": " << BIRED <<"Syntax error: " << RESET
             << errorMsg << std::endl;
   std::cerr << "    " << line << " | "  << sourceLine << std::endl;
-  currentLine = "";
 
   exit(EXIT_FAILURE);
 }
@@ -181,22 +148,7 @@ void runtimeWarning(const std::string& filename,
              const std::string& errorMsg,
              const std::string& suggestion)
 {
-  std::string sourceLine = "";
-  if (line - 1 >= 0 && (size_t)(line - 1) < sourceLines.size())
-    sourceLine = sourceLines[line - 1];
-  else if (interactiveMode && !currentLine.empty()) {
-    // Extract the specific line from currentLine corresponding to 'line'
-    std::istringstream iss(currentLine);
-    std::string tempLine;
-    int current = 1;
-    while (std::getline(iss, tempLine)) {
-        if (current == line) {
-            sourceLine = tempLine;
-            break;
-        }
-        ++current;
-    }
-  }
+  std::string sourceLine = lineOf(line);
 
   std::cerr << filename << ":" << line << ":" << column << ": " << BIRED <<"Runtime error: " << RESET
             << errorMsg << std::endl;
@@ -205,16 +157,16 @@ void runtimeWarning(const std::string& filename,
   std::cerr << " " << std::setw(lineWidth) << line << " | " << sourceLine << std::endl;
   std::cerr << " " << std::setw(lineWidth) << ""   << " | " << std::endl;
   std::cerr << BIYELLOW << "    Suggestion: " << RESET << suggestion << std::endl;
-  currentLine = "";
 
   exit(EXIT_FAILURE);
 }
 
 /**
  * @brief Handles syntax errors from the parser and prints a custom error message.
+ * @param context State of the parse, with the position of its scanner.
  * @param errorMessage The error message from the parser.
  */
-void yyerror(std::string errorMessage)
+void yyerror(lp::Context *context, std::string errorMessage)
 {
     // Custom syntax error message
     std::string toRemove = "syntax error, ";
@@ -224,7 +176,7 @@ void yyerror(std::string errorMessage)
         errorMessage.erase(pos, toRemove.length());
     }
 
-    syntaxWarning(fileName, lineNumber, columnNumber, errorMessage);
+    syntaxWarning(fileName, context->lineNumber, context->columnNumber, errorMessage);
 }
 
 /**
@@ -7,13 +7,16 @@
 
 #include <string>
 
+namespace lp { class Context; }
+
 /**
  * @brief Reports a parser error with a custom message.
+ * @param context State of the parse, with the position of its scanner.
  * @param errorMessage Parser error message.
  * @return void
  * @sa warning
  */
-void yyerror(std::string errorMessage);
+void yyerror(lp::Context *context, std::string errorMessage);
 
 /**
  * @brief Shows a lexical warning message with detailed information.
@@ -0,0 +1,101 @@
+/*!
+	\file    lineRing.hpp
+	\brief   Declaration of the ring of the last lines scanned, shown by the errors
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _LINERING_HPP_
+#define _LINERING_HPP_
+
+#include <cstddef>
+#include <string>
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class LineRing
+  \brief Text of the last SIZE lines scanned, found by their numbers
+  \note  The scanner appends each token to the line where it is found. A line
+         takes the place of the line SIZE lines before it, and its string
+         keeps its memory, so a long interactive session uses the memory of
+         its SIZE longest lines at most.
+*/
+class LineRing
+{
+	public:
+
+	/*!
+		\brief Number of lines kept
+	*/
+		static const int SIZE = 64;
+
+	private:
+		std::string _lines[SIZE];   //!< Text of the lines, without their new lines
+		int _numbers[SIZE];         //!< Number of the line of each position, or 0
+
+	public:
+
+	/*!
+		\brief Constructor of LineRing
+		\post  The ring has no lines
+	*/
+		LineRing()
+		{
+			for (int i = 0; i < SIZE; i++)
+				this->_numbers[i] = 0;
+		}
+
+	/*!
+		\brief   Append a token to a line
+		\param   line: number of the line, from 1
+		\param   text: characters of the token
+		\param   length: number of characters
+		\return  void
+		\post    The line replaces the line SIZE lines before it, if it was in the ring
+	*/
+		inline void append(int line, const char *text, size_t length)
+		{
+			int position = line % SIZE;
+
+			if (this->_numbers[position] != line)
+			{
+				this->_numbers[position] = line;
+				this->_lines[position].clear();
+			}
+
+			this->_lines[position].append(text, length);
+		}
+
+	/*!
+		\brief   Get a line of the ring
+		\param   line: number of the line, from 1
+		\param   text: the line
+		\return  false if the line is not in the ring
+	*/
+		inline bool getLine(int line, std::string & text) const
+		{
+			if (line < 1)
+				return false;
+
+			int position = line % SIZE;
+
+			if (this->_numbers[position] != line)
+				return false;
+
+			text = this->_lines[position];
+			return true;
+		}
+};
+
+// End of name space lp
+}
+
+// End of _LINERING_HPP_
+#endif
@@ -0,0 +1,198 @@
+/*!
+	\file    source.cpp
+	\brief   Code of the functions of the Source class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__unix__)
+	#define SOURCE_MMAP
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+#include "source.hpp"
+
+
+lp::Source::~Source()
+{
+	this->release();
+}
+
+
+bool lp::Source::map(const char *path)
+{
+	this->release();
+
+#ifdef SOURCE_MMAP
+	int file = open(path, O_RDONLY);
+	struct stat status;
+
+	if (file < 0)
+		return false;
+
+	if ((fstat(file, &status) < 0) or not S_ISREG(status.st_mode))
+	{
+		close(file);
+		return false;
+	}
+
+	size_t size = status.st_size;
+	size_t page = sysconf(_SC_PAGESIZE);
+
+	// Zeroed pages with room for the two null characters, where the file is mapped
+	size_t length = (size + 2 + page - 1) / page * page;
+	void *mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (mapping == MAP_FAILED)
+	{
+		close(file);
+		return false;
+	}
+
+	// The scanner writes into the text: its pages are private to the interpreter
+	if ((size > 0) and
+	    (mmap(mapping, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, file, 0) == MAP_FAILED))
+	{
+		munmap(mapping, length);
+		close(file);
+		return false;
+	}
+
+	// The errors read the lines where the scanner does not write
+	void *reading = NULL;
+
+	if ((size > 0) and
+	    ((reading = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0)) == MAP_FAILED))
+	{
+		munmap(mapping, length);
+		close(file);
+		return false;
+	}
+
+	close(file);
+
+	this->_mapping = mapping;
+	this->_length = length;
+	this->_reading = reading;
+	this->_text = (char *) mapping;
+	this->_view = (const char *) reading;
+	this->_size = size;
+	return true;
+#else
+	FILE *file = fopen(path, "rb");
+	char buffer[BUFSIZ];
+	size_t count;
+
+	if (file == NULL)
+		return false;
+
+	while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		this->_copy.insert(this->_copy.end(), buffer, buffer + count);
+
+	fclose(file);
+
+	this->_size = this->_copy.size();
+	this->_original = this->_copy;
+	this->_view = this->_original.empty() ? NULL : &this->_original[0];
+	this->_copy.resize(this->_size + 2, '\0');
+	this->_text = &this->_copy[0];
+	return true;
+#endif
+}
+
+
+void lp::Source::assign(std::string const & text)
+{
+	this->release();
+
+	this->_copy.assign(text.begin(), text.end());
+	this->_original = this->_copy;
+	this->_view = this->_original.empty() ? NULL : &this->_original[0];
+	this->_size = this->_copy.size();
+	this->_copy.resize(this->_size + 2, '\0');
+	this->_text = &this->_copy[0];
+}
+
+
+int lp::Source::getLines()
+{
+	if (not this->_indexed)
+		this->index();
+
+	return this->_lines.size();
+}
+
+
+bool lp::Source::getLine(int line, std::string & text)
+{
+	if (not this->_indexed)
+		this->index();
+
+	if ((line < 1) or ((size_t) line > this->_lines.size()))
+		return false;
+
+	size_t begin = this->_lines[line - 1];
+	size_t end = ((size_t) line < this->_lines.size()) ? this->_lines[line] - 1 : this->_size;
+
+	// The last line may have no new line
+	if ((end > begin) and (end == this->_size) and (this->_view[end - 1] == '\n'))
+		end--;
+
+	text.assign(this->_view + begin, end - begin);
+	return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Source::index()
+{
+	this->_indexed = true;
+	this->_lines.clear();
+
+	const char *end = this->_view + this->_size;
+
+	// As std::getline, a new line at the end of the text does not begin another line
+	for (const char *line = this->_view; line < end; line++)
+	{
+		this->_lines.push_back(line - this->_view);
+
+		line = (const char *) memchr(line, '\n', end - line);
+
+		if (line == NULL)
+			break;
+	}
+}
+
+
+void lp::Source::release()
+{
+#ifdef SOURCE_MMAP
+	if (this->_mapping != NULL)
+		munmap(this->_mapping, this->_length);
+
+	if (this->_reading != NULL)
+		munmap(this->_reading, this->_size);
+#endif
+
+	this->_mapping = NULL;
+	this->_length = 0;
+	this->_reading = NULL;
+	this->_copy.clear();
+	this->_original.clear();
+	this->_text = NULL;
+	this->_view = NULL;
+	this->_size = 0;
+	this->_lines.clear();
+	this->_indexed = false;
+}
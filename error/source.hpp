@@ -0,0 +1,138 @@
+/*!
+	\file    source.hpp
+	\brief   Declaration of the text of the program file, scanned and shown by the errors
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _SOURCE_HPP_
+#define _SOURCE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Source
+  \brief Text of the program file
+  \note  The file is mapped into memory once and scanned there by flex, which
+         needs two null characters after the text; they are found in the
+         zeroed page that follows the file. While it runs, flex replaces the
+         character that follows the current token with a null character, so
+         the errors read the lines from a second, read-only mapping of the
+         same file, which shares its pages with the first one until flex
+         writes into them. The lines are only located when an error shows
+         one of them: the offsets of their beginnings are found the first
+         time, in a single pass over the text.
+*/
+class Source
+{
+	private:
+		char *_text;                   //!< Text of the program, followed by two null characters
+		const char *_view;             //!< Text of the program as it is in the file, never written
+		size_t _size;                  //!< Number of characters of the text
+		void *_mapping;                //!< Memory where the file is mapped, or NULL
+		size_t _length;                //!< Bytes of the mapping
+		void *_reading;                //!< Read-only mapping of the file, or NULL
+		std::vector<char> _copy;       //!< Text of the program when it is not mapped
+		std::vector<char> _original;   //!< Text of the program as it is in the file, when it is not mapped
+		std::vector<size_t> _lines;    //!< Offsets of the beginnings of the lines, found on demand
+		bool _indexed;                 //!< Whether the lines have been located
+
+	public:
+
+	/*!
+		\brief Constructor of Source
+		\post  The source has no text
+	*/
+		Source(): _text(NULL), _view(NULL), _size(0), _mapping(NULL), _length(0), _reading(NULL), _indexed(false)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief Destructor
+		\post  The file is unmapped
+	*/
+		~Source();
+
+	/*!
+		\brief   Map a program file into memory, twice
+		\param   path: name of the file
+		\return  false if the file cannot be opened or read
+		\post    The text of the file is followed by two null characters, and the lines are read from the second mapping
+	*/
+		bool map(const char *path);
+
+	/*!
+		\brief   Copy the text of a program
+		\param   text: lines of the program, separated by new lines
+		\return  void
+	*/
+		void assign(std::string const & text);
+
+	/*!
+		\brief   Text of the program, to be scanned in place
+		\return  char *: followed by two null characters, or NULL if there is no text
+		\warning The scanner writes into the text while it runs and restores it
+	*/
+		inline char *getBuffer()
+		{
+			return this->_text;
+		}
+
+	/*!
+		\brief   Number of characters of the text, without the two null characters
+		\return  size_t
+	*/
+		inline size_t getSize() const
+		{
+			return this->_size;
+		}
+
+	/*!
+		\brief   Number of lines of the text
+		\return  int
+	*/
+		int getLines();
+
+	/*!
+		\brief   Get a line of the text
+		\param   line: number of the line, from 1
+		\param   text: the line, without its new line, as it is in the file also while the scanner runs
+		\return  false if the text has no such line
+	*/
+		bool getLine(int line, std::string & text);
+
+	private:
+
+	/*!
+		\brief   Locate the beginnings of the lines
+		\return  void
+	*/
+		void index();
+
+	/*!
+		\brief   Release the text
+		\return  void
+	*/
+		void release();
+
+	// Copying a Source would unmap the file twice
+		Source(Source const &);
+		Source & operator=(Source const &);
+};
+
+// End of name space lp
+}
+
+// End of _SOURCE_HPP_
+#endif
@@ -6,23 +6,17 @@
 #include "globals.hpp"
 #include <iostream>
 
-/**
- * @var int lineNumber
- * @brief Tracks the current line number being processed.
- */
-int lineNumber = 1;
-
 /**
  * @var int columnNumber
- * @brief Tracks the current column number being processed.
+ * @brief Column shown by the errors of the evaluation: where the scanner of the program stopped.
  */
 int columnNumber = 1;
 
 /**
- * @var std::string currentLine
- * @brief Stores the current line of input being processed.
+ * @var lp::LineRing recentLines
+ * @brief Last lines scanned, shown by the errors of the interactive mode.
  */
-std::string currentLine = "";
+lp::LineRing recentLines;
 
 /**
  * @var std::string errorMsg
@@ -37,10 +31,10 @@ std::string errorMsg = "";
 std::string fileName = "";
 
 /**
- * @var std::vector<std::string> sourceLines
- * @brief Stores all lines of the source file for reference and error reporting.
+ * @var lp::Source source
+ * @brief Text of the program file, scanned in place and sliced into lines by the error reports.
  */
-std::vector<std::string> sourceLines;
+lp::Source source;
 
 /**
  * @var std::string suggestion
@@ -52,4 +46,10 @@ std::string suggestion = "";
  * @var bool interactiveMode
  * @brief Indicates if the interpreter is running in interactive mode.
  */
-bool interactiveMode;
\ No newline at end of file
+bool interactiveMode;
+
+/**
+ * @var unsigned long typeEpoch
+ * @brief Incremented whenever a variable changes its type, invalidating the cached types of the expressions.
+ */
+unsigned long typeEpoch = 1;
\ No newline at end of file
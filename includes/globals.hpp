@@ -8,20 +8,18 @@
 #include <string>
 #include <vector>
 
-/**
- * @brief Tracks the current line number being processed.
- */
-extern int lineNumber;
+#include "../error/source.hpp"
+#include "../error/lineRing.hpp"
 
 /**
- * @brief Tracks the current column number being processed.
+ * @brief Column shown by the errors of the evaluation: where the scanner of the program stopped.
  */
 extern int columnNumber;
 
 /**
- * @brief Stores the current line of input being processed.
+ * @brief Last lines scanned, shown by the errors of the interactive mode.
  */
-extern std::string currentLine;
+extern lp::LineRing recentLines;
 
 /**
  * @brief Stores the most recent error message.
@@ -34,9 +32,9 @@ extern std::string errorMsg;
 extern std::string fileName;
 
 /**
- * @brief Stores all lines of the source file for reference and error reporting.
+ * @brief Text of the program file, scanned in place and sliced into lines by the error reports.
  */
-extern std::vector<std::string> sourceLines;
+extern lp::Source source;
 
 /**
  * @brief Stores suggestions or hints for error recovery or user feedback.
@@ -44,13 +42,13 @@ extern std::vector<std::string> sourceLines;
 extern std::string suggestion;
 
 /**
- * @brief File pointer to the input stream for the parser.
+ * @brief Indicates if the interpreter is running in interactive mode.
  */
-extern FILE * yyin;
+extern bool interactiveMode;
 
 /**
- * @brief Indicates if the interpreter is running in interactive mode.
+ * @brief Incremented whenever a variable changes its type, invalidating the cached types of the expressions.
  */
-extern bool interactiveMode;
+extern unsigned long typeEpoch;
 
 #endif // _GLOBALS_HPP
\ No newline at end of file
@@ -17,6 +17,7 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string>
 
 //
@@ -31,15 +32,10 @@
 ////////////////////////////////////////
 
 #include "./parser/interpreter.tab.h"
-
-int control = 0; //!< To control the interactive mode in "if" and "while" sentences 
+#include "./parser/context.hpp"
 
 std::string progname; //!<  Program name
 
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-extern YY_BUFFER_STATE yy_scan_string(const char *str);
-extern void yy_delete_buffer(YY_BUFFER_STATE buffer);
-
 //
 
 
@@ -60,6 +56,21 @@ lp::AST *root; //!< Root of the abstract syntax tree AST
 
 #include "table/init.hpp"
 
+//////////////////////////////////////////////
+
+#include "vm/compiler.hpp"
+#include "vm/vm.hpp"
+#include "vm/registerCompiler.hpp"
+#include "vm/registerMachine.hpp"
+#include "vm/jit.hpp"
+#include "vm/tier.hpp"
+#include "closure/closureCompiler.hpp"
+
+#include "opt/optimizer.hpp"
+#include "opt/fuser.hpp"
+
+#include "aot/cppEmitter.hpp"
+
 
 /*
  jhmp_buf
@@ -74,6 +85,10 @@ extern jmp_buf begin; //!<  It enables recovery of runtime errors
 
 lp::Table table; //!< Table of Symbols
 
+lp::Tier *tier = NULL; //!< Tier of the hot loops of the AST
+
+lp::Arena *arena = NULL; //!< Arena of the nodes of the program, owned by its AST
+
 
 
 // cout.precision
@@ -110,47 +125,299 @@ int main(int argc, char *argv[])
     // The name of the function to handle floating-point errors is set
     signal(SIGFPE, fpecatch);
 
-    if (argc == 2) 
+    // Command line options
+    std::string engine = "ast";
+    bool disassemble = false;
+    int level = 1;
+    bool nodeCounts = false;
+    bool fusionCounts = false;
+    bool tokens = false;
+    bool stream = false;
+    unsigned long threshold = 1000;
+    bool verbose = false;
+    char *program = NULL;
+    char *output = NULL;
+    bool usage = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+
+        if (option.substr(0, 9) == "--engine=")
+        {
+            engine = option.substr(9);
+
+            if (engine != "ast" && engine != "vm" && engine != "register" && engine != "jit" && engine != "tiered" && engine != "closure")
+                usage = true;
+        }
+        else if (option.substr(0, 17) == "--tier-threshold=")
+        {
+            threshold = std::strtoul(option.substr(17).c_str(), NULL, 10);
+
+            if (threshold == 0)
+                usage = true;
+        }
+        else if (option == "--verbose")
+            verbose = true;
+        else if (option == "--disassemble")
+            disassemble = true;
+        else if (option == "-O0" || option == "-O1" || option == "-O2")
+            level = option[2] - '0';
+        else if (option == "--node-counts")
+            nodeCounts = true;
+        else if (option == "--fusion-counts")
+            fusionCounts = true;
+        else if (option == "--tokens")
+            tokens = true;
+        else if (option == "--stream")
+            stream = true;
+        else if (option == "--emit-cpp" && i + 1 < argc)
+            output = argv[++i];
+        else if (program == NULL && option.substr(0, 2) != "--")
+            program = argv[i];
+        else
+            usage = true;
+    }
+
+    // The statements run as they are parsed only in the engines that evaluate the AST
+    if (stream && ((engine != "ast" && engine != "tiered") || output != NULL || tokens))
+        usage = true;
+
+    // The hot loops of the AST are promoted to the register machine, also in the interactive mode
+    lp::LoopTier loops(threshold, true, verbose);
+
+    if (engine == "tiered")
+        tier = &loops;
+
+    if (usage)
+    {
+        std::cerr << "Usage: " << progname << " [--engine=ast|vm|register|jit|tiered|closure] [--tier-threshold=N] [--verbose] [--disassemble] [-O0|-O1|-O2] [--node-counts] [--fusion-counts] [--tokens] [--stream] [--emit-cpp out.cpp] [input_file.p]" << std::endl;
+        std::cerr << "Run as './interpreter.exe' for interactive mode or './interpreter.exe <file.p>' to execute a program file." << std::endl;
+        std::cerr << "  --engine=ast    evaluate the abstract syntax tree (default)" << std::endl;
+        std::cerr << "  --engine=vm     compile the program to bytecode and run it in the virtual machine" << std::endl;
+        std::cerr << "  --engine=register compile the program to typed registers and run it in the register machine" << std::endl;
+        std::cerr << "  --engine=jit    run the register machine with its numeric loops translated to x86-64 machine code" << std::endl;
+        std::cerr << "  --engine=tiered evaluate the abstract syntax tree and run its hot loops in the register machine and as machine code" << std::endl;
+        std::cerr << "  --engine=closure compile the program to closures specialized for the types of its variables" << std::endl;
+        std::cerr << "  --tier-threshold=N iterations of a loop in the abstract syntax tree before it is promoted (default 1000)" << std::endl;
+        std::cerr << "  --verbose       report the size and the layout of the AST, the loops promoted by --engine=tiered and the sites of --engine=closure," << std::endl;
+        std::cerr << "                  and release the AST and its arena at the end" << std::endl;
+        std::cerr << "  --disassemble   print the code before running it (with --engine=vm, register or jit)" << std::endl;
+        std::cerr << "  -O0             run the program as it is written" << std::endl;
+        std::cerr << "  -O1             fold the constant expressions and propagate the variables assigned once (default)," << std::endl;
+        std::cerr << "                  and fuse the common statements into single nodes (with --engine=ast or tiered, --stream" << std::endl;
+        std::cerr << "                  and the interactive mode)" << std::endl;
+        std::cerr << "  -O2             also hoist out of the loops the parts of their conditions that do not change (with --engine=ast)" << std::endl;
+        std::cerr << "  --node-counts   print the number of nodes of the AST before and after the optimization" << std::endl;
+        std::cerr << "  --fusion-counts print the number of fused nodes and of their evaluations of each form" << std::endl;
+        std::cerr << "  --tokens        scan the program file and print the number of its tokens instead of running it" << std::endl;
+        std::cerr << "  --stream        run each statement of the program file as soon as it is parsed, as the interactive mode does," << std::endl;
+        std::cerr << "                  without optimizing it but fusing its common statements" << std::endl;
+        std::cerr << "  --emit-cpp out.cpp write the program as a C++ source file to link with aot/liblexon.a instead of running it" << std::endl;
+    }
+    else if (program != NULL) 
     {
-        std::string filename = argv[1];
+        std::string filename = program;
 
         if (filename.size() < 3 || filename.substr(filename.size() - 2) != ".p") {
             std::cerr << "Error: The input file must have a '.p' extension." << std::endl;
             return 1;
         }
 
-        yyin = fopen(argv[1], "r");
-
-        if (!yyin) {
-            std::cerr << "Error: The file '" << argv[1] << "' does not exist or cannot be opened." << std::endl;
+        // The file is mapped into memory once: the scanner reads it there and the errors show its lines
+        if (!source.map(program)) {
+            std::cerr << "Error: The file '" << program << "' does not exist or cannot be opened." << std::endl;
             return 1;
         }
 
         interactiveMode = false;
 
-        std::ifstream file(argv[1]);
-        std::string line;
-        while (std::getline(file, line)) {
-            sourceLines.push_back(line);
-        }
-        file.close();
+        // The state of the parse, whose scanner reads the file where it is mapped;
+        // with --stream, the parser runs each statement as soon as it is complete
+        lp::Context context(&recentLines, stream);
+
+        // The nodes of the program are allocated in an arena that its AST releases at once
+        arena = context.arena = new lp::Arena;
+
+        // The engines that evaluate the AST run the common statements as fused nodes,
+        // also those that --stream runs as soon as they are parsed
+        lp::Fuser fuser;
+
+        if (stream && level >= 1)
+            context.fuser = &fuser;
+
+        context.scanBuffer(source.getBuffer(), source.getSize());
 
-        yyparse();
+        // Only the scanner runs, to measure it
+        if (tokens)
+            std::cout << context.countTokens() << std::endl;
+        else
+            context.parse();
 
-        if (root != NULL) {
+        root = context.root;
+
+        // The errors of the evaluation show the column where the scanner stopped
+        columnNumber = context.columnNumber;
+
+        if (stream && fusionCounts)
+            fuser.report(std::cerr);
+
+        // With --stream the program has already run, statement by statement
+        if (root != NULL && !stream) {
             // root->printAST();
-            root->evaluate();
+
+            if (verbose)
+                std::cerr << "arena: " << arena->getObjects() << " objects to destroy, " << arena->getBytes() / 1024
+                          << " KB in " << arena->getBlocks() << " blocks" << std::endl;
+
+            // The virtual machines and the translation to C++ compile the loops
+            // themselves and never reset the values kept by the hoisting of level 2
+            if ((engine != "ast" || output != NULL) && level > 1)
+                level = 1;
+
+            // Rewrite the AST before its types are inferred
+            lp::Optimizer optimizer(level);
+            int before = lp::Optimizer::countNodes(root);
+
+            optimizer.optimize(root);
+
+            if (nodeCounts)
+                std::cerr << "nodes: " << before << " before, " << lp::Optimizer::countNodes(root) << " after ("
+                          << optimizer.getFolded() << " folded, " << optimizer.getPropagated() << " propagated, "
+                          << optimizer.getHoisted() << " hoisted)" << std::endl;
+
+            if ((engine == "ast" || engine == "tiered") && output == NULL && level >= 1)
+                fuser.fuse(root);
+
+            // Infer the static types once before running the program
+            root->analyze();
+
+            // The AST runs its statements from contiguous arrays, also when a machine delegates them to it
+            root->freeze();
+
+            if (verbose)
+                root->reportLayout(std::cerr);
+
+            if (output != NULL)
+            {
+                // Translate the program to C++ without running it
+                std::ofstream out(output);
+
+                if (!out) {
+                    std::cerr << "Error: The file '" << output << "' cannot be created." << std::endl;
+                    return 1;
+                }
+
+                lp::CppEmitter emitter;
+                emitter.emit(root, out);
+            }
+            else if (engine == "vm")
+            {
+                // Compile the whole program to bytecode and run it
+                lp::Chunk chunk;
+                lp::Compiler compiler(&chunk);
+
+                compiler.compile(root);
+
+                if (disassemble)
+                    chunk.disassemble();
+
+                lp::VirtualMachine vm(&chunk);
+                vm.run();
+            }
+            else if (engine == "register")
+            {
+                // Compile the whole program to register code and run it
+                lp::RegisterChunk chunk;
+                lp::RegisterCompiler compiler(&chunk);
+
+                compiler.compile(root);
+
+                if (disassemble)
+                    chunk.disassemble();
+
+                lp::RegisterMachine machine(&chunk);
+                machine.run();
+            }
+            else if (engine == "jit")
+            {
+                // Register code whose numeric loops run as machine code
+                lp::RegisterChunk chunk;
+                lp::RegisterCompiler compiler(&chunk);
+
+                compiler.compile(root);
+
+                lp::Jit jit(&chunk);
+
+                if (disassemble)
+                {
+                    chunk.disassemble();
+                    std::cout << "jit: " << jit.getCompiled() << " loops translated to " << jit.getSize()
+                              << " bytes, " << jit.getRejected() << " left to the register machine" << std::endl;
+                }
+
+                lp::RegisterMachine machine(&chunk, &jit);
+                machine.run();
+            }
+            else if (engine == "closure")
+            {
+                // Compile the whole program to closures and run them
+                lp::ClosureCompiler compiler;
+                lp::Action *code = compiler.compile(root);
+
+                (*code)();
+
+                if (verbose)
+                    std::cerr << "closure: " << compiler.getSites() << " sites, "
+                              << lp::ClosureCompiler::getSpecializations() << " specializations" << std::endl;
+
+                delete code;
+            }
+            else
+                root->evaluate();
+
+            if (fusionCounts)
+                fuser.report(std::cerr);
         }
     }
-    else if (argc == 1)
+    else
     {
+        // The interactive mode always evaluates the AST
         interactiveMode = true;
-        yyparse();
+
+        // After a runtime error the parse starts again with the same scanner, which keeps what it has read
+        static lp::Context context(&recentLines, true);
+        static lp::Fuser fuser;
+
+        arena = context.arena = new lp::Arena;
+
+        if (level >= 1)
+            context.fuser = &fuser;
+
+        context.parse();
+
+        root = context.root;
     }
-    else
+
+    if (tier != NULL)
+        loops.report();
+
+    // The process ends here and its memory is returned at once: the AST and its
+    // arena are only released with --verbose, which checks that they can be
+    if (verbose && arena != NULL)
     {
-        std::cerr << "Usage: " << progname << " [input_file.p]" << std::endl;
-        std::cerr << "Run as './interpreter.exe' for interactive mode or './interpreter.exe <file.p>' to execute a program file." << std::endl;
+        size_t objects = arena->getObjects();
+
+        // The AST owns the arena of its nodes
+        if (root != NULL && root->getArena() == arena)
+            delete root;
+        else
+            delete arena;
+
+        root = NULL;
+        arena = NULL;
+
+        std::cerr << "arena: " << objects << " objects destroyed" << std::endl;
     }
 
     return 0;
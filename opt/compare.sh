@@ -0,0 +1,70 @@
+#!/bin/bash
+# Differential test of the optimizer.
+#
+# Every program of opt/corpus/ is run at -O0, -O1 and -O2 and with every
+# engine. Its standard output, its errors and its exit code must be equal to
+# those kept in the .out file of the same name, written from -O0. The programs
+# change the bounds, the steps, the conditions and the variables of their loops
+# inside their bodies, where a wrong hoisting or propagation would show.
+# With --verbose the AST and its arena are also released at the end: the
+# reports of --verbose are left out and the rest must be equal as well.
+#
+# Usage: compare.sh [interpreter]
+#        compare.sh --update [interpreter]   writes the .out files from -O0
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+UPDATE=0
+
+if [ "$1" == "--update" ]
+then
+	UPDATE=1
+	shift
+fi
+
+INTERPRETER=${1:-$ROOT/interpreter.exe}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Optimization levels and engines
+OPTIONS=("-O0" "-O1" "-O2" "--engine=vm" "--engine=register" "--engine=jit" "--engine=closure"
+         "--engine=tiered" "--engine=tiered --tier-threshold=2" "-O2 --verbose")
+
+# Reports of --verbose
+REPORTS='^(arena|freeze|closure|tier): '
+
+FAILED=0
+
+# The programs are run from their directory, as the errors show the file name
+cd "$ROOT/opt/corpus"
+
+for PROGRAM in *.p
+do
+	NAME=$(basename "$PROGRAM" .p)
+
+	if [ $UPDATE -eq 1 ]
+	then
+		"$INTERPRETER" -O0 $PROGRAM < /dev/null > $NAME.out 2>&1
+		echo "exit $?" >> $NAME.out
+		echo "$NAME.out written"
+		continue
+	fi
+
+	for OPTION in "${OPTIONS[@]}"
+	do
+		printf "%-16s%-36s" $NAME "$OPTION"
+
+		"$INTERPRETER" $OPTION $PROGRAM < /dev/null 2>&1 | grep -Ev "$REPORTS" > "$TMP/$NAME"
+		echo "exit ${PIPESTATUS[0]}" >> "$TMP/$NAME"
+
+		if cmp -s $NAME.out "$TMP/$NAME"
+		then
+			echo "ok"
+		else
+			echo "different"
+			diff $NAME.out "$TMP/$NAME" | head -10
+			FAILED=1
+		fi
+	done
+done
+
+exit $FAILED
@@ -0,0 +1,41 @@
+#  Cadenas que crecen por su final, "s := s || e": todas las maquinas
+#  las alargan sin copiarlas, tambien dentro de los bucles traducidos.
+
+# Un literal y una variable
+s := '';
+t := 'b';
+for i from 1 to 5 do
+	s := s || 'a';
+	s := s || t;
+end_for
+print(s);
+
+# La cadena se alarga consigo misma
+u := 'x';
+for i from 1 to 4 do
+	u := u || u;
+end_for
+print(u);
+
+# Una cadena que comparte su valor con otra variable no la cambia
+v := 'p';
+k := 0;
+while (k < 3) do
+	w := v;
+	v := v || 'q';
+	k := k + 1;
+end_while
+print(v);
+print(w);
+
+# La variable deja de ser una cadena: la concatenacion informa del error
+z := 'c';
+for i from 1 to 3 do
+	z := z || 'd';
+	print(z);
+
+	if (i = 2) then
+		z := 7;
+	end_if
+end_for
+print(z);
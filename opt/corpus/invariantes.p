@@ -0,0 +1,79 @@
+#  Programa que comprueba que los bucles dan los mismos resultados
+#  con -O0 y con -O2, aunque sus cuerpos cambien los límites.
+#  ./interpreter.exe -O0 opt/corpus/invariantes.p
+#  ./interpreter.exe -O2 opt/corpus/invariantes.p
+
+# El límite no cambia: se calcula una sola vez
+limite := 3;
+factor := 2;
+for i from 1 to limite * factor do
+	print(i);
+end_for
+
+# El cuerpo cambia el límite: se evalúa en cada iteración
+n := 6;
+for i from 1 to n do
+	n := n - 1;
+	print(i);
+end_for
+print(n);
+
+# El cuerpo cambia el límite con +:= dentro de un if
+m := 2;
+for i from 1 to m + 1 do
+	if (i < 3) then
+		m +:= 1;
+	end_if
+	print(i * 10);
+end_for
+
+# El límite depende de la variable del bucle
+total := 0;
+for i from 1 to 4 do
+	for j from 1 to i do
+		total := total + j;
+	end_for
+end_for
+print(total);
+
+# Solo una parte de la condición es invariante
+k := 0;
+tope := 4;
+while (k < tope * factor - 1) do
+	k := k + 1;
+end_while
+print(k);
+
+# La parte invariante se vuelve a calcular cada vez que empieza el bucle
+for vuelta from 1 to 3 do
+	k := 0;
+	repeat
+		k := k + 1;
+	until (k >= vuelta * factor)
+	print(k);
+	factor := factor + 1;
+end_for
+
+# La condición cambia dentro de un bucle anidado
+x := 1;
+hecho := false;
+while (not hecho and x < 100) do
+	for i from 1 to 2 do
+		x := x * 3;
+	end_for
+	if (x > 50) then
+		hecho := true;
+	end_if
+end_while
+print(x);
+
+# El cuerpo cambia el tipo de una variable de la condición
+y := 0;
+do
+	y := y + 1;
+	if (y = 3) then
+		z := 'fin';
+	end_if
+while (y < 5)
+print(y);
+print(z);
@@ -0,0 +1,66 @@
+#  Bucles cuyos cuerpos cambian sus límites, sus pasos o sus condiciones:
+#  dan los mismos resultados con -O0, -O1 y -O2.
+
+# El cuerpo incrementa el límite con ++ y lo reduce dentro de un if
+n := 5;
+for i from 1 to n do
+	n++;
+	if (n > 8) then
+		n := 2;
+	end_if
+	print(i);
+end_for
+print(n);
+
+# El cuerpo reduce el límite con -:=
+m := 10;
+for i from 1 to m - 2 do
+	m -:= 2;
+	print(i);
+end_for
+print(m);
+
+# El cuerpo cambia el paso
+paso := 1;
+for i from 1 to 20 step paso do
+	paso := paso * 2;
+	print(i);
+end_for
+
+# Solo uno de los factores del límite cambia, con --
+a := 3;
+b := 2;
+for i from 1 to a * b do
+	if (i = 2) then
+		b--;
+	end_if
+	print(i);
+end_for
+
+# Un bucle anidado usa como variable un operando de la condición
+k := 0;
+tope := 3;
+while (k < tope * 2) do
+	for tope from 1 to 2 do
+		k := k + 1;
+	end_for
+	print(k);
+end_while
+print(tope);
+
+# La condición de repeat depende de una variable que el cuerpo cambia de vez en cuando
+r := 0;
+limite := 4;
+repeat
+	r := r + 1;
+	if (r = 2) then
+		limite +:= 3;
+	end_if
+until (r >= limite + 0)
+print(r);
+
+# Una variable asignada una sola vez que luego cambia como variable de un for
+c := 4;
+for c from 1 to 2 do
+end_for
+print(c);
@@ -0,0 +1,75 @@
+#  Bucles for cuyos cuerpos dan a su variable un valor de otro tipo:
+#  el bucle sigue contando, con una copia del ultimo numero de la
+#  variable que el cuerpo ya no ve.
+
+# Una cadena y despues un numero: el bucle no ve el numero
+for i from 1 to 5 do
+	print(i);
+	i := 'a';
+	i := 100;
+end_for
+print(i);
+
+# Una cadena: la variable la conserva
+for i from 1 to 3 do
+	print(i);
+	i := 'a';
+end_for
+print(i);
+
+# Un valor logico a partir de la tercera iteracion
+k := 0;
+for i from 1 to 9 step 2 do
+	print(i);
+	k := k + 1;
+
+	if (k >= 3) then
+		i := true;
+	end_if
+end_for
+print(i);
+
+# Un numero y una cadena en la misma iteracion
+k := 0;
+for i from 1 to 10 do
+	print(i);
+	k := k + 1;
+
+	if (k = 1) then
+		i := i + 3;
+		i := 'b';
+	end_if
+end_for
+print(i);
+
+# Un bucle anidado con la misma variable antes de la cadena
+for i from 1 to 3 do
+	for i from 1 to 2 do
+		print(i * 10);
+	end_for
+	print(i);
+	i := 'x';
+end_for
+print(i);
+
+# Un bucle anidado con la misma variable despues de la cadena
+for i from 1 to 4 do
+	print(i);
+	i := 'a';
+
+	for i from 1 to 3 do
+		print(i);
+		i := 'b';
+	end_for
+end_for
+print(i);
+
+# Los dos bucles siguen con la misma copia
+for i from 1 to 3 do
+	for i from 1 to 2 do
+		print(i);
+		i := 'x';
+	end_for
+	print(i);
+end_for
+print(i);
@@ -0,0 +1,41 @@
+#  Bucles for cuyos cuerpos cambian su variable:
+#  dan los mismos resultados con -O0, -O1 y -O2.
+
+# El cuerpo suma a la variable del bucle
+for i from 1 to 10 do
+	print(i);
+	i := i + 2;
+end_for
+print(i);
+
+# El cuerpo incrementa la variable del bucle con ++
+for i from 1 to 10 do
+	i++;
+	print(i);
+end_for
+print(i);
+
+# Un paso mayor que uno y una variable que el cuerpo reduce
+for i from 1 to 12 step 4 do
+	i -:= 1;
+	print(i);
+end_for
+print(i);
+
+# Un bucle anidado cambia la variable del bucle exterior
+for i from 1 to 3 do
+	for j from 1 to 2 do
+		i := i + 1;
+	end_for
+	print(i);
+end_for
+print(i);
+print(j);
+
+# Un bucle anidado usa la misma variable
+for i from 1 to 3 do
+	for i from 1 to 2 do
+		print(i * 100);
+	end_for
+	print(i);
+end_for
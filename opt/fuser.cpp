@@ -0,0 +1,272 @@
+/*!
+	\file    fuser.cpp
+	\brief   Code of the functions of the Fuser class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <list>
+#include <ostream>
+
+#include "fuser.hpp"
+
+
+/*!
+  \brief  Get the operand of a fused node
+  \param  node: expression
+  \param  operand: literal or variable of the expression
+  \return false if the expression is not a numeric literal or a variable
+*/
+static bool operandOf(lp::ExpNode *node, lp::FusedOperand & operand)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		operand = lp::FusedOperand(var->getSlot());
+		return true;
+	}
+
+	if (lp::NumberNode *number = dynamic_cast<lp::NumberNode *>(node))
+	{
+		operand = lp::FusedOperand(-1, number->evaluateNumber());
+		return true;
+	}
+
+	return false;
+}
+
+
+/*!
+  \brief  Check if an expression is a variable
+  \param  node: expression
+  \param  slot: slot of the variable
+  \return bool
+*/
+static bool isVariable(lp::ExpNode *node, int slot)
+{
+	lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node);
+
+	return (var != NULL) and (var->getSlot() == slot);
+}
+
+
+/*!
+  \brief  Fuse a comparison of a kind of relational node
+  \param  node: comparison
+  \param  fired: counter of the conditions
+  \return the fused node, or NULL if the comparison is not a Node or its operands cannot be fused
+*/
+template <class Node>
+static lp::ExpNode *fuseRelation(lp::ExpNode *node, unsigned long *fired)
+{
+	Node *relation = dynamic_cast<Node *>(node);
+	lp::FusedOperand first, second;
+
+	if ((relation == NULL) or not operandOf(relation->getLeft(), first)
+	    or not operandOf(relation->getRight(), second))
+		return NULL;
+
+	// The comparisons of two literals are folded by the optimizer
+	if ((first.getSlot() < 0) and (second.getSlot() < 0))
+		return NULL;
+
+	return new lp::FusedRelationNode<Node>(relation->getLeft(), relation->getRight(), first, second,
+	                                       fired, relation->_lineNumber);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+lp::Fuser::Fuser()
+{
+	for (int form = 0; form < FORMS; form++)
+	{
+		this->_rewrites[form] = 0;
+		this->_fired[form] = 0;
+	}
+}
+
+
+void lp::Fuser::fuse(lp::AST *root)
+{
+	this->fuseStatements(root->getStatements());
+}
+
+
+lp::Statement *lp::Fuser::fuse(lp::Statement *stmt)
+{
+	return this->fuseStatement(stmt);
+}
+
+
+void lp::Fuser::report(std::ostream & out) const
+{
+	static const char *names[FORMS] = {"x := x + k", "x +:= k", "i < n", "print x", "s := s || e"};
+	static const char *nodes[FORMS] = {"assignments", "assignments", "conditions", "statements", "assignments"};
+
+	for (int form = 0; form < FORMS; form++)
+		out << "fusion: " << names[form] << ": " << this->_rewrites[form] << " " << nodes[form]
+		    << " fused, " << this->_fired[form] << " fused evaluations" << std::endl;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Fuser::fuseStatements(std::list<lp::Statement *> *stmts)
+{
+	if (stmts == NULL)
+		return;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		*it = this->fuseStatement(*it);
+}
+
+
+lp::Statement *lp::Fuser::fuseStatement(lp::Statement *stmt)
+{
+	lp::FusedOperand operand;
+
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		// The multiple assignments are left as they are
+		if (asgn->getAssignment() != NULL)
+			return stmt;
+
+		int slot = asgn->getSlot();
+		lp::ExpNode *other = NULL;
+		double sign = 1.0;
+
+		// A string that grows by its end
+		if (lp::ExpNode *tail = asgn->getAppended())
+		{
+			this->_rewrites[APPEND]++;
+			return new lp::FusedAppendStmt(slot, asgn->getExp(), tail, &this->_fired[APPEND],
+			                               asgn->_lineNumber);
+		}
+
+		if (lp::PlusNode *plus = dynamic_cast<lp::PlusNode *>(asgn->getExp()))
+		{
+			if (isVariable(plus->getLeft(), slot))
+				other = plus->getRight();
+			else if (isVariable(plus->getRight(), slot))
+				other = plus->getLeft();
+		}
+		else if (lp::MinusNode *minus = dynamic_cast<lp::MinusNode *>(asgn->getExp()))
+		{
+			if (isVariable(minus->getLeft(), slot))
+			{
+				other = minus->getRight();
+				sign = -1.0;
+			}
+		}
+
+		if ((other == NULL) or not operandOf(other, operand))
+			return stmt;
+
+		this->_rewrites[ASSIGNMENT]++;
+		return new lp::FusedAssignmentStmt(slot, asgn->getExp(), operand, sign,
+		                                   &this->_fired[ASSIGNMENT], asgn->_lineNumber);
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+	{
+		if (not operandOf(plus->getExp(), operand))
+			return stmt;
+
+		this->_rewrites[COMPOUND]++;
+		return new lp::FusedCompoundStmt<lp::PlusAssignmentStmt>(plus->getSlot(), plus->getExp(), operand,
+		                                                         &this->_fired[COMPOUND], plus->_lineNumber);
+	}
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+	{
+		if (not operandOf(minus->getExp(), operand))
+			return stmt;
+
+		this->_rewrites[COMPOUND]++;
+		return new lp::FusedCompoundStmt<lp::MinusAssignmentStmt>(minus->getSlot(), minus->getExp(), operand,
+		                                                          &this->_fired[COMPOUND], minus->_lineNumber);
+	}
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(print->getExp());
+
+		if (var == NULL)
+			return stmt;
+
+		this->_rewrites[PRINT]++;
+		return new lp::FusedPrintStmt(var, var->getSlot(), &this->_fired[PRINT], print->_lineNumber);
+	}
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		ifStmt->setCondition(this->fuseCondition(ifStmt->getCondition()));
+		this->fuseStatements(ifStmt->getConsequent());
+		this->fuseStatements(ifStmt->getAlternative());
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		whileStmt->setCondition(this->fuseCondition(whileStmt->getCondition()));
+		this->fuseStatements(whileStmt->getStatements());
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		doWhile->setCondition(this->fuseCondition(doWhile->getCondition()));
+		this->fuseStatements(doWhile->getStatements());
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		repeat->setCondition(this->fuseCondition(repeat->getCondition()));
+		this->fuseStatements(repeat->getStatements());
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+		this->fuseStatements(forStmt->getStatements());
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+		for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+			this->fuseStatements((*it)->getStatements());
+
+		this->fuseStatements(switchStmt->getDefault());
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		this->fuseStatements(block->getStatements());
+
+	return stmt;
+}
+
+
+lp::ExpNode *lp::Fuser::fuseCondition(lp::ExpNode *node)
+{
+	// The operands of "and" and "or" are conditions too
+	if (lp::LogicalOperatorNode *logical = dynamic_cast<lp::LogicalOperatorNode *>(node))
+	{
+		logical->setLeft(this->fuseCondition(logical->getLeft()));
+		logical->setRight(this->fuseCondition(logical->getRight()));
+		return node;
+	}
+
+	unsigned long *fired = &this->_fired[CONDITION];
+	lp::ExpNode *result = fuseRelation<lp::LessThanNode>(node, fired);
+
+	if (result == NULL)
+		result = fuseRelation<lp::LessOrEqualNode>(node, fired);
+
+	if (result == NULL)
+		result = fuseRelation<lp::GreaterThanNode>(node, fired);
+
+	if (result == NULL)
+		result = fuseRelation<lp::GreaterOrEqualNode>(node, fired);
+
+	if (result == NULL)
+		result = fuseRelation<lp::EqualNode>(node, fired);
+
+	if (result == NULL)
+		result = fuseRelation<lp::NotEqualNode>(node, fired);
+
+	if (result == NULL)
+		return node;
+
+	this->_rewrites[CONDITION]++;
+	return result;
+}
@@ -0,0 +1,107 @@
+/*!
+	\file    fuser.hpp
+	\brief   Declaration of the fusion of the common shapes of statements of the AST
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _FUSER_HPP_
+#define _FUSER_HPP_
+
+#include <list>
+
+#include "../ast/ast.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Fuser
+  \brief Replacement of the common shapes of statements with fused nodes
+  \note  "x := x + k", "x +:= k", "i < n" in a condition and "print x" are
+         evaluated by several nodes of the AST, each one looking up its
+         variables in the table of symbols. Their fused nodes read and
+         write the slots of the variables in a single step. The operands
+         must be numeric literals or variables; the fused nodes fall back to
+         the original ones when a variable is not numeric. "s := s || e"
+         appends e to the string of s instead of copying it.
+*/
+class Fuser
+{
+	public:
+
+	/*!
+		\brief Shapes of statements that are fused
+	*/
+		enum Form
+		{
+			ASSIGNMENT,   //!< x := x + y, x := y + x, x := x - y
+			COMPOUND,     //!< x +:= y, x -:= y
+			CONDITION,    //!< comparison of two numeric operands in a condition
+			PRINT,        //!< print x
+			APPEND,       //!< s := s || e
+			FORMS         //!< Number of forms
+		};
+
+	private:
+		unsigned long _rewrites[FORMS];   //!< Number of nodes of each form created by the fusion
+		unsigned long _fired[FORMS];      //!< Number of fused evaluations of each form
+
+	public:
+
+	/*!
+		\brief Constructor of Fuser
+	*/
+		Fuser();
+
+	/*!
+		\brief   Fuse the statements of the whole program
+		\param   root: AST of the program, after its optimization
+		\return  void
+		\warning The Fuser must live while the program runs: its nodes count their evaluations in it
+	*/
+		void fuse(lp::AST *root);
+
+	/*!
+		\brief   Fuse a statement that is evaluated as soon as it is parsed, in immediate mode
+		\param   stmt: statement of the program
+		\return  lp::Statement *: the fused statement, or stmt if it has none
+		\warning The Fuser must live while the program runs, as with fuse(root)
+	*/
+		lp::Statement *fuse(lp::Statement *stmt);
+
+	/*!
+		\brief   Print the number of fused nodes and of fused evaluations of each form
+		\param   out: stream of the report
+		\return  void
+	*/
+		void report(std::ostream & out) const;
+
+	private:
+
+	/*!
+		\name Statements
+	*/
+		void fuseStatements(std::list<lp::Statement *> *stmts);
+		lp::Statement *fuseStatement(lp::Statement *stmt);
+
+	/*!
+		\name Conditions
+	*/
+		lp::ExpNode *fuseCondition(lp::ExpNode *node);
+
+	// The fused nodes keep pointers to the counters
+		Fuser(Fuser const &);
+		Fuser & operator=(Fuser const &);
+};
+
+// End of name space lp
+}
+
+// End of _FUSER_HPP_
+#endif
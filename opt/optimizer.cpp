@@ -0,0 +1,593 @@
+/*!
+	\file    optimizer.cpp
+	\brief   Code of the functions of the Optimizer class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <list>
+#include <map>
+#include <climits>
+#include <cmath>
+
+#include "optimizer.hpp"
+
+#include "../table/value.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+/*!
+  \brief  Check if an expression is a literal
+  \param  node: expression
+  \return true for the NumberNode, StringNode and BoolNode
+*/
+static bool isLiteral(lp::ExpNode *node)
+{
+	return dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::StringNode *>(node)
+		or dynamic_cast<lp::BoolNode *>(node);
+}
+
+
+/*!
+  \brief  Check that an operator whose operands are literals can be evaluated without errors
+  \param  node: unary or binary operator
+  \return false if the evaluation would report an error
+*/
+static bool isSafe(lp::ExpNode *node)
+{
+	if (lp::UnaryFactorialNode *factorial = dynamic_cast<lp::UnaryFactorialNode *>(node))
+	{
+		double value = ((lp::NumberNode *) factorial->getExp())->getNumber();
+
+		// Larger factorials are infinite and take long to compute
+		return (value >= 0) and (floor(value) == value) and (value <= 170);
+	}
+
+	if (dynamic_cast<lp::DivisionNode *>(node) or dynamic_cast<lp::IntegerDivisionNode *>(node)
+		or dynamic_cast<lp::ModuloNode *>(node))
+	{
+		lp::OperatorNode *binary = (lp::OperatorNode *) node;
+		double left = ((lp::NumberNode *) binary->getLeft())->getNumber();
+		double right = ((lp::NumberNode *) binary->getRight())->getNumber();
+
+		if (std::abs(right) <= ERROR_BOUND)
+			return false;
+
+		// The integer operations must not divide by zero or overflow
+		if (dynamic_cast<lp::DivisionNode *>(node) == NULL)
+			return (std::abs(right) >= 1) and (std::abs(right) < INT_MAX) and (std::abs(left) < INT_MAX);
+	}
+
+	return true;
+}
+
+
+/*!
+  \brief  Check that the value of an expression cannot change while a loop runs
+  \param  node: expression
+  \param  writes: slots written by the body of the loop
+  \return false if the expression reads a written variable or is not pure
+*/
+static bool isInvariant(lp::ExpNode *node, std::map<int, int> const & writes)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+		return writes.find(var->getSlot()) == writes.end();
+
+	if (isLiteral(node) or dynamic_cast<lp::ConstantNode *>(node))
+		return true;
+
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		return isInvariant(unary->getExp(), writes);
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+		return isInvariant(binary->getLeft(), writes) and isInvariant(binary->getRight(), writes);
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return isInvariant(f->getExp(), writes);
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return isInvariant(f->getExp1(), writes) and isInvariant(f->getExp2(), writes);
+
+	// random and the unknown nodes
+	return false;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Optimizer::optimize(lp::AST *root)
+{
+	if (this->_level < 1)
+		return;
+
+	std::list<lp::Statement *> *stmts = root->getStatements();
+
+	countWrites(stmts, this->_writes);
+
+	// The statements of the program run once and in order, so the value of a variable
+	// assigned once by one of them is known in all the statements that follow it
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+	{
+		this->foldStatement(*it);
+
+		lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(*it);
+
+		if ((asgn != NULL) and (asgn->getAssignment() == NULL) and isLiteral(asgn->getExp())
+			and (this->_writes[asgn->getSlot()] == 1))
+			this->_values[asgn->getSlot()] = asgn->getExp();
+	}
+
+	if (this->_level >= 2)
+		this->hoistStatements(stmts);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Optimizer::countWrites(std::list<lp::Statement *> *stmts, std::map<int, int> &writes)
+{
+	if (stmts == NULL)
+		return;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		countWrites(*it, writes);
+}
+
+
+void lp::Optimizer::countWrites(lp::Statement *stmt, std::map<int, int> &writes)
+{
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		writes[asgn->getSlot()]++;
+
+		if (asgn->getAssignment() != NULL)
+			countWrites(asgn->getAssignment(), writes);
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+		writes[plus->getSlot()]++;
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+		writes[minus->getSlot()]++;
+	else if (lp::ReadStmt *read = dynamic_cast<lp::ReadStmt *>(stmt))
+		writes[read->getSlot()]++;
+	else if (lp::ReadStringStmt *read = dynamic_cast<lp::ReadStringStmt *>(stmt))
+		writes[read->getSlot()]++;
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		writes[forStmt->getSlot()]++;
+		countWrites(forStmt->getStatements(), writes);
+	}
+	else if (lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt))
+	{
+		if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(inc->getExp()))
+			writes[var->getSlot()]++;
+	}
+	else if (lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt))
+	{
+		if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(dec->getExp()))
+			writes[var->getSlot()]++;
+	}
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+	{
+		if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(fact->getExp()))
+			writes[var->getSlot()]++;
+	}
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		countWrites(ifStmt->getConsequent(), writes);
+		countWrites(ifStmt->getAlternative(), writes);
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+		countWrites(whileStmt->getStatements(), writes);
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+		countWrites(doWhile->getStatements(), writes);
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+		countWrites(repeat->getStatements(), writes);
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+		for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+			countWrites((*it)->getStatements(), writes);
+
+		countWrites(switchStmt->getDefault(), writes);
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		countWrites(block->getStatements(), writes);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Optimizer::foldStatements(std::list<lp::Statement *> *stmts)
+{
+	if (stmts == NULL)
+		return;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		this->foldStatement(*it);
+}
+
+
+void lp::Optimizer::foldStatement(lp::Statement *stmt)
+{
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		if (asgn->getAssignment() != NULL)
+			this->foldStatement(asgn->getAssignment());
+		else
+			asgn->setExp(this->fold(asgn->getExp()));
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+		plus->setExp(this->fold(plus->getExp()));
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+		minus->setExp(this->fold(minus->getExp()));
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+		print->setExp(this->fold(print->getExp()));
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		ifStmt->setCondition(this->fold(ifStmt->getCondition()));
+		this->foldStatements(ifStmt->getConsequent());
+		this->foldStatements(ifStmt->getAlternative());
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		whileStmt->setCondition(this->fold(whileStmt->getCondition()));
+		this->foldStatements(whileStmt->getStatements());
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		doWhile->setCondition(this->fold(doWhile->getCondition()));
+		this->foldStatements(doWhile->getStatements());
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		repeat->setCondition(this->fold(repeat->getCondition()));
+		this->foldStatements(repeat->getStatements());
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		forStmt->setFrom(this->fold(forStmt->getFrom()));
+		forStmt->setTo(this->fold(forStmt->getTo()));
+
+		if (forStmt->getStep() != NULL)
+			forStmt->setStep(this->fold(forStmt->getStep()));
+
+		this->foldStatements(forStmt->getStatements());
+	}
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+		switchStmt->setExp(this->fold(switchStmt->getExp()));
+
+		for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+		{
+			(*it)->setExp(this->fold((*it)->getExp()));
+			this->foldStatements((*it)->getStatements());
+		}
+
+		this->foldStatements(switchStmt->getDefault());
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		this->foldStatements(block->getStatements());
+}
+
+
+lp::ExpNode *lp::Optimizer::fold(lp::ExpNode *node)
+{
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		std::map<int, lp::ExpNode *>::iterator value = this->_values.find(var->getSlot());
+
+		if (value == this->_values.end())
+			return node;
+
+		this->_propagated++;
+
+		// Every use gets its own literal, with the line of the variable
+		lp::ExpNode *result = this->literal(value->second);
+		result->_lineNumber = var->_lineNumber;
+		return result;
+	}
+
+	if (dynamic_cast<lp::ConstantNode *>(node))
+	{
+		int type = node->inferType();
+
+		if ((type != NUMBER) and (type != BOOL))
+			return node;
+	}
+	else if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+	{
+		unary->setExp(this->fold(unary->getExp()));
+
+		if (not isLiteral(unary->getExp()) or (node->inferType() == 0) or not isSafe(node))
+			return node;
+	}
+	else if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+	{
+		binary->setLeft(this->fold(binary->getLeft()));
+		binary->setRight(this->fold(binary->getRight()));
+
+		if (not isLiteral(binary->getLeft()) or not isLiteral(binary->getRight())
+			or (node->inferType() == 0) or not isSafe(node))
+			return node;
+	}
+	else
+	{
+		// The arguments of the functions are folded, but not the calls,
+		// because the mathematical functions can report errors
+		if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+			f->setExp(this->fold(f->getExp()));
+		else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		{
+			f->setExp1(this->fold(f->getExp1()));
+			f->setExp2(this->fold(f->getExp2()));
+		}
+
+		return node;
+	}
+
+	// The replaced nodes are left as they are, like the rest of the AST
+	this->_folded++;
+	return this->literal(node);
+}
+
+
+lp::ExpNode *lp::Optimizer::literal(lp::ExpNode *node)
+{
+	lp::Value value = node->evaluate();
+
+	switch (value.getTag())
+	{
+		case lp::Value::NUMBER:
+			return new lp::NumberNode(value.getNumber(), node->_lineNumber);
+		case lp::Value::BOOL:
+			return new lp::BoolNode(value.getBool(), node->_lineNumber);
+		case lp::Value::STRING:
+		{
+			lp::StringNode *literal = new lp::StringNode(value.getString(), node->_lineNumber);
+
+			// Its string is destroyed with the arena
+			if (arena != NULL)
+				arena->adopt(literal);
+
+			return literal;
+		}
+	}
+
+	return node;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Optimizer::hoistStatements(std::list<lp::Statement *> *stmts)
+{
+	if (stmts == NULL)
+		return;
+
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		this->hoistStatement(*it);
+}
+
+
+void lp::Optimizer::hoistStatement(lp::Statement *stmt)
+{
+	std::map<int, int> writes;
+	std::list<lp::InvariantNode *> invariants;
+
+	// Only the conditions and the upper bound of the for statements are evaluated
+	// in every iteration; the initial value and the step are evaluated once
+	if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		countWrites(whileStmt->getStatements(), writes);
+		whileStmt->setCondition(this->hoist(whileStmt->getCondition(), writes, &invariants));
+		whileStmt->setInvariants(keep(invariants));
+
+		this->hoistStatements(whileStmt->getStatements());
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		countWrites(doWhile->getStatements(), writes);
+		doWhile->setCondition(this->hoist(doWhile->getCondition(), writes, &invariants));
+		doWhile->setInvariants(keep(invariants));
+
+		this->hoistStatements(doWhile->getStatements());
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		countWrites(repeat->getStatements(), writes);
+		repeat->setCondition(this->hoist(repeat->getCondition(), writes, &invariants));
+		repeat->setInvariants(keep(invariants));
+
+		this->hoistStatements(repeat->getStatements());
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		// The loop variable is written by the loop itself
+		countWrites(forStmt, writes);
+		forStmt->setTo(this->hoist(forStmt->getTo(), writes, &invariants));
+		forStmt->setInvariants(keep(invariants));
+
+		this->hoistStatements(forStmt->getStatements());
+	}
+	else
+	{
+		if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+		{
+			this->hoistStatements(ifStmt->getConsequent());
+			this->hoistStatements(ifStmt->getAlternative());
+		}
+		else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+		{
+			std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+			for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+				this->hoistStatements((*it)->getStatements());
+
+			this->hoistStatements(switchStmt->getDefault());
+		}
+		else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+			this->hoistStatements(block->getStatements());
+	}
+}
+
+
+lp::ExpNode *lp::Optimizer::hoist(lp::ExpNode *node, std::map<int, int> const & writes,
+                                  std::list<lp::InvariantNode *> *invariants)
+{
+	// The literals are already as fast as the kept values
+	if (isLiteral(node) or dynamic_cast<lp::ConstantNode *>(node))
+		return node;
+
+	if (isInvariant(node, writes))
+	{
+		lp::InvariantNode *invariant = new lp::InvariantNode(node);
+
+		// Its kept value is destroyed with the arena
+		if (arena != NULL)
+			arena->adopt(invariant);
+
+		invariants->push_back(invariant);
+		this->_hoisted++;
+		return invariant;
+	}
+
+	// The largest invariant parts of the expression are hoisted
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		unary->setExp(this->hoist(unary->getExp(), writes, invariants));
+	else if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+	{
+		binary->setLeft(this->hoist(binary->getLeft(), writes, invariants));
+		binary->setRight(this->hoist(binary->getRight(), writes, invariants));
+	}
+	else if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		f->setExp(this->hoist(f->getExp(), writes, invariants));
+	else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		f->setExp1(this->hoist(f->getExp1(), writes, invariants));
+		f->setExp2(this->hoist(f->getExp2(), writes, invariants));
+	}
+
+	return node;
+}
+
+
+std::list<lp::InvariantNode *> *lp::Optimizer::keep(std::list<lp::InvariantNode *> & invariants)
+{
+	if (invariants.empty())
+		return NULL;
+
+	// The list of the loop is destroyed with the arena, as its nodes
+	std::list<lp::InvariantNode *> *kept = (arena != NULL) ? arena->create<std::list<lp::InvariantNode *> >()
+	                                                        : new std::list<lp::InvariantNode *>;
+
+	kept->swap(invariants);
+	return kept;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+int lp::Optimizer::countNodes(lp::AST *root)
+{
+	return countNodes(root->getStatements());
+}
+
+
+int lp::Optimizer::countNodes(std::list<lp::Statement *> *stmts)
+{
+	int result = 0;
+
+	if (stmts != NULL)
+		for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+			result += countNodes(*it);
+
+	return result;
+}
+
+
+int lp::Optimizer::countNodes(lp::Statement *stmt)
+{
+	int result = 1;
+
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		if (asgn->getAssignment() != NULL)
+			result += countNodes(asgn->getAssignment());
+		else
+			result += countNodes(asgn->getExp());
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+		result += countNodes(plus->getExp());
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+		result += countNodes(minus->getExp());
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+		result += countNodes(print->getExp());
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+		result += countNodes(ifStmt->getCondition()) + countNodes(ifStmt->getConsequent())
+			+ countNodes(ifStmt->getAlternative());
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+		result += countNodes(whileStmt->getCondition()) + countNodes(whileStmt->getStatements());
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+		result += countNodes(doWhile->getCondition()) + countNodes(doWhile->getStatements());
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+		result += countNodes(repeat->getCondition()) + countNodes(repeat->getStatements());
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		result += countNodes(forStmt->getFrom()) + countNodes(forStmt->getTo())
+			+ countNodes(forStmt->getStatements());
+
+		if (forStmt->getStep() != NULL)
+			result += countNodes(forStmt->getStep());
+	}
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		std::list<lp::CaseStmt *> *cases = switchStmt->getCases();
+
+		result += countNodes(switchStmt->getExp()) + countNodes(switchStmt->getDefault());
+
+		for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+			result += 1 + countNodes((*it)->getExp()) + countNodes((*it)->getStatements());
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+		result += countNodes(block->getStatements());
+	else if (lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt))
+		result += countNodes(inc->getExp());
+	else if (lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt))
+		result += countNodes(dec->getExp());
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+		result += countNodes(fact->getExp());
+
+	return result;
+}
+
+
+int lp::Optimizer::countNodes(lp::ExpNode *node)
+{
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		return 1 + countNodes(unary->getExp());
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+		return 1 + countNodes(binary->getLeft()) + countNodes(binary->getRight());
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return 1 + countNodes(f->getExp());
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return 1 + countNodes(f->getExp1()) + countNodes(f->getExp2());
+
+	if (lp::InvariantNode *invariant = dynamic_cast<lp::InvariantNode *>(node))
+		return 1 + countNodes(invariant->getExp());
+
+	// Leaves: variables, constants, literals and random
+	return 1;
+}
@@ -0,0 +1,132 @@
+/*!
+	\file    optimizer.hpp
+	\brief   Declaration of the optimizer of the AST
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _OPTIMIZER_HPP_
+#define _OPTIMIZER_HPP_
+
+#include <list>
+#include <map>
+
+#include "../ast/ast.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Optimizer
+  \brief Rewriting of the AST of a program before it is run
+  \note  Level 1 folds the constant subexpressions into literals and
+         propagates the values of the variables that are assigned once.
+         A subexpression is only folded when its evaluation cannot report
+         an error, so that the errors are still reported when the program runs.
+         Level 2 also hoists out of the loops the parts of their conditions
+         and bounds that their bodies cannot change.
+*/
+class Optimizer
+{
+	private:
+		int _level;                              //!< Level of optimization, 0 does nothing
+		int _folded;                             //!< Number of expressions folded into literals
+		int _propagated;                         //!< Number of variables replaced by their values
+		int _hoisted;                            //!< Number of expressions hoisted out of the loops
+		std::map<int, int> _writes;              //!< Number of statements that write each slot
+		std::map<int, lp::ExpNode *> _values;    //!< Literal value of the slots that are assigned once
+
+	public:
+
+	/*!
+		\brief Constructor of Optimizer
+		\param level: level of optimization
+	*/
+		Optimizer(int level): _level(level), _folded(0), _propagated(0), _hoisted(0)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Optimize the whole program
+		\param   root: AST of the program, before it is analyzed
+		\return  void
+	*/
+		void optimize(lp::AST *root);
+
+	/*!
+		\brief   Number of expressions folded into literals
+		\return  int
+	*/
+		inline int getFolded() const
+		{
+			return this->_folded;
+		}
+
+	/*!
+		\brief   Number of uses of variables replaced by their values
+		\return  int
+	*/
+		inline int getPropagated() const
+		{
+			return this->_propagated;
+		}
+
+	/*!
+		\brief   Number of expressions hoisted out of the loops
+		\return  int
+	*/
+		inline int getHoisted() const
+		{
+			return this->_hoisted;
+		}
+
+	/*!
+		\brief   Number of statements and expressions of a program
+		\param   root: AST of the program
+		\return  int
+	*/
+		static int countNodes(lp::AST *root);
+
+	private:
+
+	/*!
+		\name Writes of the variables
+	*/
+		static void countWrites(std::list<lp::Statement *> *stmts, std::map<int, int> &writes);
+		static void countWrites(lp::Statement *stmt, std::map<int, int> &writes);
+
+	/*!
+		\name Folding and propagation
+	*/
+		void foldStatements(std::list<lp::Statement *> *stmts);
+		void foldStatement(lp::Statement *stmt);
+		lp::ExpNode *fold(lp::ExpNode *node);
+		lp::ExpNode *literal(lp::ExpNode *node);
+
+	/*!
+		\name Hoisting of the loop invariants
+	*/
+		void hoistStatements(std::list<lp::Statement *> *stmts);
+		void hoistStatement(lp::Statement *stmt);
+		lp::ExpNode *hoist(lp::ExpNode *node, std::map<int, int> const & writes, std::list<lp::InvariantNode *> *invariants);
+		static std::list<lp::InvariantNode *> *keep(std::list<lp::InvariantNode *> & invariants);
+
+	/*!
+		\name Counters of nodes
+	*/
+		static int countNodes(std::list<lp::Statement *> *stmts);
+		static int countNodes(lp::Statement *stmt);
+		static int countNodes(lp::ExpNode *node);
+};
+
+// End of name space lp
+}
+
+// End of _OPTIMIZER_HPP_
+#endif
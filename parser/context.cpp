@@ -0,0 +1,83 @@
+/*!
+	\file    context.cpp
+	\brief   Code of the functions of the Context class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <cstddef>
+#include <string>
+
+/*
+  AST class
+  IMPORTANT: must be written before interpreter.tab.h
+*/
+#include "../ast/ast.hpp"
+
+#include "interpreter.tab.h"
+#include "context.hpp"
+
+// Functions of the reentrant scanner, generated by flex
+typedef void *yyscan_t;
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+
+extern int yylex_init_extra(lp::Context *extra, yyscan_t *scanner);
+extern int yylex_destroy(yyscan_t scanner);
+extern int yylex(YYSTYPE *lvalp, YYLTYPE *llocp, yyscan_t scanner);
+extern YY_BUFFER_STATE yy_scan_buffer(char *base, size_t size, yyscan_t scanner);
+extern void yy_delete_buffer(YY_BUFFER_STATE buffer, yyscan_t scanner);
+
+
+lp::Context::Context(lp::LineRing *lines, bool immediate)
+{
+	this->arena = NULL;
+	this->root = NULL;
+	this->immediate = immediate;
+	this->fuser = NULL;
+	this->control = 0;
+	this->lineNumber = 1;
+	this->columnNumber = 1;
+	this->lines = lines;
+	this->_scanner = NULL;
+	this->_buffer = NULL;
+
+	yylex_init_extra(this, &this->_scanner);
+}
+
+
+lp::Context::~Context()
+{
+	if (this->_buffer != NULL)
+		yy_delete_buffer((YY_BUFFER_STATE) this->_buffer, this->_scanner);
+
+	yylex_destroy(this->_scanner);
+}
+
+
+void lp::Context::scanBuffer(char *text, size_t size)
+{
+	if (this->_buffer != NULL)
+		yy_delete_buffer((YY_BUFFER_STATE) this->_buffer, this->_scanner);
+
+	this->_buffer = yy_scan_buffer(text, size + 2, this->_scanner);
+}
+
+
+int lp::Context::parse()
+{
+	return yyparse(this->_scanner, this);
+}
+
+
+unsigned long lp::Context::countTokens()
+{
+	YYSTYPE value;
+	YYLTYPE location;
+	unsigned long count = 0;
+
+	while (yylex(&value, &location, this->_scanner) != 0)
+		count++;
+
+	return count;
+}
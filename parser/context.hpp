@@ -0,0 +1,107 @@
+/*!
+	\file    context.hpp
+	\brief   Declaration of the context of a parse: the state of its scanner and its parser
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _CONTEXT_HPP_
+#define _CONTEXT_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "../error/lineRing.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+class AST;
+class Arena;
+class Fuser;
+
+/*!
+  \class Context
+  \brief State of the reentrant scanner and the pure parser: the AST being built and the positions of the errors
+  \note  Only the state of the scanner and the parser is kept here. The table
+         of symbols, where the scanner interns the identifiers, the state of
+         the errors (fileName, source, recentLines, errorMsg and suggestion,
+         and the exit of the process on any error) and, in immediate mode,
+         the evaluation of the statements (columnNumber, typeEpoch and the
+         global arena) are still global to the process, so two contexts do
+         not parse independently of each other.
+*/
+class Context
+{
+	public:
+		lp::Arena *arena;           //!< Arena of the nodes of the program
+		lp::AST *root;              //!< AST of the program, NULL until it is parsed
+		bool immediate;             //!< Each statement is evaluated as soon as it is parsed: interactive mode and --stream
+		lp::Fuser *fuser;           //!< Fusion of the statements evaluated in immediate mode, NULL if they are not fused
+		int control;                //!< Depth of the control statements being parsed: their statements wait until they end
+		int lineNumber;             //!< Line counter of the scanner, set to the line of each statement parsed
+		int columnNumber;           //!< Column counter of the scanner
+		std::string errorMsg;       //!< Message of the lexical error being scanned
+		std::string identifier;     //!< Last identifier scanned, in lowercase: it keeps its memory between tokens
+		lp::LineRing *lines;        //!< Ring where the scanner keeps the last lines, shown by the errors
+
+	private:
+		void *_scanner;             //!< Reentrant scanner (yyscan_t)
+		void *_buffer;              //!< Buffer scanned in place (YY_BUFFER_STATE), or NULL to read the standard input
+
+	public:
+
+	/*!
+		\brief Constructor of Context
+		\param lines: ring of the last lines scanned
+		\param immediate: whether each statement is evaluated as soon as it is parsed
+		\post  The scanner reads the standard input until a buffer is given
+	*/
+		Context(lp::LineRing *lines, bool immediate);
+
+	/*!
+		\brief Destructor
+		\post  The scanner is released, but not the arena nor the AST
+	*/
+		~Context();
+
+	/*!
+		\brief   Scan a text in place instead of the standard input
+		\param   text: characters followed by two null characters, which the scanner writes while it runs
+		\param   size: number of characters, without the two null characters
+		\return  void
+	*/
+		void scanBuffer(char *text, size_t size);
+
+	/*!
+		\brief   Parse the program
+		\return  int: 0 if the parse ends at the end of the input
+		\post    root is the AST of the program
+		\sa      yyparse
+	*/
+		int parse();
+
+	/*!
+		\brief   Scan the program without parsing it
+		\return  unsigned long: number of tokens
+		\sa      yylex
+	*/
+		unsigned long countTokens();
+
+	private:
+
+	// Copying a Context would release its scanner twice
+		Context(Context const &);
+		Context & operator=(Context const &);
+};
+
+// End of name space lp
+}
+
+// End of _CONTEXT_HPP_
+#endif
@@ -0,0 +1,3031 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 13 "interpreter.y"
+
+
+/* Standard libraries */
+#include <iostream>
+#include <string>
+
+/* Math library */
+#include <math.h>
+
+/* Recovery of runtime errors */
+#include <setjmp.h>
+#include <signal.h>
+
+/* Error recovery functions */
+#include "../error/error.hpp"
+
+/* Macros for the screen */
+#include "../includes/macros.hpp"
+
+/* AST class */
+#include "../ast/ast.hpp"
+
+/* Fusion of the statements evaluated immediately */
+#include "../opt/fuser.hpp"
+
+/* Globals */
+#include "../includes/globals.hpp"
+
+/* Table of symbol */
+#include "../table/table.hpp"
+#include "../table/numericVariable.hpp"
+#include "../table/logicalVariable.hpp"
+#include "../table/numericConstant.hpp"
+#include "../table/logicalConstant.hpp"
+#include "../table/builtinParameter1.hpp"
+#include "../table/builtinParameter0.hpp"
+#include "../table/builtinParameter2.hpp"
+#include "../table/init.hpp"
+
+/* State of the parse */
+#include "context.hpp"
+
+extern std::string progname; //!<  Program name
+
+/*
+    This is an array type capable of storing the information of a calling environment to be restored later.
+    This information is filled by calling macro setjmp and can be restored by calling function longjmp.
+*/
+jmp_buf begin; //!<  It enables recovery of runtime errors 
+
+extern lp::Table table; //!< Extern Table of Symbols
+
+
+#line 125 "interpreter.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "interpreter.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IF = 3,                         /* IF  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_WHILE = 5,                      /* WHILE  */
+  YYSYMBOL_FOR = 6,                        /* FOR  */
+  YYSYMBOL_REPEAT = 7,                     /* REPEAT  */
+  YYSYMBOL_UNTIL = 8,                      /* UNTIL  */
+  YYSYMBOL_SWITCH = 9,                     /* SWITCH  */
+  YYSYMBOL_CASE = 10,                      /* CASE  */
+  YYSYMBOL_DEFAULT = 11,                   /* DEFAULT  */
+  YYSYMBOL_END_SWITCH = 12,                /* END_SWITCH  */
+  YYSYMBOL_THEN = 13,                      /* THEN  */
+  YYSYMBOL_END_IF = 14,                    /* END_IF  */
+  YYSYMBOL_DO = 15,                        /* DO  */
+  YYSYMBOL_END_WHILE = 16,                 /* END_WHILE  */
+  YYSYMBOL_END_FOR = 17,                   /* END_FOR  */
+  YYSYMBOL_FROM = 18,                      /* FROM  */
+  YYSYMBOL_STEP = 19,                      /* STEP  */
+  YYSYMBOL_TO = 20,                        /* TO  */
+  YYSYMBOL_PRINT = 21,                     /* PRINT  */
+  YYSYMBOL_READ = 22,                      /* READ  */
+  YYSYMBOL_READ_STRING = 23,               /* READ_STRING  */
+  YYSYMBOL_LETFCURLYBRACKET = 24,          /* LETFCURLYBRACKET  */
+  YYSYMBOL_RIGHTCURLYBRACKET = 25,         /* RIGHTCURLYBRACKET  */
+  YYSYMBOL_SEMICOLON = 26,                 /* SEMICOLON  */
+  YYSYMBOL_COLON = 27,                     /* COLON  */
+  YYSYMBOL_COMMA = 28,                     /* COMMA  */
+  YYSYMBOL_CLEAR_SCREEN = 29,              /* CLEAR_SCREEN  */
+  YYSYMBOL_PLACE = 30,                     /* PLACE  */
+  YYSYMBOL_RANDOM = 31,                    /* RANDOM  */
+  YYSYMBOL_NUMBER = 32,                    /* NUMBER  */
+  YYSYMBOL_STRING = 33,                    /* STRING  */
+  YYSYMBOL_BOOL = 34,                      /* BOOL  */
+  YYSYMBOL_VARIABLE = 35,                  /* VARIABLE  */
+  YYSYMBOL_UNDEFINED = 36,                 /* UNDEFINED  */
+  YYSYMBOL_CONSTANT = 37,                  /* CONSTANT  */
+  YYSYMBOL_BUILTIN = 38,                   /* BUILTIN  */
+  YYSYMBOL_ASSIGNMENT = 39,                /* ASSIGNMENT  */
+  YYSYMBOL_PLUS_ASSIGNMENT = 40,           /* PLUS_ASSIGNMENT  */
+  YYSYMBOL_MINUS_ASSIGNMENT = 41,          /* MINUS_ASSIGNMENT  */
+  YYSYMBOL_OR = 42,                        /* OR  */
+  YYSYMBOL_AND = 43,                       /* AND  */
+  YYSYMBOL_GREATER_OR_EQUAL = 44,          /* GREATER_OR_EQUAL  */
+  YYSYMBOL_LESS_OR_EQUAL = 45,             /* LESS_OR_EQUAL  */
+  YYSYMBOL_GREATER_THAN = 46,              /* GREATER_THAN  */
+  YYSYMBOL_LESS_THAN = 47,                 /* LESS_THAN  */
+  YYSYMBOL_EQUAL = 48,                     /* EQUAL  */
+  YYSYMBOL_NOT_EQUAL = 49,                 /* NOT_EQUAL  */
+  YYSYMBOL_NOT = 50,                       /* NOT  */
+  YYSYMBOL_PLUS = 51,                      /* PLUS  */
+  YYSYMBOL_MINUS = 52,                     /* MINUS  */
+  YYSYMBOL_MULTIPLICATION = 53,            /* MULTIPLICATION  */
+  YYSYMBOL_DIVISION = 54,                  /* DIVISION  */
+  YYSYMBOL_MODULO = 55,                    /* MODULO  */
+  YYSYMBOL_INTEGER_DIVISION = 56,          /* INTEGER_DIVISION  */
+  YYSYMBOL_CONCATENATION = 57,             /* CONCATENATION  */
+  YYSYMBOL_LPAREN = 58,                    /* LPAREN  */
+  YYSYMBOL_RPAREN = 59,                    /* RPAREN  */
+  YYSYMBOL_UNARY = 60,                     /* UNARY  */
+  YYSYMBOL_INCREMENT = 61,                 /* INCREMENT  */
+  YYSYMBOL_DECREMENT = 62,                 /* DECREMENT  */
+  YYSYMBOL_FACTORIAL = 63,                 /* FACTORIAL  */
+  YYSYMBOL_POWER = 64,                     /* POWER  */
+  YYSYMBOL_YYACCEPT = 65,                  /* $accept  */
+  YYSYMBOL_program = 66,                   /* program  */
+  YYSYMBOL_stmtlist = 67,                  /* stmtlist  */
+  YYSYMBOL_stmt = 68,                      /* stmt  */
+  YYSYMBOL_block = 69,                     /* block  */
+  YYSYMBOL_controlSymbol = 70,             /* controlSymbol  */
+  YYSYMBOL_if = 71,                        /* if  */
+  YYSYMBOL_place = 72,                     /* place  */
+  YYSYMBOL_while = 73,                     /* while  */
+  YYSYMBOL_dowhile = 74,                   /* dowhile  */
+  YYSYMBOL_repeat = 75,                    /* repeat  */
+  YYSYMBOL_for = 76,                       /* for  */
+  YYSYMBOL_case = 77,                      /* case  */
+  YYSYMBOL_caselist = 78,                  /* caselist  */
+  YYSYMBOL_switch = 79,                    /* switch  */
+  YYSYMBOL_increment = 80,                 /* increment  */
+  YYSYMBOL_decrement = 81,                 /* decrement  */
+  YYSYMBOL_factorial = 82,                 /* factorial  */
+  YYSYMBOL_cond = 83,                      /* cond  */
+  YYSYMBOL_asgn = 84,                      /* asgn  */
+  YYSYMBOL_print = 85,                     /* print  */
+  YYSYMBOL_read = 86,                      /* read  */
+  YYSYMBOL_exp = 87,                       /* exp  */
+  YYSYMBOL_listOfExp = 88,                 /* listOfExp  */
+  YYSYMBOL_restOfListOfExp = 89            /* restOfListOfExp  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+/* Unqualified %code blocks.  */
+#line 79 "interpreter.y"
+
+/*! 
+    \brief  Lexical or scanner function
+    \param  lvalp: semantic value of the token
+    \param  llocp: location of the token
+    \param  scanner: reentrant scanner of the context
+    \return int
+    \note   C++ requires that yylex returns an int value
+    \sa     yyparse
+*/
+int yylex(YYSTYPE *lvalp, YYLTYPE *llocp, void *scanner);
+
+/*! 
+    \brief  Report a syntax error at the position of the scanner
+    \param  llocp: location of the look-ahead token
+    \param  scanner: reentrant scanner of the context
+    \param  context: state of the parse
+    \param  message: error message of bison
+    \return void
+*/
+void yyerror(YYLTYPE *llocp, void *scanner, lp::Context *context, const char *message);
+
+#line 272 "interpreter.tab.c"
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1070
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  65
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  25
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  83
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  191
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   319
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   199,   199,   211,   215,   240,   250,   258,   263,   268,
+     273,   278,   283,   288,   293,   298,   303,   309,   315,   320,
+     325,   330,   337,   347,   353,   360,   370,   378,   387,   396,
+     406,   413,   422,   431,   434,   443,   450,   460,   469,   478,
+     487,   495,   501,   507,   513,   519,   527,   537,   546,   552,
+     558,   569,   575,   581,   587,   593,   599,   605,   611,   617,
+     623,   629,   635,   641,   647,   653,   659,   695,   701,   707,
+     713,   719,   725,   731,   737,   743,   749,   755,   761,   767,
+     777,   781,   791,   795
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IF", "ELSE", "WHILE",
+  "FOR", "REPEAT", "UNTIL", "SWITCH", "CASE", "DEFAULT", "END_SWITCH",
+  "THEN", "END_IF", "DO", "END_WHILE", "END_FOR", "FROM", "STEP", "TO",
+  "PRINT", "READ", "READ_STRING", "LETFCURLYBRACKET", "RIGHTCURLYBRACKET",
+  "SEMICOLON", "COLON", "COMMA", "CLEAR_SCREEN", "PLACE", "RANDOM",
+  "NUMBER", "STRING", "BOOL", "VARIABLE", "UNDEFINED", "CONSTANT",
+  "BUILTIN", "ASSIGNMENT", "PLUS_ASSIGNMENT", "MINUS_ASSIGNMENT", "OR",
+  "AND", "GREATER_OR_EQUAL", "LESS_OR_EQUAL", "GREATER_THAN", "LESS_THAN",
+  "EQUAL", "NOT_EQUAL", "NOT", "PLUS", "MINUS", "MULTIPLICATION",
+  "DIVISION", "MODULO", "INTEGER_DIVISION", "CONCATENATION", "LPAREN",
+  "RPAREN", "UNARY", "INCREMENT", "DECREMENT", "FACTORIAL", "POWER",
+  "$accept", "program", "stmtlist", "stmt", "block", "controlSymbol", "if",
+  "place", "while", "dowhile", "repeat", "for", "case", "caselist",
+  "switch", "increment", "decrement", "factorial", "cond", "asgn", "print",
+  "read", "exp", "listOfExp", "restOfListOfExp", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-55)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-40)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     -55,    22,   175,   -55,   -55,   -55,   -55,     6,   -55,   -55,
+     -55,   -12,   -16,   -15,   -55,   -55,    18,     3,     4,   -55,
+     -55,   -11,     8,    24,   -12,   -12,   -12,   -12,   -55,   -55,
+     -55,    19,   -55,   -55,   -55,   -55,    34,    57,    58,    61,
+      62,    64,    67,   919,    36,    36,    77,   -55,    38,   -55,
+     -55,   -55,   942,     0,    63,   306,   -55,   -12,   -12,   787,
+     -12,   -12,   787,   -12,    79,   -54,   -54,   804,   -55,   -55,
+     -55,   -55,   -55,   -55,   -55,   -55,   -12,   -12,   -12,   -12,
+     -12,   -12,   -12,   -12,   -12,   -12,   -12,   -12,   -12,   -12,
+     -12,    71,    73,    74,   -12,   -12,    89,    90,   -12,   344,
+     -12,   589,   -55,   -55,   -55,    45,    47,    56,   -55,   693,
+     723,   -55,   942,   942,   942,   -55,   942,   753,    85,   -55,
+     964,   985,  1006,  1006,  1006,  1006,  1006,  1006,     2,     2,
+     -50,   -50,   -50,   -50,   -50,    59,   827,   -55,   -55,   663,
+      36,   850,    36,   -55,   -55,   -55,   -12,   -12,   -12,   -55,
+     -55,   -55,   268,   382,   -12,   -55,   -55,   -55,   873,   896,
+     753,   -55,   -55,   -55,   610,    21,   -55,   -55,   -55,   421,
+     -55,   -12,   -12,   119,   -55,   -55,   -55,   -55,   633,    65,
+     -55,   459,   -55,   -55,   513,   -55,   -55,   229,   -55,   551,
+     -55
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       3,     0,     0,     1,     5,    23,    23,     0,    23,    23,
+      23,     0,     0,     0,     3,     6,     0,     0,     0,    51,
+      52,    64,    65,     0,     0,     0,     0,     0,     4,    15,
+      10,     0,    11,    12,    13,    14,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     3,     0,     3,
+      64,    65,    47,     0,     0,     0,    16,     0,     0,     0,
+       0,     0,     0,    80,    75,    60,    61,     0,    17,    18,
+      19,    20,    21,     7,     8,     9,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    77,    78,    79,     0,     0,     0,     0,     0,     0,
+       0,     0,    77,    78,    79,     0,     0,     0,    22,     0,
+       0,    44,    41,    42,    43,    46,    45,    82,     0,    59,
+      74,    73,    68,    70,    67,    69,    71,    72,    53,    54,
+      55,    56,    62,    57,    58,    63,     0,     3,     3,     0,
+       0,     0,     0,    48,    50,    49,     0,     0,     0,    81,
+      66,    40,     0,     0,     0,    29,    33,    28,     0,     0,
+      82,     3,    24,    27,     0,     0,    26,    76,    83,     0,
+      23,     0,     0,     0,    36,    34,    25,     3,     0,     0,
+       3,     0,    23,     3,     0,    30,     3,     0,    35,     0,
+      31
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+     -55,   -55,   -13,   -55,   -55,    -5,   -55,   -55,   -55,   -55,
+     -55,   -55,   -55,   -55,   -55,   -55,   -55,   -55,   -39,   -35,
+     -55,   -55,    -9,   -55,   -10
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     1,     2,    28,    29,    45,    30,    31,    32,    33,
+      34,    35,   175,   165,    36,    37,    38,    39,    96,    40,
+      41,    42,    43,   118,   149
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      44,    55,    52,    47,    48,    49,    97,   -40,   -40,   -40,
+      94,   102,   103,   104,    94,    64,    65,    66,    67,    18,
+      19,    20,     3,    50,   111,    51,    23,   115,    59,    60,
+      61,   172,   173,   174,    99,   105,   101,   106,    24,    25,
+      26,    46,    53,    54,    56,    68,    27,    62,   109,   110,
+     112,   113,   114,   116,   117,    86,    87,    88,    89,    90,
+      69,    57,    58,   102,   103,   104,    94,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,    63,    70,    71,   135,   136,    72,    73,   139,
+      74,   141,   183,    75,    95,    98,   100,   -37,   107,   -38,
+     -39,   155,   137,   157,   143,   138,   144,    76,    77,    78,
+      79,    80,    81,    82,    83,   145,    84,    85,    86,    87,
+      88,    89,    90,    94,   152,   153,   102,   103,   104,    94,
+      84,    85,    86,    87,    88,    89,    90,   158,   159,   160,
+     102,   103,   104,    94,   150,   164,   180,     0,   169,     0,
+     168,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   178,   179,   181,   177,     0,   184,     0,     0,
+     187,     0,     0,   189,     0,    -2,     4,   186,     5,     0,
+       6,     7,     8,     0,     9,     0,     0,     0,     0,     0,
+      10,     0,     0,     0,     0,     0,    11,    12,    13,    14,
+       0,    15,     0,     0,    16,    17,    18,    19,    20,     0,
+      21,     0,    22,    23,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    24,    25,    26,     0,     0,
+       4,     0,     5,    27,     6,     7,     8,     0,     9,   -32,
+     -32,   -32,     0,     0,    10,     0,     0,     0,     0,     0,
+      11,    12,    13,    14,     0,    15,     0,     0,    16,    17,
+      18,    19,    20,     0,    21,     0,    22,    23,     0,     4,
+       0,     5,   161,     6,     7,     8,     0,     9,     0,    24,
+      25,    26,   162,    10,     0,     0,     0,    27,     0,    11,
+      12,    13,    14,     0,    15,     0,     0,    16,    17,    18,
+      19,    20,     0,    21,     0,    22,    23,     4,     0,     5,
+       0,     6,     7,     8,     0,     9,     0,     0,    24,    25,
+      26,    10,     0,     0,     0,     0,    27,    11,    12,    13,
+      14,   108,    15,     0,     0,    16,    17,    18,    19,    20,
+       0,    21,     0,    22,    23,     4,     0,     5,     0,     6,
+       7,     8,   140,     9,     0,     0,    24,    25,    26,    10,
+       0,     0,     0,     0,    27,    11,    12,    13,    14,     0,
+      15,     0,     0,    16,    17,    18,    19,    20,     0,    21,
+       0,    22,    23,     4,     0,     5,     0,     6,     7,     8,
+       0,     9,     0,     0,    24,    25,    26,    10,   163,     0,
+       0,     0,    27,    11,    12,    13,    14,     0,    15,     0,
+       0,    16,    17,    18,    19,    20,     0,    21,     0,    22,
+      23,     0,     4,     0,     5,     0,     6,     7,     8,     0,
+       9,     0,    24,    25,    26,   176,    10,     0,     0,     0,
+      27,     0,    11,    12,    13,    14,     0,    15,     0,     0,
+      16,    17,    18,    19,    20,     0,    21,     0,    22,    23,
+       4,     0,     5,     0,     6,     7,     8,     0,     9,     0,
+       0,    24,    25,    26,    10,     0,   185,     0,     0,    27,
+      11,    12,    13,    14,     0,    15,     0,     0,    16,    17,
+      18,    19,    20,     0,    21,     0,    22,    23,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,    26,     0,     0,     4,     0,     5,    27,     6,     7,
+       8,     0,     9,     0,     0,   188,     0,     0,    10,     0,
+       0,     0,     0,     0,    11,    12,    13,    14,     0,    15,
+       0,     0,    16,    17,    18,    19,    20,     0,    21,     0,
+      22,    23,     4,     0,     5,     0,     6,     7,     8,     0,
+       9,     0,     0,    24,    25,    26,    10,     0,   190,     0,
+       0,    27,    11,    12,    13,    14,     0,    15,     0,     0,
+      16,    17,    18,    19,    20,     0,    21,     0,    22,    23,
+       4,     0,     5,     0,   142,     7,     8,     0,     9,     0,
+       0,    24,    25,    26,    10,     0,     0,     0,     0,    27,
+      11,    12,    13,    14,     0,    15,     0,     0,    16,    17,
+      18,    19,    20,     0,    21,   170,    22,    23,     0,   171,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    24,
+      25,    26,     0,     0,     0,     0,     0,    27,   182,     0,
+       0,     0,    76,    77,    78,    79,    80,    81,    82,    83,
+       0,    84,    85,    86,    87,    88,    89,    90,     0,     0,
+       0,   102,   103,   104,    94,    76,    77,    78,    79,    80,
+      81,    82,    83,   154,    84,    85,    86,    87,    88,    89,
+      90,     0,     0,     0,   102,   103,   104,    94,     0,     0,
+       0,     0,     0,     0,     0,    76,    77,    78,    79,    80,
+      81,    82,    83,     0,    84,    85,    86,    87,    88,    89,
+      90,   146,     0,     0,   102,   103,   104,    94,     0,     0,
+       0,     0,     0,     0,     0,    76,    77,    78,    79,    80,
+      81,    82,    83,     0,    84,    85,    86,    87,    88,    89,
+      90,   147,     0,     0,   102,   103,   104,    94,     0,     0,
+       0,     0,     0,     0,     0,    76,    77,    78,    79,    80,
+      81,    82,    83,     0,    84,    85,    86,    87,    88,    89,
+      90,   148,     0,     0,   102,   103,   104,    94,     0,     0,
+       0,     0,     0,     0,     0,    76,    77,    78,    79,    80,
+      81,    82,    83,     0,    84,    85,    86,    87,    88,    89,
+      90,     0,     0,     0,   102,   103,   104,    94,    18,    19,
+      20,     0,    21,     0,    22,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    24,    25,    26,
+       0,     0,     0,     0,     0,    27,    76,    77,    78,    79,
+      80,    81,    82,    83,     0,    84,    85,    86,    87,    88,
+      89,    90,     0,   119,     0,   102,   103,   104,    94,    76,
+      77,    78,    79,    80,    81,    82,    83,     0,    84,    85,
+      86,    87,    88,    89,    90,     0,   151,     0,   102,   103,
+     104,    94,    76,    77,    78,    79,    80,    81,    82,    83,
+       0,    84,    85,    86,    87,    88,    89,    90,     0,   156,
+       0,   102,   103,   104,    94,    76,    77,    78,    79,    80,
+      81,    82,    83,     0,    84,    85,    86,    87,    88,    89,
+      90,     0,   166,     0,   102,   103,   104,    94,    76,    77,
+      78,    79,    80,    81,    82,    83,     0,    84,    85,    86,
+      87,    88,    89,    90,     0,   167,     0,   102,   103,   104,
+      94,    76,    77,    78,    79,    80,    81,    82,    83,     0,
+      84,    85,    86,    87,    88,    89,    90,     0,     0,     0,
+      91,    92,    93,    94,    76,    77,    78,    79,    80,    81,
+      82,    83,     0,    84,    85,    86,    87,    88,    89,    90,
+       0,     0,     0,   102,   103,   104,    94,    77,    78,    79,
+      80,    81,    82,    83,     0,    84,    85,    86,    87,    88,
+      89,    90,     0,     0,     0,   102,   103,   104,    94,    78,
+      79,    80,    81,    82,    83,     0,    84,    85,    86,    87,
+      88,    89,    90,     0,     0,     0,   102,   103,   104,    94,
+     -40,   -40,   -40,   -40,   -40,   -40,     0,    84,    85,    86,
+      87,    88,    89,    90,     0,     0,     0,   102,   103,   104,
+      94
+};
+
+static const yytype_int16 yycheck[] =
+{
+       5,    14,    11,     8,     9,    10,    45,    61,    62,    63,
+      64,    61,    62,    63,    64,    24,    25,    26,    27,    31,
+      32,    33,     0,    35,    59,    37,    38,    62,    39,    40,
+      41,    10,    11,    12,    47,    35,    49,    37,    50,    51,
+      52,    35,    58,    58,    26,    26,    58,    39,    57,    58,
+      59,    60,    61,    62,    63,    53,    54,    55,    56,    57,
+      26,    58,    58,    61,    62,    63,    64,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    58,    26,    26,    94,    95,    26,    26,    98,
+      26,   100,    27,    26,    58,    18,    58,    26,    35,    26,
+      26,   140,    13,   142,    59,    15,    59,    42,    43,    44,
+      45,    46,    47,    48,    49,    59,    51,    52,    53,    54,
+      55,    56,    57,    64,   137,   138,    61,    62,    63,    64,
+      51,    52,    53,    54,    55,    56,    57,   146,   147,   148,
+      61,    62,    63,    64,    59,   154,    27,    -1,   161,    -1,
+     160,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   171,   172,   177,   170,    -1,   180,    -1,    -1,
+     183,    -1,    -1,   186,    -1,     0,     1,   182,     3,    -1,
+       5,     6,     7,    -1,     9,    -1,    -1,    -1,    -1,    -1,
+      15,    -1,    -1,    -1,    -1,    -1,    21,    22,    23,    24,
+      -1,    26,    -1,    -1,    29,    30,    31,    32,    33,    -1,
+      35,    -1,    37,    38,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    50,    51,    52,    -1,    -1,
+       1,    -1,     3,    58,     5,     6,     7,    -1,     9,    10,
+      11,    12,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,
+      21,    22,    23,    24,    -1,    26,    -1,    -1,    29,    30,
+      31,    32,    33,    -1,    35,    -1,    37,    38,    -1,     1,
+      -1,     3,     4,     5,     6,     7,    -1,     9,    -1,    50,
+      51,    52,    14,    15,    -1,    -1,    -1,    58,    -1,    21,
+      22,    23,    24,    -1,    26,    -1,    -1,    29,    30,    31,
+      32,    33,    -1,    35,    -1,    37,    38,     1,    -1,     3,
+      -1,     5,     6,     7,    -1,     9,    -1,    -1,    50,    51,
+      52,    15,    -1,    -1,    -1,    -1,    58,    21,    22,    23,
+      24,    25,    26,    -1,    -1,    29,    30,    31,    32,    33,
+      -1,    35,    -1,    37,    38,     1,    -1,     3,    -1,     5,
+       6,     7,     8,     9,    -1,    -1,    50,    51,    52,    15,
+      -1,    -1,    -1,    -1,    58,    21,    22,    23,    24,    -1,
+      26,    -1,    -1,    29,    30,    31,    32,    33,    -1,    35,
+      -1,    37,    38,     1,    -1,     3,    -1,     5,     6,     7,
+      -1,     9,    -1,    -1,    50,    51,    52,    15,    16,    -1,
+      -1,    -1,    58,    21,    22,    23,    24,    -1,    26,    -1,
+      -1,    29,    30,    31,    32,    33,    -1,    35,    -1,    37,
+      38,    -1,     1,    -1,     3,    -1,     5,     6,     7,    -1,
+       9,    -1,    50,    51,    52,    14,    15,    -1,    -1,    -1,
+      58,    -1,    21,    22,    23,    24,    -1,    26,    -1,    -1,
+      29,    30,    31,    32,    33,    -1,    35,    -1,    37,    38,
+       1,    -1,     3,    -1,     5,     6,     7,    -1,     9,    -1,
+      -1,    50,    51,    52,    15,    -1,    17,    -1,    -1,    58,
+      21,    22,    23,    24,    -1,    26,    -1,    -1,    29,    30,
+      31,    32,    33,    -1,    35,    -1,    37,    38,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,
+      51,    52,    -1,    -1,     1,    -1,     3,    58,     5,     6,
+       7,    -1,     9,    -1,    -1,    12,    -1,    -1,    15,    -1,
+      -1,    -1,    -1,    -1,    21,    22,    23,    24,    -1,    26,
+      -1,    -1,    29,    30,    31,    32,    33,    -1,    35,    -1,
+      37,    38,     1,    -1,     3,    -1,     5,     6,     7,    -1,
+       9,    -1,    -1,    50,    51,    52,    15,    -1,    17,    -1,
+      -1,    58,    21,    22,    23,    24,    -1,    26,    -1,    -1,
+      29,    30,    31,    32,    33,    -1,    35,    -1,    37,    38,
+       1,    -1,     3,    -1,     5,     6,     7,    -1,     9,    -1,
+      -1,    50,    51,    52,    15,    -1,    -1,    -1,    -1,    58,
+      21,    22,    23,    24,    -1,    26,    -1,    -1,    29,    30,
+      31,    32,    33,    -1,    35,    15,    37,    38,    -1,    19,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,
+      51,    52,    -1,    -1,    -1,    -1,    -1,    58,    15,    -1,
+      -1,    -1,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    57,    -1,    -1,
+      -1,    61,    62,    63,    64,    42,    43,    44,    45,    46,
+      47,    48,    49,    20,    51,    52,    53,    54,    55,    56,
+      57,    -1,    -1,    -1,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    28,    -1,    -1,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    28,    -1,    -1,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    28,    -1,    -1,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    -1,    -1,    -1,    61,    62,    63,    64,    31,    32,
+      33,    -1,    35,    -1,    37,    38,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    50,    51,    52,
+      -1,    -1,    -1,    -1,    -1,    58,    42,    43,    44,    45,
+      46,    47,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    57,    -1,    59,    -1,    61,    62,    63,    64,    42,
+      43,    44,    45,    46,    47,    48,    49,    -1,    51,    52,
+      53,    54,    55,    56,    57,    -1,    59,    -1,    61,    62,
+      63,    64,    42,    43,    44,    45,    46,    47,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    57,    -1,    59,
+      -1,    61,    62,    63,    64,    42,    43,    44,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    -1,    59,    -1,    61,    62,    63,    64,    42,    43,
+      44,    45,    46,    47,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    57,    -1,    59,    -1,    61,    62,    63,
+      64,    42,    43,    44,    45,    46,    47,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    57,    -1,    -1,    -1,
+      61,    62,    63,    64,    42,    43,    44,    45,    46,    47,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    57,
+      -1,    -1,    -1,    61,    62,    63,    64,    43,    44,    45,
+      46,    47,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    57,    -1,    -1,    -1,    61,    62,    63,    64,    44,
+      45,    46,    47,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    57,    -1,    -1,    -1,    61,    62,    63,    64,
+      44,    45,    46,    47,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    57,    -1,    -1,    -1,    61,    62,    63,
+      64
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    66,    67,     0,     1,     3,     5,     6,     7,     9,
+      15,    21,    22,    23,    24,    26,    29,    30,    31,    32,
+      33,    35,    37,    38,    50,    51,    52,    58,    68,    69,
+      71,    72,    73,    74,    75,    76,    79,    80,    81,    82,
+      84,    85,    86,    87,    70,    70,    35,    70,    70,    70,
+      35,    37,    87,    58,    58,    67,    26,    58,    58,    39,
+      40,    41,    39,    58,    87,    87,    87,    87,    26,    26,
+      26,    26,    26,    26,    26,    26,    42,    43,    44,    45,
+      46,    47,    48,    49,    51,    52,    53,    54,    55,    56,
+      57,    61,    62,    63,    64,    58,    83,    83,    18,    67,
+      58,    67,    61,    62,    63,    35,    37,    35,    25,    87,
+      87,    84,    87,    87,    87,    84,    87,    87,    88,    59,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    13,    15,    87,
+       8,    87,     5,    59,    59,    59,    28,    28,    28,    89,
+      59,    59,    67,    67,    20,    83,    59,    83,    87,    87,
+      87,     4,    14,    16,    87,    78,    59,    59,    89,    67,
+      15,    19,    10,    11,    12,    77,    14,    70,    87,    87,
+      27,    67,    15,    27,    67,    17,    70,    67,    12,    67,
+      17
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    65,    66,    67,    67,    67,    68,    68,    68,    68,
+      68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
+      68,    68,    69,    70,    71,    71,    72,    73,    74,    75,
+      76,    76,    77,    78,    78,    79,    79,    80,    81,    82,
+      83,    84,    84,    84,    84,    84,    84,    85,    86,    86,
+      86,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
+      88,    88,    89,    89
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     2,     2,     1,     2,     2,     2,
+       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     2,     3,     0,     6,     8,     6,     6,     5,     5,
+      10,    12,     4,     0,     2,    10,     7,     2,     2,     2,
+       3,     3,     3,     3,     3,     3,     3,     2,     4,     4,
+       4,     1,     1,     3,     3,     3,     3,     3,     3,     3,
+       2,     2,     3,     3,     1,     1,     4,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     6,     2,     2,     2,
+       0,     2,     0,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, scanner, context, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, scanner, context); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void *scanner, lp::Context *context)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (context);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void *scanner, lp::Context *context)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, scanner, context);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, void *scanner, lp::Context *context)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), scanner, context);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, scanner, context); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+  YYLTYPE *yylloc;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, void *scanner, lp::Context *context)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  YY_USE (context);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void *scanner, lp::Context *context)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: stmtlist  */
+#line 200 "interpreter.y"
+          { 
+            // Create a new AST from the list of statements, which owns the arena of its nodes
+            (yyval.prog) = new lp::AST((yyvsp[0].stmts), context->arena); 
+            // Assign the AST to the root pointer
+            context->root = (yyval.prog); 
+            // End of parsing
+          }
+#line 1935 "interpreter.tab.c"
+    break;
+
+  case 3: /* stmtlist: %empty  */
+#line 211 "interpreter.y"
+    { 
+      // Create an empty list of statements
+      (yyval.stmts) = context->arena->create<std::list<lp::Statement *> >(); 
+    }
+#line 1944 "interpreter.tab.c"
+    break;
+
+  case 4: /* stmtlist: stmtlist stmt  */
+#line 216 "interpreter.y"
+    { 
+      // Add the new statement to the list
+      (yyval.stmts) = (yyvsp[-1].stmts);
+      (yyval.stmts)->push_back((yyvsp[0].st));
+      // In the interactive mode and with --stream, evaluate the statements immediately
+      if (context->immediate == true && context->control == 0)
+      {
+        // The errors of the evaluation show the column where the scanner is
+        columnNumber = context->columnNumber;
+
+        for(std::list<lp::Statement *>::iterator it = (yyval.stmts)->begin(); it != (yyval.stmts)->end(); it++)
+        {
+          // As the whole programs, the common statements run as fused nodes
+          if (context->fuser != NULL)
+            *it = context->fuser->fuse(*it);
+
+          (*it)->analyze();
+          (*it)->freeze();
+          (*it)->evaluate();
+        }
+        // Clear the AST code, as it has already run
+        (yyval.stmts)->clear();
+      }
+    }
+#line 1973 "interpreter.tab.c"
+    break;
+
+  case 5: /* stmtlist: stmtlist error  */
+#line 241 "interpreter.y"
+    { 
+      // On error, just copy up the statement list
+      (yyval.stmts) = (yyvsp[-1].stmts);
+      // Discard the previous look-ahead token
+      yyclearin; 
+    }
+#line 1984 "interpreter.tab.c"
+    break;
+
+  case 6: /* stmt: SEMICOLON  */
+#line 251 "interpreter.y"
+      {
+        // Empty statement: ";"
+        // Update lineNumber for error control
+        context->lineNumber = (yylsp[0]).first_line;
+        // Create a new empty statement node
+        (yyval.st) = new (context->arena) lp::EmptyStmt(context->lineNumber); 
+      }
+#line 1996 "interpreter.tab.c"
+    break;
+
+  case 7: /* stmt: asgn SEMICOLON  */
+#line 259 "interpreter.y"
+      {
+        // Assignment statement
+        context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2005 "interpreter.tab.c"
+    break;
+
+  case 8: /* stmt: print SEMICOLON  */
+#line 264 "interpreter.y"
+      {
+        // Print statement
+        context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2014 "interpreter.tab.c"
+    break;
+
+  case 9: /* stmt: read SEMICOLON  */
+#line 269 "interpreter.y"
+      {
+        // Read statement
+        context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2023 "interpreter.tab.c"
+    break;
+
+  case 10: /* stmt: if  */
+#line 274 "interpreter.y"
+      {
+        // If statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2032 "interpreter.tab.c"
+    break;
+
+  case 11: /* stmt: while  */
+#line 279 "interpreter.y"
+      {
+        // While statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2041 "interpreter.tab.c"
+    break;
+
+  case 12: /* stmt: dowhile  */
+#line 284 "interpreter.y"
+      {
+        // Do-while statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2050 "interpreter.tab.c"
+    break;
+
+  case 13: /* stmt: repeat  */
+#line 289 "interpreter.y"
+      {
+        // Repeat statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2059 "interpreter.tab.c"
+    break;
+
+  case 14: /* stmt: for  */
+#line 294 "interpreter.y"
+      {
+        // For statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2068 "interpreter.tab.c"
+    break;
+
+  case 15: /* stmt: block  */
+#line 299 "interpreter.y"
+      {
+        // Block statement
+        context->lineNumber = (yylsp[0]).first_line;
+      }
+#line 2077 "interpreter.tab.c"
+    break;
+
+  case 16: /* stmt: CLEAR_SCREEN SEMICOLON  */
+#line 304 "interpreter.y"
+      {
+        // Clear screen statement
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = new (context->arena) lp::ClearScreenStmt();
+      }
+#line 2087 "interpreter.tab.c"
+    break;
+
+  case 17: /* stmt: place SEMICOLON  */
+#line 310 "interpreter.y"
+      {
+        // Place statement
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = (yyvsp[-1].st);
+      }
+#line 2097 "interpreter.tab.c"
+    break;
+
+  case 18: /* stmt: switch SEMICOLON  */
+#line 316 "interpreter.y"
+      {
+        // Switch statement
+        context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2106 "interpreter.tab.c"
+    break;
+
+  case 19: /* stmt: increment SEMICOLON  */
+#line 321 "interpreter.y"
+      {
+          // Increment statement
+          context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2115 "interpreter.tab.c"
+    break;
+
+  case 20: /* stmt: decrement SEMICOLON  */
+#line 326 "interpreter.y"
+      {
+          // Decrement statement
+          context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2124 "interpreter.tab.c"
+    break;
+
+  case 21: /* stmt: factorial SEMICOLON  */
+#line 331 "interpreter.y"
+      {
+          // Factorial statement
+          context->lineNumber = (yylsp[-1]).first_line;
+      }
+#line 2133 "interpreter.tab.c"
+    break;
+
+  case 22: /* block: LETFCURLYBRACKET stmtlist RIGHTCURLYBRACKET  */
+#line 338 "interpreter.y"
+        {
+            // Block of statements delimited by curly brackets
+            context->lineNumber = (yylsp[-2]).first_line;
+            (yyval.st) = new (context->arena) lp::BlockStmt((yyvsp[-1].stmts), context->lineNumber);
+        }
+#line 2143 "interpreter.tab.c"
+    break;
+
+  case 23: /* controlSymbol: %empty  */
+#line 347 "interpreter.y"
+    {
+        context->control++;
+    }
+#line 2151 "interpreter.tab.c"
+    break;
+
+  case 24: /* if: IF controlSymbol cond THEN stmtlist END_IF  */
+#line 354 "interpreter.y"
+    {
+        // If statement without else
+        context->lineNumber = (yylsp[-5]).first_line;
+        (yyval.st) = new (context->arena) lp::IfStmt((yyvsp[-3].expNode), (yyvsp[-1].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2162 "interpreter.tab.c"
+    break;
+
+  case 25: /* if: IF controlSymbol cond THEN stmtlist ELSE stmtlist END_IF  */
+#line 361 "interpreter.y"
+    {
+        // If-else statement
+        context->lineNumber = (yylsp[-7]).first_line;
+        (yyval.st) = new (context->arena) lp::IfStmt((yyvsp[-5].expNode), (yyvsp[-3].stmts), (yyvsp[-1].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2173 "interpreter.tab.c"
+    break;
+
+  case 26: /* place: PLACE LPAREN exp COMMA exp RPAREN  */
+#line 371 "interpreter.y"
+    {
+        // Place statement for screen positioning
+        context->lineNumber = (yylsp[-5]).first_line;
+        (yyval.st) = new (context->arena) lp::PlaceStmt((yyvsp[-3].expNode), (yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2183 "interpreter.tab.c"
+    break;
+
+  case 27: /* while: WHILE controlSymbol cond DO stmtlist END_WHILE  */
+#line 379 "interpreter.y"
+    {
+        // While loop
+        context->lineNumber = (yylsp[-5]).first_line;
+        (yyval.st) = new (context->arena) lp::WhileStmt((yyvsp[-3].expNode), (yyvsp[-1].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2194 "interpreter.tab.c"
+    break;
+
+  case 28: /* dowhile: DO controlSymbol stmtlist WHILE cond  */
+#line 388 "interpreter.y"
+    {
+        // While loop
+        context->lineNumber = (yylsp[-4]).first_line;
+        (yyval.st) = new (context->arena) lp::DoWhileStmt((yyvsp[0].expNode), (yyvsp[-2].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2205 "interpreter.tab.c"
+    break;
+
+  case 29: /* repeat: REPEAT controlSymbol stmtlist UNTIL cond  */
+#line 397 "interpreter.y"
+    {
+        // Repeat-until loop
+        context->lineNumber = (yylsp[-4]).first_line;
+        (yyval.st) = new (context->arena) lp::RepeatStmt((yyvsp[-2].stmts), (yyvsp[0].expNode), context->lineNumber);
+        context->control--;
+    }
+#line 2216 "interpreter.tab.c"
+    break;
+
+  case 30: /* for: FOR VARIABLE FROM exp TO exp DO controlSymbol stmtlist END_FOR  */
+#line 407 "interpreter.y"
+    {
+        // For loop without step
+        context->lineNumber = (yylsp[-9]).first_line;
+        (yyval.st) = new (context->arena) lp::ForStmt((yyvsp[-8].slot), (yyvsp[-6].expNode), (yyvsp[-4].expNode), (yyvsp[-1].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2227 "interpreter.tab.c"
+    break;
+
+  case 31: /* for: FOR VARIABLE FROM exp TO exp STEP exp DO controlSymbol stmtlist END_FOR  */
+#line 414 "interpreter.y"
+    {
+        // For loop with step
+        context->lineNumber = (yylsp[-11]).first_line;
+        (yyval.st) = new (context->arena) lp::ForStmt((yyvsp[-10].slot), (yyvsp[-8].expNode), (yyvsp[-6].expNode), (yyvsp[-4].expNode), (yyvsp[-1].stmts), context->lineNumber);
+        context->control--;
+    }
+#line 2238 "interpreter.tab.c"
+    break;
+
+  case 32: /* case: CASE exp COLON stmtlist  */
+#line 423 "interpreter.y"
+    {
+        // Case statement for switch
+        context->lineNumber = (yylsp[-3]).first_line;
+        (yyval.caseStm) = new (context->arena) lp::CaseStmt((yyvsp[-2].expNode), (yyvsp[0].stmts), context->lineNumber);
+    }
+#line 2248 "interpreter.tab.c"
+    break;
+
+  case 33: /* caselist: %empty  */
+#line 431 "interpreter.y"
+    {
+        (yyval.caselistStm) = context->arena->create<std::list<lp::CaseStmt *> >();
+    }
+#line 2256 "interpreter.tab.c"
+    break;
+
+  case 34: /* caselist: caselist case  */
+#line 435 "interpreter.y"
+    {
+        // Add case to the list
+        (yyval.caselistStm) = (yyvsp[-1].caselistStm);
+        (yyval.caselistStm)->push_front((yyvsp[0].caseStm));
+    }
+#line 2266 "interpreter.tab.c"
+    break;
+
+  case 35: /* switch: SWITCH controlSymbol LPAREN exp RPAREN caselist DEFAULT COLON stmtlist END_SWITCH  */
+#line 444 "interpreter.y"
+    {
+        // Switch statement with default case
+        context->lineNumber = (yylsp[-9]).first_line;
+        (yyval.st) = context->arena->adopt(new (context->arena) lp::SwitchStmt((yyvsp[-6].expNode), (yyvsp[-4].caselistStm), (yyvsp[-1].stmts), context->lineNumber));
+        context->control--;
+    }
+#line 2277 "interpreter.tab.c"
+    break;
+
+  case 36: /* switch: SWITCH controlSymbol LPAREN exp RPAREN caselist END_SWITCH  */
+#line 451 "interpreter.y"
+    {
+        // Switch statement without default case
+        context->lineNumber = (yylsp[-6]).first_line;
+        (yyval.st) = context->arena->adopt(new (context->arena) lp::SwitchStmt((yyvsp[-3].expNode), (yyvsp[-1].caselistStm), context->lineNumber));
+        context->control--;
+    }
+#line 2288 "interpreter.tab.c"
+    break;
+
+  case 37: /* increment: exp INCREMENT  */
+#line 461 "interpreter.y"
+    {
+        // Increment variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = new (context->arena) lp::UnaryIncrementStmt((yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2298 "interpreter.tab.c"
+    break;
+
+  case 38: /* decrement: exp DECREMENT  */
+#line 470 "interpreter.y"
+    {
+        // Decrement variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = new (context->arena) lp::UnaryDecrementStmt((yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2308 "interpreter.tab.c"
+    break;
+
+  case 39: /* factorial: exp FACTORIAL  */
+#line 479 "interpreter.y"
+    {
+        // Factorial variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = new (context->arena) lp::UnaryFactorialStmt((yyvsp[-1].expNode), context->lineNumber);        
+    }
+#line 2318 "interpreter.tab.c"
+    break;
+
+  case 40: /* cond: LPAREN exp RPAREN  */
+#line 488 "interpreter.y"
+    {
+        // Parenthesized condition
+        (yyval.expNode) = (yyvsp[-1].expNode);
+    }
+#line 2327 "interpreter.tab.c"
+    break;
+
+  case 41: /* asgn: VARIABLE ASSIGNMENT exp  */
+#line 496 "interpreter.y"
+    {
+        // Assignment to variable
+        context->lineNumber = (yylsp[-2]).first_line;
+        (yyval.st) = new (context->arena) lp::AssignmentStmt((yyvsp[-2].slot), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2337 "interpreter.tab.c"
+    break;
+
+  case 42: /* asgn: VARIABLE PLUS_ASSIGNMENT exp  */
+#line 502 "interpreter.y"
+    {
+        // Plus assignment
+        context->lineNumber = (yylsp[-2]).first_line;
+        (yyval.st) = new (context->arena) lp::PlusAssignmentStmt((yyvsp[-2].slot), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2347 "interpreter.tab.c"
+    break;
+
+  case 43: /* asgn: VARIABLE MINUS_ASSIGNMENT exp  */
+#line 508 "interpreter.y"
+    {
+        // Minus assignment
+        context->lineNumber = (yylsp[-2]).first_line;
+        (yyval.st) = new (context->arena) lp::MinusAssignmentStmt((yyvsp[-2].slot), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2357 "interpreter.tab.c"
+    break;
+
+  case 44: /* asgn: VARIABLE ASSIGNMENT asgn  */
+#line 514 "interpreter.y"
+    {
+        // Multiple assignment to variable
+        context->lineNumber = (yylsp[-2]).first_line;
+        (yyval.st) = new (context->arena) lp::AssignmentStmt((yyvsp[-2].slot), (lp::AssignmentStmt *) (yyvsp[0].st), context->lineNumber);
+    }
+#line 2367 "interpreter.tab.c"
+    break;
+
+  case 45: /* asgn: CONSTANT ASSIGNMENT exp  */
+#line 520 "interpreter.y"
+    {
+        // Error: assignment to constant
+        context->lineNumber = (yylsp[-2]).first_line;
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Assignment to constant is not allowed.",
+                        "Use a variable name instead of a constant if you intend to modify the value.");
+    }
+#line 2379 "interpreter.tab.c"
+    break;
+
+  case 46: /* asgn: CONSTANT ASSIGNMENT asgn  */
+#line 528 "interpreter.y"
+    {
+        // Error: reassignment to constant
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Reassignment to a constant is not allowed.",
+                        "If you need to change the value, consider using a variable instead.");
+    }
+#line 2390 "interpreter.tab.c"
+    break;
+
+  case 47: /* print: PRINT exp  */
+#line 538 "interpreter.y"
+    {
+        // Print statement
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.st) = new (context->arena) lp::PrintStmt((yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2400 "interpreter.tab.c"
+    break;
+
+  case 48: /* read: READ LPAREN VARIABLE RPAREN  */
+#line 547 "interpreter.y"
+    {
+        // Read statement for variable
+        context->lineNumber = (yylsp[-3]).first_line;
+        (yyval.st) = new (context->arena) lp::ReadStmt((yyvsp[-1].slot), context->lineNumber);
+    }
+#line 2410 "interpreter.tab.c"
+    break;
+
+  case 49: /* read: READ_STRING LPAREN VARIABLE RPAREN  */
+#line 553 "interpreter.y"
+    {
+        // Read string statement for variable
+        context->lineNumber = (yylsp[-3]).first_line;
+        (yyval.st) = new (context->arena) lp::ReadStringStmt((yyvsp[-1].slot), context->lineNumber);
+    }
+#line 2420 "interpreter.tab.c"
+    break;
+
+  case 50: /* read: READ LPAREN CONSTANT RPAREN  */
+#line 559 "interpreter.y"
+    {
+        // Error: read statement for constant
+        context->lineNumber = (yylsp[-3]).first_line;
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Read statement cannot be applied to a constant.",
+                        "Use a variable name instead of a constant if you intend to modify the value.");
+    }
+#line 2432 "interpreter.tab.c"
+    break;
+
+  case 51: /* exp: NUMBER  */
+#line 570 "interpreter.y"
+    {
+        // Numeric literal
+        context->lineNumber = (yylsp[0]).first_line;
+        (yyval.expNode) = new (context->arena) lp::NumberNode((yyvsp[0].number), context->lineNumber);
+    }
+#line 2442 "interpreter.tab.c"
+    break;
+
+  case 52: /* exp: STRING  */
+#line 576 "interpreter.y"
+    {
+        // String literal
+        context->lineNumber = (yylsp[0]).first_line;
+        (yyval.expNode) = context->arena->adopt(new (context->arena) lp::StringNode((yyvsp[0].string), context->lineNumber));
+    }
+#line 2452 "interpreter.tab.c"
+    break;
+
+  case 53: /* exp: exp PLUS exp  */
+#line 582 "interpreter.y"
+    {
+        // Addition
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::PlusNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2462 "interpreter.tab.c"
+    break;
+
+  case 54: /* exp: exp MINUS exp  */
+#line 588 "interpreter.y"
+    {
+        // Subtraction
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::MinusNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2472 "interpreter.tab.c"
+    break;
+
+  case 55: /* exp: exp MULTIPLICATION exp  */
+#line 594 "interpreter.y"
+    {
+        // Multiplication
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::MultiplicationNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2482 "interpreter.tab.c"
+    break;
+
+  case 56: /* exp: exp DIVISION exp  */
+#line 600 "interpreter.y"
+    {
+        // Division
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::DivisionNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2492 "interpreter.tab.c"
+    break;
+
+  case 57: /* exp: exp INTEGER_DIVISION exp  */
+#line 606 "interpreter.y"
+    {
+        // Integer division
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::IntegerDivisionNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2502 "interpreter.tab.c"
+    break;
+
+  case 58: /* exp: exp CONCATENATION exp  */
+#line 612 "interpreter.y"
+    {
+        // String concatenation
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::ConcatenationNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2512 "interpreter.tab.c"
+    break;
+
+  case 59: /* exp: LPAREN exp RPAREN  */
+#line 618 "interpreter.y"
+    {
+        // Parenthesized expression
+        context->lineNumber = (yylsp[-2]).first_line;
+        (yyval.expNode) = (yyvsp[-1].expNode);
+    }
+#line 2522 "interpreter.tab.c"
+    break;
+
+  case 60: /* exp: PLUS exp  */
+#line 624 "interpreter.y"
+    {
+        // Unary plus
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::UnaryPlusNode((yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2532 "interpreter.tab.c"
+    break;
+
+  case 61: /* exp: MINUS exp  */
+#line 630 "interpreter.y"
+    {
+        // Unary minus
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::UnaryMinusNode((yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2542 "interpreter.tab.c"
+    break;
+
+  case 62: /* exp: exp MODULO exp  */
+#line 636 "interpreter.y"
+    {
+        // Modulo operation
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::ModuloNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2552 "interpreter.tab.c"
+    break;
+
+  case 63: /* exp: exp POWER exp  */
+#line 642 "interpreter.y"
+    {
+        // Exponentiation
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::PowerNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2562 "interpreter.tab.c"
+    break;
+
+  case 64: /* exp: VARIABLE  */
+#line 648 "interpreter.y"
+    {
+        // Variable reference
+        context->lineNumber = (yylsp[0]).first_line;
+        (yyval.expNode) = new (context->arena) lp::VariableNode((yyvsp[0].slot), context->lineNumber);
+    }
+#line 2572 "interpreter.tab.c"
+    break;
+
+  case 65: /* exp: CONSTANT  */
+#line 654 "interpreter.y"
+    {
+        // Constant reference
+        context->lineNumber = (yylsp[0]).first_line;
+        (yyval.expNode) = new (context->arena) lp::ConstantNode((yyvsp[0].slot), context->lineNumber);
+    }
+#line 2582 "interpreter.tab.c"
+    break;
+
+  case 66: /* exp: BUILTIN LPAREN listOfExp RPAREN  */
+#line 660 "interpreter.y"
+    {
+        // Builtin function call
+        context->lineNumber = (yylsp[-3]).first_line;
+        lp::Builtin *f = (lp::Builtin *) table.getSymbol((yyvsp[-3].slot));
+        if (f->getNParameters() == (int) (yyvsp[-1].parameters)->size())
+        {
+            switch(f->getNParameters())
+            {
+                case 0:
+                    (yyval.expNode) = new (context->arena) lp::BuiltinFunctionNode_0((yyvsp[-3].slot), context->lineNumber);
+                    break;
+                case 1:
+                    (yyval.expNode) = new (context->arena) lp::BuiltinFunctionNode_1((yyvsp[-3].slot), (yyvsp[-1].parameters)->front(), context->lineNumber);
+                    break;
+                case 2:
+                    {
+                        lp::ExpNode *e1 = (yyvsp[-1].parameters)->front();
+                        (yyvsp[-1].parameters)->pop_front();
+                        lp::ExpNode *e2 = (yyvsp[-1].parameters)->front();
+                        (yyval.expNode) = new (context->arena) lp::BuiltinFunctionNode_2((yyvsp[-3].slot), e1, e2, context->lineNumber);
+                    }
+                    break;
+                default:
+                    context->lineNumber = (yylsp[-3]).first_line;
+                    syntaxWarning(fileName, context->lineNumber, context->columnNumber, "incompatible number of parameters for function");
+                    break;
+            }
+        }
+        else
+        {
+            // Error: incorrect number of parameters for the builtin function
+            context->lineNumber = (yylsp[-3]).first_line;
+            syntaxWarning(fileName, context->lineNumber, context->columnNumber, "incompatible number of parameters for function");
+        }
+    }
+#line 2622 "interpreter.tab.c"
+    break;
+
+  case 67: /* exp: exp GREATER_THAN exp  */
+#line 696 "interpreter.y"
+    {
+        // Greater than comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::GreaterThanNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2632 "interpreter.tab.c"
+    break;
+
+  case 68: /* exp: exp GREATER_OR_EQUAL exp  */
+#line 702 "interpreter.y"
+    {
+        // Greater or equal comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::GreaterOrEqualNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2642 "interpreter.tab.c"
+    break;
+
+  case 69: /* exp: exp LESS_THAN exp  */
+#line 708 "interpreter.y"
+    {
+        // Less than comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::LessThanNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2652 "interpreter.tab.c"
+    break;
+
+  case 70: /* exp: exp LESS_OR_EQUAL exp  */
+#line 714 "interpreter.y"
+    {
+        // Less or equal comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::LessOrEqualNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2662 "interpreter.tab.c"
+    break;
+
+  case 71: /* exp: exp EQUAL exp  */
+#line 720 "interpreter.y"
+    {
+        // Equality comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::EqualNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2672 "interpreter.tab.c"
+    break;
+
+  case 72: /* exp: exp NOT_EQUAL exp  */
+#line 726 "interpreter.y"
+    {
+        // Not equal comparison
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::NotEqualNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2682 "interpreter.tab.c"
+    break;
+
+  case 73: /* exp: exp AND exp  */
+#line 732 "interpreter.y"
+    {
+        // Logical AND
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::AndNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2692 "interpreter.tab.c"
+    break;
+
+  case 74: /* exp: exp OR exp  */
+#line 738 "interpreter.y"
+    {
+        // Logical OR
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::OrNode((yyvsp[-2].expNode), (yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2702 "interpreter.tab.c"
+    break;
+
+  case 75: /* exp: NOT exp  */
+#line 744 "interpreter.y"
+    {
+        // Logical NOT
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::NotNode((yyvsp[0].expNode), context->lineNumber);
+    }
+#line 2712 "interpreter.tab.c"
+    break;
+
+  case 76: /* exp: RANDOM LPAREN exp COMMA exp RPAREN  */
+#line 750 "interpreter.y"
+    {
+        // Random number generation
+        context->lineNumber = (yylsp[-5]).first_line;
+        (yyval.expNode) = new (context->arena) lp::RandomNode((yyvsp[-3].expNode), (yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2722 "interpreter.tab.c"
+    break;
+
+  case 77: /* exp: exp INCREMENT  */
+#line 756 "interpreter.y"
+    {
+        // Increment variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::UnaryIncrementNode((yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2732 "interpreter.tab.c"
+    break;
+
+  case 78: /* exp: exp DECREMENT  */
+#line 762 "interpreter.y"
+    {
+        // Decrement variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::UnaryDecrementNode((yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2742 "interpreter.tab.c"
+    break;
+
+  case 79: /* exp: exp FACTORIAL  */
+#line 768 "interpreter.y"
+    {
+        // Factorial variable
+        context->lineNumber = (yylsp[-1]).first_line;
+        (yyval.expNode) = new (context->arena) lp::UnaryFactorialNode((yyvsp[-1].expNode), context->lineNumber);
+    }
+#line 2752 "interpreter.tab.c"
+    break;
+
+  case 80: /* listOfExp: %empty  */
+#line 777 "interpreter.y"
+    {
+        // Create a new list of expressions
+        (yyval.parameters) = context->arena->create<std::list<lp::ExpNode *> >();
+    }
+#line 2761 "interpreter.tab.c"
+    break;
+
+  case 81: /* listOfExp: exp restOfListOfExp  */
+#line 782 "interpreter.y"
+    {
+        // Add expression to the list
+        (yyval.parameters) = (yyvsp[0].parameters);
+        (yyval.parameters)->push_front((yyvsp[-1].expNode));
+    }
+#line 2771 "interpreter.tab.c"
+    break;
+
+  case 82: /* restOfListOfExp: %empty  */
+#line 791 "interpreter.y"
+    {
+        // Create a new list of expressions
+        (yyval.parameters) = context->arena->create<std::list<lp::ExpNode *> >();
+    }
+#line 2780 "interpreter.tab.c"
+    break;
+
+  case 83: /* restOfListOfExp: COMMA exp restOfListOfExp  */
+#line 796 "interpreter.y"
+    {
+        // Add expression to the list
+        (yyval.parameters) = (yyvsp[0].parameters);
+        (yyval.parameters)->push_front((yyvsp[-1].expNode));
+    }
+#line 2790 "interpreter.tab.c"
+    break;
+
+
+#line 2794 "interpreter.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken, &yylloc};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (&yylloc, scanner, context, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, scanner, context);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, scanner, context);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, scanner, context, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, scanner, context);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, scanner, context);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 802 "interpreter.y"
+
+
+//! \name Error reporting
+
+void yyerror(YYLTYPE *llocp, void *scanner, lp::Context *context, const char *message)
+{
+    // The line and the column are those counted by the scanner, as in the other errors of the parse
+    yyerror(context, message);
+}
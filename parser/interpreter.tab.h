@@ -0,0 +1,175 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_INTERPRETER_TAB_H_INCLUDED
+# define YY_YY_INTERPRETER_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 75 "interpreter.y"
+
+namespace lp { class Context; }
+
+#line 53 "interpreter.tab.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IF = 258,                      /* IF  */
+    ELSE = 259,                    /* ELSE  */
+    WHILE = 260,                   /* WHILE  */
+    FOR = 261,                     /* FOR  */
+    REPEAT = 262,                  /* REPEAT  */
+    UNTIL = 263,                   /* UNTIL  */
+    SWITCH = 264,                  /* SWITCH  */
+    CASE = 265,                    /* CASE  */
+    DEFAULT = 266,                 /* DEFAULT  */
+    END_SWITCH = 267,              /* END_SWITCH  */
+    THEN = 268,                    /* THEN  */
+    END_IF = 269,                  /* END_IF  */
+    DO = 270,                      /* DO  */
+    END_WHILE = 271,               /* END_WHILE  */
+    END_FOR = 272,                 /* END_FOR  */
+    FROM = 273,                    /* FROM  */
+    STEP = 274,                    /* STEP  */
+    TO = 275,                      /* TO  */
+    PRINT = 276,                   /* PRINT  */
+    READ = 277,                    /* READ  */
+    READ_STRING = 278,             /* READ_STRING  */
+    LETFCURLYBRACKET = 279,        /* LETFCURLYBRACKET  */
+    RIGHTCURLYBRACKET = 280,       /* RIGHTCURLYBRACKET  */
+    SEMICOLON = 281,               /* SEMICOLON  */
+    COLON = 282,                   /* COLON  */
+    COMMA = 283,                   /* COMMA  */
+    CLEAR_SCREEN = 284,            /* CLEAR_SCREEN  */
+    PLACE = 285,                   /* PLACE  */
+    RANDOM = 286,                  /* RANDOM  */
+    NUMBER = 287,                  /* NUMBER  */
+    STRING = 288,                  /* STRING  */
+    BOOL = 289,                    /* BOOL  */
+    VARIABLE = 290,                /* VARIABLE  */
+    UNDEFINED = 291,               /* UNDEFINED  */
+    CONSTANT = 292,                /* CONSTANT  */
+    BUILTIN = 293,                 /* BUILTIN  */
+    ASSIGNMENT = 294,              /* ASSIGNMENT  */
+    PLUS_ASSIGNMENT = 295,         /* PLUS_ASSIGNMENT  */
+    MINUS_ASSIGNMENT = 296,        /* MINUS_ASSIGNMENT  */
+    OR = 297,                      /* OR  */
+    AND = 298,                     /* AND  */
+    GREATER_OR_EQUAL = 299,        /* GREATER_OR_EQUAL  */
+    LESS_OR_EQUAL = 300,           /* LESS_OR_EQUAL  */
+    GREATER_THAN = 301,            /* GREATER_THAN  */
+    LESS_THAN = 302,               /* LESS_THAN  */
+    EQUAL = 303,                   /* EQUAL  */
+    NOT_EQUAL = 304,               /* NOT_EQUAL  */
+    NOT = 305,                     /* NOT  */
+    PLUS = 306,                    /* PLUS  */
+    MINUS = 307,                   /* MINUS  */
+    MULTIPLICATION = 308,          /* MULTIPLICATION  */
+    DIVISION = 309,                /* DIVISION  */
+    MODULO = 310,                  /* MODULO  */
+    INTEGER_DIVISION = 311,        /* INTEGER_DIVISION  */
+    CONCATENATION = 312,           /* CONCATENATION  */
+    LPAREN = 313,                  /* LPAREN  */
+    RPAREN = 314,                  /* RPAREN  */
+    UNARY = 315,                   /* UNARY  */
+    INCREMENT = 316,               /* INCREMENT  */
+    DECREMENT = 317,               /* DECREMENT  */
+    FACTORIAL = 318,               /* FACTORIAL  */
+    POWER = 319                    /* POWER  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 115 "interpreter.y"
+
+  double number;              //!< Numeric values
+  char * string;              //!< String values
+  bool logic;                 //!< Boolean values
+  int slot;                   //!< Slot of an identifier in the table of symbols
+  lp::ExpNode *expNode;       //!< Expression nodes
+  std::list<lp::ExpNode *>  *parameters; //!< List of expression nodes
+  std::list<lp::Statement *> *stmts;     //!< List of statement nodes
+  lp::Statement *st;         //!< Statement node
+  lp::AST *prog;             //!< Program (AST root)
+  lp::CaseStmt * caseStm;    //!< Case statement node
+  std::list<lp::CaseStmt *> *caselistStm; //!< List of case statements
+
+#line 148 "interpreter.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (void *scanner, lp::Context *context);
+
+
+#endif /* !YY_YY_INTERPRETER_TAB_H_INCLUDED  */
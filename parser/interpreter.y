@@ -32,6 +32,9 @@
 /* AST class */
 #include "../ast/ast.hpp"
 
+/* Fusion of the statements evaluated immediately */
+#include "../opt/fuser.hpp"
+
 /* Globals */
 #include "../includes/globals.hpp"
 
@@ -46,24 +49,11 @@
 #include "../table/builtinParameter2.hpp"
 #include "../table/init.hpp"
 
-/*! 
-    \brief  Lexical or scanner function
-    \return int
-    \note   C++ requires that yylex returns an int value
-    \sa     yyparser
-*/
-int yylex();
-
-extern int lineNumber; //!< External line counter
-
-extern bool interactiveMode; //!< Control the interactive mode of execution of the interpreter
-
-extern int control; //!< External: to control the interactive mode in "if" and "while" sentences 
+/* State of the parse */
+#include "context.hpp"
 
 extern std::string progname; //!<  Program name
 
-extern int yylineno;
-
 /*
     This is an array type capable of storing the information of a calling environment to be restored later.
     This information is filled by calling macro setjmp and can be restored by calling function longjmp.
@@ -72,10 +62,43 @@ jmp_buf begin; //!<  It enables recovery of runtime errors
 
 extern lp::Table table; //!< Extern Table of Symbols
 
-extern lp::AST *root; //!< External root of the abstract syntax tree AST
-
 %}
 
+/*
+ * The parser is pure: its state is in the context given to yyparse,
+ * and the tokens come from the reentrant scanner of the context
+ */
+%define api.pure full
+%parse-param {void *scanner} {lp::Context *context}
+%lex-param {void *scanner}
+
+%code requires {
+namespace lp { class Context; }
+}
+
+%code {
+/*! 
+    \brief  Lexical or scanner function
+    \param  lvalp: semantic value of the token
+    \param  llocp: location of the token
+    \param  scanner: reentrant scanner of the context
+    \return int
+    \note   C++ requires that yylex returns an int value
+    \sa     yyparse
+*/
+int yylex(YYSTYPE *lvalp, YYLTYPE *llocp, void *scanner);
+
+/*! 
+    \brief  Report a syntax error at the position of the scanner
+    \param  llocp: location of the look-ahead token
+    \param  scanner: reentrant scanner of the context
+    \param  context: state of the parse
+    \param  message: error message of bison
+    \return void
+*/
+void yyerror(YYLTYPE *llocp, void *scanner, lp::Context *context, const char *message);
+}
+
 /*
  * In case of a syntactic error, more information is shown
  */
@@ -93,6 +116,7 @@ extern lp::AST *root; //!< External root of the abstract syntax tree AST
   double number;              //!< Numeric values
   char * string;              //!< String values
   bool logic;                 //!< Boolean values
+  int slot;                   //!< Slot of an identifier in the table of symbols
   lp::ExpNode *expNode;       //!< Expression nodes
   std::list<lp::ExpNode *>  *parameters; //!< List of expression nodes
   std::list<lp::Statement *> *stmts;     //!< List of statement nodes
@@ -136,10 +160,10 @@ extern lp::AST *root; //!< External root of the abstract syntax tree AST
 %token <number> NUMBER         /* Numeric literals */
 %token <string> STRING         /* Strings literals */
 %token <logic> BOOL            /* Boolean literals */
-%token <string> VARIABLE       /* Variable identifiers */
-%token <string> UNDEFINED      /* Undefined identifiers */
-%token <string> CONSTANT       /* Constant values */
-%token <string> BUILTIN        /* Builtin function names */
+%token <slot> VARIABLE         /* Variable identifiers */
+%token <slot> UNDEFINED        /* Undefined identifiers */
+%token <slot> CONSTANT         /* Constant values */
+%token <slot> BUILTIN          /* Builtin function names */
 
 /* Operator precedences and associativity */
 %right ASSIGNMENT PLUS_ASSIGNMENT MINUS_ASSIGNMENT              /* Assignment operator */
@@ -174,10 +198,10 @@ extern lp::AST *root; //!< External root of the abstract syntax tree AST
 
 program : stmtlist
           { 
-            // Create a new AST from the list of statements
-            $$ = new lp::AST($1); 
+            // Create a new AST from the list of statements, which owns the arena of its nodes
+            $$ = new lp::AST($1, context->arena); 
             // Assign the AST to the root pointer
-            root = $$; 
+            context->root = $$; 
             // End of parsing
           }
 ;
@@ -186,21 +210,30 @@ stmtlist:
     /* Empty: epsilon rule */
     { 
       // Create an empty list of statements
-      $$ = new std::list<lp::Statement *>(); 
+      $$ = context->arena->create<std::list<lp::Statement *> >(); 
     }
   | stmtlist stmt 
     { 
       // Add the new statement to the list
       $$ = $1;
       $$->push_back($2);
-      // If in interactive mode, evaluate statements immediately
-      if (interactiveMode == true && control == 0)
+      // In the interactive mode and with --stream, evaluate the statements immediately
+      if (context->immediate == true && context->control == 0)
       {
+        // The errors of the evaluation show the column where the scanner is
+        columnNumber = context->columnNumber;
+
         for(std::list<lp::Statement *>::iterator it = $$->begin(); it != $$->end(); it++)
         {
+          // As the whole programs, the common statements run as fused nodes
+          if (context->fuser != NULL)
+            *it = context->fuser->fuse(*it);
+
+          (*it)->analyze();
+          (*it)->freeze();
           (*it)->evaluate();
         }
-        // Clear the AST code, as it has already run in interactive mode
+        // Clear the AST code, as it has already run
         $$->clear();
       }
     }
@@ -218,101 +251,101 @@ stmt:
       {
         // Empty statement: ";"
         // Update lineNumber for error control
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
         // Create a new empty statement node
-        $$ = new lp::EmptyStmt(lineNumber); 
+        $$ = new (context->arena) lp::EmptyStmt(context->lineNumber); 
       }
     | asgn SEMICOLON
       {
         // Assignment statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | print SEMICOLON
       {
         // Print statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | read SEMICOLON
       {
         // Read statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | if
       {
         // If statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | while
       {
         // While statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | dowhile
       {
         // Do-while statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | repeat
       {
         // Repeat statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | for
       {
         // For statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | block
       {
         // Block statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | CLEAR_SCREEN SEMICOLON
       {
         // Clear screen statement
-        lineNumber = @1.first_line;
-        $$ = new lp::ClearScreenStmt();
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ClearScreenStmt();
       }
     | place SEMICOLON
       {
         // Place statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
         $$ = $1;
       }
     | switch SEMICOLON
       {
         // Switch statement
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
       }
     | increment SEMICOLON
       {
           // Increment statement
-          lineNumber = @1.first_line;
+          context->lineNumber = @1.first_line;
       }
     | decrement SEMICOLON
       {
           // Decrement statement
-          lineNumber = @1.first_line;
+          context->lineNumber = @1.first_line;
       }
     | factorial SEMICOLON
       {
           // Factorial statement
-          lineNumber = @1.first_line;
+          context->lineNumber = @1.first_line;
       }
 ;
 
 block: LETFCURLYBRACKET stmtlist RIGHTCURLYBRACKET
         {
             // Block of statements delimited by curly brackets
-            lineNumber = @1.first_line;
-            $$ = new lp::BlockStmt($2, lineNumber);
+            context->lineNumber = @1.first_line;
+            $$ = new (context->arena) lp::BlockStmt($2, context->lineNumber);
         }
 ;
 
 controlSymbol:
     /* Epsilon rule for controlling interactive mode in if/while */
     {
-        control++;
+        context->control++;
     }
 ;
 
@@ -320,16 +353,16 @@ if:
     IF controlSymbol cond THEN stmtlist END_IF
     {
         // If statement without else
-        lineNumber = @1.first_line;
-        $$ = new lp::IfStmt($3, $5, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::IfStmt($3, $5, context->lineNumber);
+        context->control--;
     }
   | IF controlSymbol cond THEN stmtlist ELSE stmtlist END_IF
     {
         // If-else statement
-        lineNumber = @1.first_line;
-        $$ = new lp::IfStmt($3, $5, $7, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::IfStmt($3, $5, $7, context->lineNumber);
+        context->control--;
     }
 ;
 
@@ -337,35 +370,35 @@ place:
     PLACE LPAREN exp COMMA exp RPAREN
     {
         // Place statement for screen positioning
-        lineNumber = @1.first_line;
-        $$ = new lp::PlaceStmt($3, $5, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::PlaceStmt($3, $5, context->lineNumber);
     }
 ;
 
 while: WHILE controlSymbol cond DO stmtlist END_WHILE
     {
         // While loop
-        lineNumber = @1.first_line;
-        $$ = new lp::WhileStmt($3, $5, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::WhileStmt($3, $5, context->lineNumber);
+        context->control--;
     }
 ;
 
 dowhile: DO controlSymbol stmtlist WHILE cond
     {
         // While loop
-        lineNumber = @1.first_line;
-        $$ = new lp::DoWhileStmt($5, $3, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::DoWhileStmt($5, $3, context->lineNumber);
+        context->control--;
     }
 ;
 
 repeat: REPEAT controlSymbol stmtlist UNTIL cond
     {
         // Repeat-until loop
-        lineNumber = @1.first_line;
-        $$ = new lp::RepeatStmt($3, $5, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::RepeatStmt($3, $5, context->lineNumber);
+        context->control--;
     }
 ;
 
@@ -373,30 +406,30 @@ for:
     FOR VARIABLE FROM exp TO exp DO controlSymbol stmtlist END_FOR
     {
         // For loop without step
-        lineNumber = @1.first_line;
-        $$ = new lp::ForStmt(std::string($2), $4, $6, $9, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ForStmt($2, $4, $6, $9, context->lineNumber);
+        context->control--;
     }
   | FOR VARIABLE FROM exp TO exp STEP exp DO controlSymbol stmtlist END_FOR
     {
         // For loop with step
-        lineNumber = @1.first_line;
-        $$ = new lp::ForStmt(std::string($2), $4, $6, $8, $11, lineNumber);
-        control--;
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ForStmt($2, $4, $6, $8, $11, context->lineNumber);
+        context->control--;
     }
 ;
 
 case: CASE exp COLON stmtlist
     {
         // Case statement for switch
-        lineNumber = @1.first_line;
-        $$ = new lp::CaseStmt($2, $4, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::CaseStmt($2, $4, context->lineNumber);
     }
 
 caselist:
     /* Empty list of case statements */
     {
-        $$ = new std::list<lp::CaseStmt *>();
+        $$ = context->arena->create<std::list<lp::CaseStmt *> >();
     }
   | caselist case
     {
@@ -410,14 +443,16 @@ switch:
     SWITCH controlSymbol LPAREN exp RPAREN caselist DEFAULT COLON stmtlist END_SWITCH
     {
         // Switch statement with default case
-        lineNumber = @1.first_line;
-        $$ = new lp::SwitchStmt($4, $6, $9, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = context->arena->adopt(new (context->arena) lp::SwitchStmt($4, $6, $9, context->lineNumber));
+        context->control--;
     }
   | SWITCH controlSymbol LPAREN exp RPAREN caselist END_SWITCH
     {
         // Switch statement without default case
-        lineNumber = @1.first_line;
-        $$ = new lp::SwitchStmt($4, $6, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = context->arena->adopt(new (context->arena) lp::SwitchStmt($4, $6, context->lineNumber));
+        context->control--;
     }
 ;
 
@@ -425,8 +460,8 @@ increment:
     exp INCREMENT
     {
         // Increment variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryIncrementStmt($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryIncrementStmt($1, context->lineNumber);
     }
 ;
 
@@ -434,8 +469,8 @@ decrement:
     exp DECREMENT
     {
         // Decrement variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryDecrementStmt($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryDecrementStmt($1, context->lineNumber);
     }
 ;
 
@@ -443,8 +478,8 @@ factorial:
     exp FACTORIAL
     {
         // Factorial variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryFactorialStmt($1, lineNumber);        
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryFactorialStmt($1, context->lineNumber);        
     }
 ;
 
@@ -460,41 +495,41 @@ asgn:
     VARIABLE ASSIGNMENT exp
     {
         // Assignment to variable
-        lineNumber = @1.first_line;
-        $$ = new lp::AssignmentStmt($1, $3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::AssignmentStmt($1, $3, context->lineNumber);
     }
   | VARIABLE PLUS_ASSIGNMENT exp
     {
         // Plus assignment
-        lineNumber = @1.first_line;
-        $$ = new lp::PlusAssignmentStmt($1, $3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::PlusAssignmentStmt($1, $3, context->lineNumber);
     }
   | VARIABLE MINUS_ASSIGNMENT exp
     {
         // Minus assignment
-        lineNumber = @1.first_line;
-        $$ = new lp::MinusAssignmentStmt($1, $3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::MinusAssignmentStmt($1, $3, context->lineNumber);
     }
   | VARIABLE ASSIGNMENT asgn
     {
         // Multiple assignment to variable
-        lineNumber = @1.first_line;
-        $$ = new lp::AssignmentStmt($1, (lp::AssignmentStmt *) $3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::AssignmentStmt($1, (lp::AssignmentStmt *) $3, context->lineNumber);
     }
   | CONSTANT ASSIGNMENT exp
     {
         // Error: assignment to constant
-        lineNumber = @1.first_line;
-        errorMsg = "Assignment to constant is not allowed.";
-        suggestion = "Use a variable name instead of a constant if you intend to modify the value.";
-        semanticWarning(fileName, lineNumber, columnNumber, errorMsg, suggestion);
+        context->lineNumber = @1.first_line;
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Assignment to constant is not allowed.",
+                        "Use a variable name instead of a constant if you intend to modify the value.");
     }
   | CONSTANT ASSIGNMENT asgn
     {
         // Error: reassignment to constant
-        errorMsg = "Reassignment to a constant is not allowed.";
-        suggestion = "If you need to change the value, consider using a variable instead.";
-        semanticWarning(fileName, lineNumber, columnNumber, errorMsg, suggestion);
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Reassignment to a constant is not allowed.",
+                        "If you need to change the value, consider using a variable instead.");
     }
 ;
 
@@ -502,8 +537,8 @@ print:
     PRINT exp
     {
         // Print statement
-        lineNumber = @1.first_line;
-        $$ = new lp::PrintStmt($2, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::PrintStmt($2, context->lineNumber);
     }
 ;
 
@@ -511,22 +546,22 @@ read:
     READ LPAREN VARIABLE RPAREN
     {
         // Read statement for variable
-        lineNumber = @1.first_line;
-        $$ = new lp::ReadStmt($3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ReadStmt($3, context->lineNumber);
     }
   | READ_STRING LPAREN VARIABLE RPAREN
     {
         // Read string statement for variable
-        lineNumber = @1.first_line;
-        $$ = new lp::ReadStringStmt($3, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ReadStringStmt($3, context->lineNumber);
     }
   | READ LPAREN CONSTANT RPAREN
     {
         // Error: read statement for constant
-        lineNumber = @1.first_line;
-        errorMsg = "Read statement cannot be applied to a constant.";
-        suggestion = "Use a variable name instead of a constant if you intend to modify the value.";
-        semanticWarning(fileName, lineNumber, columnNumber, errorMsg, suggestion);
+        context->lineNumber = @1.first_line;
+        semanticWarning(fileName, context->lineNumber, context->columnNumber,
+                        "Read statement cannot be applied to a constant.",
+                        "Use a variable name instead of a constant if you intend to modify the value.");
     }
 ;
 
@@ -534,208 +569,206 @@ exp:
     NUMBER
     {
         // Numeric literal
-        lineNumber = @1.first_line;
-        $$ = new lp::NumberNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::NumberNode($1, context->lineNumber);
     }
   | STRING
     {
         // String literal
-        lineNumber = @1.first_line;
-        $$ = new lp::StringNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = context->arena->adopt(new (context->arena) lp::StringNode($1, context->lineNumber));
     }
   | exp PLUS exp
     {
         // Addition
-        lineNumber = @2.first_line;
-        $$ = new lp::PlusNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::PlusNode($1, $3, context->lineNumber);
     }
   | exp MINUS exp
     {
         // Subtraction
-        lineNumber = @2.first_line;
-        $$ = new lp::MinusNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::MinusNode($1, $3, context->lineNumber);
     }
   | exp MULTIPLICATION exp
     {
         // Multiplication
-        lineNumber = @2.first_line;
-        $$ = new lp::MultiplicationNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::MultiplicationNode($1, $3, context->lineNumber);
     }
   | exp DIVISION exp
     {
         // Division
-        lineNumber = @2.first_line;
-        $$ = new lp::DivisionNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::DivisionNode($1, $3, context->lineNumber);
     }
   | exp INTEGER_DIVISION exp
     {
         // Integer division
-        lineNumber = @2.first_line;
-        $$ = new lp::IntegerDivisionNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::IntegerDivisionNode($1, $3, context->lineNumber);
     }
   | exp CONCATENATION exp
     {
         // String concatenation
-        lineNumber = @2.first_line;
-        $$ = new lp::ConcatenationNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::ConcatenationNode($1, $3, context->lineNumber);
     }
   | LPAREN exp RPAREN
     {
         // Parenthesized expression
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
         $$ = $2;
     }
   | PLUS exp %prec UNARY
     {
         // Unary plus
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryPlusNode($2, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryPlusNode($2, context->lineNumber);
     }
   | MINUS exp %prec UNARY
     {
         // Unary minus
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryMinusNode($2, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryMinusNode($2, context->lineNumber);
     }
   | exp MODULO exp
     {
         // Modulo operation
-        lineNumber = @2.first_line;
-        $$ = new lp::ModuloNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::ModuloNode($1, $3, context->lineNumber);
     }
   | exp POWER exp
     {
         // Exponentiation
-        lineNumber = @2.first_line;
-        $$ = new lp::PowerNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::PowerNode($1, $3, context->lineNumber);
     }
   | VARIABLE
     {
         // Variable reference
-        lineNumber = @1.first_line;
-        $$ = new lp::VariableNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::VariableNode($1, context->lineNumber);
     }
   | CONSTANT
     {
         // Constant reference
-        lineNumber = @1.first_line;
-        $$ = new lp::ConstantNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::ConstantNode($1, context->lineNumber);
     }
   | BUILTIN LPAREN listOfExp RPAREN
     {
         // Builtin function call
-        lineNumber = @1.first_line;
+        context->lineNumber = @1.first_line;
         lp::Builtin *f = (lp::Builtin *) table.getSymbol($1);
         if (f->getNParameters() == (int) $3->size())
         {
             switch(f->getNParameters())
             {
                 case 0:
-                    $$ = new lp::BuiltinFunctionNode_0($1, lineNumber);
+                    $$ = new (context->arena) lp::BuiltinFunctionNode_0($1, context->lineNumber);
                     break;
                 case 1:
-                    $$ = new lp::BuiltinFunctionNode_1($1, $3->front(), lineNumber);
+                    $$ = new (context->arena) lp::BuiltinFunctionNode_1($1, $3->front(), context->lineNumber);
                     break;
                 case 2:
                     {
                         lp::ExpNode *e1 = $3->front();
                         $3->pop_front();
                         lp::ExpNode *e2 = $3->front();
-                        $$ = new lp::BuiltinFunctionNode_2($1, e1, e2, lineNumber);
+                        $$ = new (context->arena) lp::BuiltinFunctionNode_2($1, e1, e2, context->lineNumber);
                     }
                     break;
                 default:
-                    lineNumber = @1.first_line;
-                    errorMsg = "incompatible number of parameters for function";
-                    syntaxWarning(fileName, lineNumber, columnNumber, errorMsg);
+                    context->lineNumber = @1.first_line;
+                    syntaxWarning(fileName, context->lineNumber, context->columnNumber, "incompatible number of parameters for function");
                     break;
             }
         }
         else
         {
             // Error: incorrect number of parameters for the builtin function
-            lineNumber = @1.first_line;
-            errorMsg = "incompatible number of parameters for function";
-            syntaxWarning(fileName, lineNumber, columnNumber, errorMsg);
+            context->lineNumber = @1.first_line;
+            syntaxWarning(fileName, context->lineNumber, context->columnNumber, "incompatible number of parameters for function");
         }
     }
   | exp GREATER_THAN exp
     {
         // Greater than comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::GreaterThanNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::GreaterThanNode($1, $3, context->lineNumber);
     }
   | exp GREATER_OR_EQUAL exp
     {
         // Greater or equal comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::GreaterOrEqualNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::GreaterOrEqualNode($1, $3, context->lineNumber);
     }
   | exp LESS_THAN exp
     {
         // Less than comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::LessThanNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::LessThanNode($1, $3, context->lineNumber);
     }
   | exp LESS_OR_EQUAL exp
     {
         // Less or equal comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::LessOrEqualNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::LessOrEqualNode($1, $3, context->lineNumber);
     }
   | exp EQUAL exp
     {
         // Equality comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::EqualNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::EqualNode($1, $3, context->lineNumber);
     }
   | exp NOT_EQUAL exp
     {
         // Not equal comparison
-        lineNumber = @2.first_line;
-        $$ = new lp::NotEqualNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::NotEqualNode($1, $3, context->lineNumber);
     }
   | exp AND exp
     {
         // Logical AND
-        lineNumber = @2.first_line;
-        $$ = new lp::AndNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::AndNode($1, $3, context->lineNumber);
     }
   | exp OR exp
     {
         // Logical OR
-        lineNumber = @2.first_line;
-        $$ = new lp::OrNode($1, $3, lineNumber);
+        context->lineNumber = @2.first_line;
+        $$ = new (context->arena) lp::OrNode($1, $3, context->lineNumber);
     }
   | NOT exp
     {
         // Logical NOT
-        lineNumber = @1.first_line;
-        $$ = new lp::NotNode($2, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::NotNode($2, context->lineNumber);
     }
   | RANDOM LPAREN exp COMMA exp RPAREN
     {
         // Random number generation
-        lineNumber = @1.first_line;
-        $$ = new lp::RandomNode($3, $5, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::RandomNode($3, $5, context->lineNumber);
     }
   | exp INCREMENT
     {
         // Increment variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryIncrementNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryIncrementNode($1, context->lineNumber);
     }
   | exp DECREMENT
     {
         // Decrement variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryDecrementNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryDecrementNode($1, context->lineNumber);
     }
   | exp FACTORIAL
     {
         // Factorial variable
-        lineNumber = @1.first_line;
-        $$ = new lp::UnaryFactorialNode($1, lineNumber);
+        context->lineNumber = @1.first_line;
+        $$ = new (context->arena) lp::UnaryFactorialNode($1, context->lineNumber);
     }
 ;
 
@@ -743,7 +776,7 @@ listOfExp:
     /* Empty list of numeric expressions */
     {
         // Create a new list of expressions
-        $$ = new std::list<lp::ExpNode *>();
+        $$ = context->arena->create<std::list<lp::ExpNode *> >();
     }
   | exp restOfListOfExp
     {
@@ -757,7 +790,7 @@ restOfListOfExp:
     /* Empty list of numeric expressions */
     {
         // Create a new list of expressions
-        $$ = new std::list<lp::ExpNode *>();
+        $$ = context->arena->create<std::list<lp::ExpNode *> >();
     }
   | COMMA exp restOfListOfExp
     {
@@ -766,4 +799,12 @@ restOfListOfExp:
         $$->push_front($2);
     }
 ;
-%%
\ No newline at end of file
+%%
+
+//! \name Error reporting
+
+void yyerror(YYLTYPE *llocp, void *scanner, lp::Context *context, const char *message)
+{
+    // The line and the column are those counted by the scanner, as in the other errors of the parse
+    yyerror(context, message);
+}
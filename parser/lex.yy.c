@@ -0,0 +1,100 @@
+// Throwaway hand-written stand-in for the flex scanner (sandbox has no flex).
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <cctype>
+#include "../includes/macros.hpp"
+#include "../ast/ast.hpp"
+#include "interpreter.tab.h"
+#include "../error/error.hpp"
+#include "../table/table.hpp"
+#include "../table/numericVariable.hpp"
+#include "../table/reserved.hpp"
+#include "../includes/globals.hpp"
+extern lp::Table table;
+#include "context.hpp"
+struct St { char *hp; char hc; std::string pb; char *sb; size_t sn, sp; int yylineno; lp::Context *x; };
+static St *S;
+static int rd() { if (S->hp) { *S->hp = S->hc; S->hp = NULL; } if (!S->pb.empty()) { int c = (unsigned char)S->pb[S->pb.size()-1]; S->pb.erase(S->pb.size()-1); return c; } if (S->sb) return S->sp < S->sn ? (unsigned char)S->sb[S->sp++] : EOF; return getc(stdin); }
+static void unrd(int c) { if (c != EOF) S->pb.push_back((char)c); }
+static int pk() { int c = rd(); unrd(c); return c; }
+static void take(const std::string &t) { S->x->columnNumber += t.size(); S->x->lines->append(S->x->lineNumber, t.data(), t.size()); }
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+int yylex_init_extra(lp::Context *x, void **s) { St *n = new St; n->hp = NULL; n->sb = NULL; n->sn = n->sp = 0; n->yylineno = 1; n->x = x; *s = n; return 0; }
+int yylex_destroy(void *s) { delete (St *) s; return 0; }
+void yy_delete_buffer(YY_BUFFER_STATE, void *s) { ((St *) s)->sb = NULL; }
+YY_BUFFER_STATE yy_scan_buffer(char *b, size_t n, void *s) { if (n < 2 || b[n-1] || b[n-2]) return 0; St *t = (St *) s; t->sb = b; t->sn = n - 2; t->sp = 0; return (YY_BUFFER_STATE) b; }
+#define yylineno S->yylineno
+#define lineNumber S->x->lineNumber
+#define columnNumber S->x->columnNumber
+#define errorMsg S->x->errorMsg
+// As flex, the character after the token is held and replaced by a null character until the next call
+static void hold() { size_t at = S->sp - S->pb.size(); if (S->sb && S->pb.size() <= S->sp && at < S->sn) { S->hp = S->sb + at; S->hc = *S->hp; *S->hp = 0; } }
+static int yylex0(YYSTYPE *yylval, YYLTYPE *yylloc);
+int yylex(YYSTYPE *yylval, YYLTYPE *yylloc, void *scanner)
+{
+  S = (St *) scanner;
+  if (S->hp) { *S->hp = S->hc; S->hp = NULL; }
+  int t = yylex0(yylval, yylloc);
+  hold();
+  return t;
+}
+static int yylex0(YYSTYPE *yylval, YYLTYPE *yylloc)
+{
+  for (;;) {
+    int c = rd();
+    yylloc->first_line = yylloc->last_line = yylineno;
+    if (c == EOF) return 0;
+    if (c == ' ' || c == '\t' || c == '\r') { take(std::string(1,(char)c)); continue; }
+    if (c == '\n') { yylineno++; lineNumber++; columnNumber = 1; continue; }
+    if (c == '#') { while ((c = rd()) != EOF && c != '\n') ; unrd(c); continue; }
+    if (c == '(' && pk() == '*') { rd(); int p = 0; while ((c = rd()) != EOF) { if (c == '\n') { yylineno++; lineNumber++; } if (p == '*' && c == ')') break; p = c; } continue; }
+    if (c == '\'') {
+      std::string raw = "'", r;
+      while ((c = rd()) != EOF) {
+        if (c == '\n') { yylineno++; }
+        raw += (char)c;
+        if (c == '\\') { int d = rd(); raw += (char)d;
+          switch (d) { case 'n': r += '\n'; break; case 't': r += '\t'; break; case 'r': r += '\r'; break; case '\'': r += '\''; break; default: r += '\\'; r += (char)d; }
+          continue; }
+        if (c == '\'') break;
+        r += (char)c;
+      }
+      yylval->string = strdup(r.c_str()); take(raw); return STRING;
+    }
+    if (isdigit(c) || (c == '.' && isdigit(pk()))) {
+      std::string n(1,(char)c);
+      while (isdigit(pk()) || pk() == '.') n += (char)rd();
+      if (pk() == 'e' || pk() == 'E') { int e = rd(); int s = pk(); if (isdigit(s) || s=='+' || s=='-') { n += (char)e; n += (char)rd(); while (isdigit(pk())) n += (char)rd(); } else unrd(e); }
+      yylval->number = atof(n.c_str()); take(n); return NUMBER;
+    }
+    if (isalpha(c)) {
+      std::string raw(1,(char)c);
+      while (isalnum(pk()) || pk() == '_') raw += (char)rd();
+      std::string id; for (size_t i = 0; i < raw.size(); i++) id += (char)tolower(raw[i]);
+      take(raw);
+      { const lp::Reserved::Word *w = lp::Reserved::find(id.data(), id.size()); if (w) { yylval->slot = w->slot; return w->token; } }
+      int slot = table.getSlot(id); yylval->slot = slot;
+      if (table.getSymbol(slot) == NULL) { table.installSymbol(new lp::Variable(id, VARIABLE, UNDEFINED)); return VARIABLE; }
+      return table.getSymbol(slot)->getToken();
+    }
+    std::string t(1,(char)c); int d = pk();
+    #define TWO(a,b,tok) if (c==a && d==b) { rd(); take(std::string(1,a)+b); return tok; }
+    if (c=='+' && d==':') { rd(); if (pk()=='=') { rd(); take("+:="); return PLUS_ASSIGNMENT; } unrd(':'); }
+    if (c=='-' && d==':') { rd(); if (pk()=='=') { rd(); take("-:="); return MINUS_ASSIGNMENT; } unrd(':'); }
+    d = pk();
+    TWO(':','=',ASSIGNMENT) TWO('|','|',CONCATENATION) TWO('<','>',NOT_EQUAL) TWO('>','=',GREATER_OR_EQUAL)
+    TWO('<','=',LESS_OR_EQUAL) TWO('/','/',INTEGER_DIVISION) TWO('+','+',INCREMENT) TWO('-','-',DECREMENT)
+    take(t);
+    switch (c) {
+      case '-': return MINUS; case '+': return PLUS; case '*': return MULTIPLICATION; case '/': return DIVISION;
+      case '^': return POWER; case '!': return FACTORIAL; case '(': return LPAREN; case ')': return RPAREN;
+      case '{': return LETFCURLYBRACKET; case '}': return RIGHTCURLYBRACKET; case '=': return EQUAL;
+      case '>': return GREATER_THAN; case '<': return LESS_THAN; case ';': return SEMICOLON; case ':': return COLON; case ',': return COMMA;
+    }
+    hold();
+    lexicalWarning(fileName, lineNumber, columnNumber, t, errorMsg);
+  }
+}
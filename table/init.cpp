@@ -22,6 +22,7 @@
 
 #include "builtinParameter0.hpp"
 #include "builtinParameter2.hpp"
+#include "reserved.hpp"
 
 //  interpreter.tab.h contains the number values of the tokens produced by the parser
 #include "../parser/interpreter.tab.h"
@@ -136,5 +137,8 @@ void init(lp::Table &t)
 		// A pointer to the new Keyword is inserted into the table of symbols
 		t.installSymbol(f2);
 	}
-}
 
+  //////////////////////////////////////////////
+ // The scanner finds the predefined names with their tokens without the table of symbols
+ lp::Reserved::bind(t);
+}
@@ -38,7 +38,7 @@ void lp::LogicalVariable::read()
 
    // Own attribute
    std::cout << "Value of the LogicalVariable: ";
-   std::cin >> this->_value;
+   std::cin >> this->_logic;
    // The \n character is read 
    std::cin.ignore(); 
 }
@@ -105,7 +105,7 @@ std::istream &operator>>(std::istream &i, lp::LogicalVariable &n)
 
   // Own attribute
 
-  i >> n._value;
+  i >> n._logic;
   // The \n character is read 
   i.ignore();
 
@@ -122,7 +122,7 @@ std::istream &operator>>(std::istream &i, lp::LogicalVariable &n)
   n._type = atof(auxiliar.c_str());
 
   std::getline(i,auxiliar);
-  n._value = atof(auxiliar.c_str());
+  n._logic = atof(auxiliar.c_str());
 
 */
 
@@ -141,7 +141,7 @@ std::ostream &operator<<(std::ostream &o, lp::LogicalVariable const &n)
   o << n._type << std::endl;
 
   // Own attribute
-  o << n._value << std::endl;
+  o << n._logic << std::endl;
 
   // The output stream is returned
   return o;
@@ -24,15 +24,11 @@ namespace lp{
   \class LogicalVariable
   \brief Definition of atributes and methods of LogicalVariable class
   \note  LogicalVariable Class publicly inherits from Variable class
+  \note  The value is kept by Variable. The interpreter creates and reads every variable as a
+         Variable, with the accessors of its type, and never casts it to this class
 */
 class LogicalVariable:public lp::Variable
 {
-/*!		
-\name Private atributes of LogicalVariable class
-*/
-	private:
-		bool      _value;   //!< \brief Logical value of the LogicalVariable
-
 /*!		
 \name Public methods of LogicalVariable class
 */
@@ -95,7 +91,7 @@ class LogicalVariable:public lp::Variable
 */
 	inline bool getValue() const
 	{
-		return this->_value;
+		return this->_logic;
 	}
 
 
@@ -115,7 +111,7 @@ class LogicalVariable:public lp::Variable
 */
 	inline void setValue(bool value)
 	{
-	    this->_value = value;
+	    this->_logic = value;
 	}
 
 
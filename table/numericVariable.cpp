@@ -38,7 +38,7 @@ void lp::NumericVariable::read()
 
    // Own attribute
    std::cout << "Value of the NumericVariable: ";
-   std::cin >> this->_value;
+   std::cin >> this->_number;
    // The \n character is read 
    std::cin.ignore(); 
 }
@@ -105,7 +105,7 @@ std::istream &operator>>(std::istream &i, lp::NumericVariable &n)
 
   // Own attribute
 
-  i >> n._value;
+  i >> n._number;
   // The \n character is read 
   i.ignore();
 
@@ -122,7 +122,7 @@ std::istream &operator>>(std::istream &i, lp::NumericVariable &n)
   n._type = atof(auxiliar.c_str());
 
   std::getline(i,auxiliar);
-  n._value = atof(auxiliar.c_str());
+  n._number = atof(auxiliar.c_str());
 
 */
 
@@ -141,7 +141,7 @@ std::ostream &operator<<(std::ostream &o, lp::NumericVariable const &n)
   o << n._type << std::endl;
 
   // Own attribute
-  o << n._value << std::endl;
+  o << n._number << std::endl;
 
   // The output stream is returned
   return o;
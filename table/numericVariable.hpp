@@ -24,15 +24,11 @@ namespace lp{
   \class NumericVariable
   \brief Definition of atributes and methods of NumericVariable class
   \note  NumericVariable Class publicly inherits from Variable class
+  \note  The value is kept by Variable. The interpreter creates and reads every variable as a
+         Variable, with the accessors of its type, and never casts it to this class
 */
 class NumericVariable:public lp::Variable
 {
-/*!		
-\name Private atributes of NumericVariable class
-*/
-	private:
-		double      _value;   //!< \brief Numeric value of the NumericVariable
-
 /*!		
 \name Public methods of NumericVariable class
 */
@@ -96,7 +92,7 @@ class NumericVariable:public lp::Variable
 */
 	inline double getValue() const
 	{
-		return this->_value;
+		return this->_number;
 	}
 
 
@@ -116,7 +112,7 @@ class NumericVariable:public lp::Variable
 */
 	inline void setValue(const double & value)
 	{
-	    this->_value = value;
+	    this->_number = value;
 	}
 
 
@@ -0,0 +1,94 @@
+/*!
+	\file    reserved.cpp
+	\brief   Code of the functions of the Reserved class
+	\author
+	\date    2025-06-06
+	\version 1.0
+	\note    Generated by reservedGenerator.cpp from the names of init.hpp: do not edit
+*/
+
+#include <cassert>
+#include <cstddef>
+
+#include "reserved.hpp"
+#include "symbol.hpp"
+
+
+// Values of the characters of the predefined names; the other characters are 0
+const unsigned char lp::Reserved::_values[256] =
+{
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	 44,   0,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0, 122, 108,  97,  75,  52, 117,  79,   8, 114,   0,   0,  14,  15,  78,  90,
+	 30,  31,  35,  28,  61, 114,   0, 125,  42,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+
+
+// The positions of the names are given by their hashes with the values above
+lp::Reserved::Word lp::Reserved::_words[lp::Reserved::SIZE] =
+{
+	{NULL, 0},            {"do", 2},            {NULL, 0},            {"print", 5},
+	{"pi", 2},            {"abs", 3},           {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {"atan", 4},          {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {"case", 4},
+	{"end_switch", 10},   {NULL, 0},            {"and", 3},           {"then", 4},
+	{"true", 4},          {"log10", 5},         {"repeat", 6},        {"phi", 3},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"or", 2},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"read", 4},          {"switch", 6},
+	{"false", 5},         {NULL, 0},            {NULL, 0},            {"from", 4},
+	{"end_for", 7},       {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {"read_string", 11},  {"random", 6},        {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {"mod", 3},
+	{NULL, 0},            {NULL, 0},            {"log", 3},           {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"while", 5},         {"end_while", 9},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {"default", 7},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {"atan2", 5},
+	{"gamma", 5},         {"clear_screen", 12}, {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {"deg", 3},           {NULL, 0},            {"until", 5},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"cos", 3},           {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"if", 2},            {"sin", 3},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {"place", 5},         {NULL, 0},            {NULL, 0},
+	{"not", 3},           {"e", 1},             {"integer", 7},       {NULL, 0},
+	{"rand", 4},          {NULL, 0},            {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {NULL, 0},            {"to", 2},
+	{NULL, 0},            {"for", 3},           {NULL, 0},            {NULL, 0},
+	{NULL, 0},            {NULL, 0},            {"else", 4},          {"step", 4},
+	{"sqrt", 4},          {"end_if", 6},        {NULL, 0},            {"exp", 3}
+};
+
+
+void lp::Reserved::bind(lp::Table & t)
+{
+	for (int i = 0; i < SIZE; i++)
+	{
+		if (_words[i].name == NULL)
+			continue;
+
+		int slot = t.getSlot(_words[i].name);
+		lp::Symbol *symbol = t.getSymbol(slot);
+
+		// Every name of the table of words is installed by init(), at the position of its hash
+		assert(symbol != NULL);
+		assert(position(_words[i].name, _words[i].length) == (size_t) i);
+
+		_words[i].token = symbol->getToken();
+		_words[i].slot = slot;
+	}
+}
@@ -0,0 +1,111 @@
+/*!
+	\file    reserved.hpp
+	\brief   Declaration of the perfect hash of the predefined names of the language
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _RESERVED_HPP_
+#define _RESERVED_HPP_
+
+#include <cstddef>
+#include <cstring>
+
+#include "table.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Reserved
+  \brief Keywords, constants and builtins recognized by the scanner without the table of symbols
+  \note  The position of a name in the table of words is its length plus the
+         values of its first, second and last characters, modulo SIZE. The
+         values are searched for, as gperf does, so that no two predefined
+         names share a position: a name is found with one hash and one
+         comparison. Both tables are written to reserved.cpp by
+         reservedGenerator.cpp from the names of init.hpp: "make reserved"
+         writes it again and "make check-reserved" checks it. A name that is
+         not in the table of words, for instance one installed outside
+         init.hpp, is still found in the table of symbols.
+*/
+class Reserved
+{
+	public:
+
+	/*!
+		\brief Number of positions of the table of words
+	*/
+		static const int SIZE = 128;
+
+	/*!
+		\struct Word
+		\brief  Predefined name
+	*/
+		struct Word
+		{
+			const char *name;   //!< Name, in lower case, or NULL if the position is empty
+			size_t length;      //!< Number of characters of the name
+			int token;          //!< Token of the name, copied from the table of symbols by bind()
+			int slot;           //!< Slot of the name in the table of symbols, copied by bind()
+		};
+
+	private:
+		static const unsigned char _values[256];   //!< Value of each character
+		static Word _words[SIZE];                  //!< Predefined names, at the positions of their hashes
+
+	public:
+
+	/*!
+		\brief   Copy the tokens and the slots of the predefined names from the table of symbols
+		\param   t: table of symbols, initialized by init()
+		\return  void
+	*/
+		static void bind(lp::Table & t);
+
+	/*!
+		\brief   Find a predefined name
+		\param   text: identifier, in lower case
+		\param   length: number of characters of the identifier, at least 1
+		\return  Word const *: the name, its token and its slot, or NULL if the identifier is not predefined
+	*/
+		static inline Word const *find(const char *text, size_t length)
+		{
+			Word const *word = &_words[position(text, length)];
+
+			if ((word->length != length) or (word->token == 0) or (memcmp(word->name, text, length) != 0))
+				return NULL;
+
+			return word;
+		}
+
+	private:
+
+	/*!
+		\brief   Position of a name in the table of words
+		\param   text: name, in lower case
+		\param   length: number of characters of the name, at least 1
+		\return  size_t: less than SIZE
+	*/
+		static inline size_t position(const char *text, size_t length)
+		{
+			const unsigned char *name = (const unsigned char *) text;
+			size_t hash = length + _values[name[0]] + _values[name[length - 1]];
+
+			if (length > 1)
+				hash += _values[name[1]];
+
+			return hash % SIZE;
+		}
+};
+
+// End of name space lp
+}
+
+// End of _RESERVED_HPP_
+#endif
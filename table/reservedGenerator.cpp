@@ -0,0 +1,251 @@
+/*!
+	\file    reservedGenerator.cpp
+	\brief   Generator of reserved.cpp: the perfect hash of the predefined names of the language
+	\author
+	\date    2025-06-06
+	\version 1.0
+	\note    The names are read from the standard input, one per line, and the
+	         file is written to the standard output. reserved.cpp is kept in the
+	         tree: "make reserved" in table/ writes it again from the names of
+	         init.hpp, and "make check-reserved" checks that it is up to date:
+
+	             sed -n 's/^[ \t]*{"\([a-z_0-9]*\)",.*$/\1/p' init.hpp | ./reservedGenerator.exe > reserved.cpp
+
+	         As gperf does, the values of the characters are searched for until
+	         no two names share a position. The search starts from the same seed
+	         every time, so the same names always give the same file.
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+
+// Number of positions of the table of words, as lp::Reserved::SIZE
+#define SIZE 128
+
+// Values tried from each starting point before starting again
+#define CHANGES 3000
+
+// Starting points before giving up
+#define ATTEMPTS 1000
+
+
+/*!
+	\brief   Pseudo-random numbers that are the same in every system, unlike rand
+	\param   limit: upper bound, not included
+	\return  int: from 0 to limit - 1
+*/
+static int next(int limit)
+{
+	static unsigned long state = 20250606UL;
+
+	state = (state * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+
+	return (int) ((state >> 8) % limit);
+}
+
+
+/*!
+	\brief   Characters of a name that take part in its hash: the first, the second and the last
+	\param   name: predefined name
+	\return  std::vector<unsigned char>
+	\note    A name of one character counts it twice, as lp::Reserved::position
+*/
+static std::vector<unsigned char> hashed(std::string const & name)
+{
+	std::vector<unsigned char> characters;
+
+	characters.push_back(name[0]);
+	characters.push_back(name[name.size() - 1]);
+
+	if (name.size() > 1)
+		characters.push_back(name[1]);
+
+	return characters;
+}
+
+
+/*!
+	\brief   Position of a name with the given values, as lp::Reserved::position
+	\param   name: predefined name
+	\param   values: value of each character
+	\return  int
+*/
+static int position(std::string const & name, std::vector<int> const & values)
+{
+	std::vector<unsigned char> characters = hashed(name);
+	int hash = name.size();
+
+	for (size_t i = 0; i < characters.size(); i++)
+		hash += values[characters[i]];
+
+	return hash % SIZE;
+}
+
+
+/*!
+	\brief   Search for the values of the characters that give each name its own position
+	\param   names: predefined names
+	\param   values: receives the value of each character
+	\return  bool: false if no values were found
+*/
+static bool search(std::vector<std::string> const & names, std::vector<int> & values)
+{
+	std::set<unsigned char> used;
+
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		std::vector<unsigned char> characters = hashed(names[i]);
+		used.insert(characters.begin(), characters.end());
+	}
+
+	for (int attempt = 0; attempt < ATTEMPTS; attempt++)
+	{
+		values.assign(256, 0);
+
+		for (std::set<unsigned char>::iterator it = used.begin(); it != used.end(); ++it)
+			values[*it] = next(SIZE);
+
+		for (int change = 0; change < CHANGES; change++)
+		{
+			std::vector<int> owner(SIZE, -1);
+			std::vector<int> colliding;
+
+			for (size_t i = 0; i < names.size(); i++)
+			{
+				int p = position(names[i], values);
+
+				if (owner[p] == -1)
+					owner[p] = i;
+				else
+				{
+					colliding.push_back(i);
+					colliding.push_back(owner[p]);
+				}
+			}
+
+			if (colliding.empty())
+				return true;
+
+			// A character of a colliding name takes another value
+			std::vector<unsigned char> characters = hashed(names[colliding[next(colliding.size())]]);
+
+			values[characters[next(characters.size())]] = next(SIZE);
+		}
+	}
+
+	return false;
+}
+
+
+int main()
+{
+	std::vector<std::string> names;
+	std::set<std::string> seen;
+	std::string name;
+
+	while (std::getline(std::cin, name))
+	{
+		if (name.empty() or (seen.count(name) > 0))
+			continue;
+
+		seen.insert(name);
+		names.push_back(name);
+	}
+
+	std::vector<int> values;
+
+	if ((names.size() > SIZE) or (not search(names, values)))
+	{
+		std::cerr << "reservedGenerator: no perfect hash of " << names.size() << " names in " << SIZE << " positions" << std::endl;
+		return 1;
+	}
+
+	std::vector<int> words(SIZE, -1);
+
+	for (size_t i = 0; i < names.size(); i++)
+		words[position(names[i], values)] = i;
+
+	std::cout << "/*!" << std::endl
+	          << "\t\\file    reserved.cpp" << std::endl
+	          << "\t\\brief   Code of the functions of the Reserved class" << std::endl
+	          << "\t\\author" << std::endl
+	          << "\t\\date    2025-06-06" << std::endl
+	          << "\t\\version 1.0" << std::endl
+	          << "\t\\note    Generated by reservedGenerator.cpp from the names of init.hpp: do not edit" << std::endl
+	          << "*/" << std::endl << std::endl
+	          << "#include <cassert>" << std::endl
+	          << "#include <cstddef>" << std::endl << std::endl
+	          << "#include \"reserved.hpp\"" << std::endl
+	          << "#include \"symbol.hpp\"" << std::endl << std::endl << std::endl;
+
+	std::cout << "// Values of the characters of the predefined names; the other characters are 0" << std::endl
+	          << "const unsigned char lp::Reserved::_values[256] =" << std::endl
+	          << "{" << std::endl;
+
+	for (int i = 0; i < 256; i++)
+	{
+		if (i % 16 == 0)
+			std::cout << "\t";
+
+		std::cout << std::setw(3) << values[i];
+
+		if (i < 255)
+			std::cout << ",";
+
+		std::cout << ((i % 16 == 15) ? "\n" : " ");
+	}
+
+	std::cout << "};" << std::endl << std::endl << std::endl;
+
+	std::cout << "// The positions of the names are given by their hashes with the values above" << std::endl
+	          << "lp::Reserved::Word lp::Reserved::_words[lp::Reserved::SIZE] =" << std::endl
+	          << "{" << std::endl;
+
+	for (int i = 0; i < SIZE; i++)
+	{
+		std::string word = "{NULL, 0}";
+
+		if (words[i] != -1)
+		{
+			std::ostringstream text;
+
+			text << "{\"" << names[words[i]] << "\", " << names[words[i]].size() << "}";
+			word = text.str();
+		}
+
+		if (i % 4 == 0)
+			std::cout << "\t";
+
+		if (i < SIZE - 1)
+			word += ",";
+
+		if (i % 4 == 3)
+			std::cout << word << std::endl;
+		else
+			std::cout << std::left << std::setw(22) << word;
+	}
+
+	std::cout << "};" << std::endl << std::endl << std::endl;
+
+	std::cout << "void lp::Reserved::bind(lp::Table & t)" << std::endl
+	          << "{" << std::endl
+	          << "\tfor (int i = 0; i < SIZE; i++)" << std::endl
+	          << "\t{" << std::endl
+	          << "\t\tif (_words[i].name == NULL)" << std::endl
+	          << "\t\t\tcontinue;" << std::endl << std::endl
+	          << "\t\tint slot = t.getSlot(_words[i].name);" << std::endl
+	          << "\t\tlp::Symbol *symbol = t.getSymbol(slot);" << std::endl << std::endl
+	          << "\t\t// Every name of the table of words is installed by init(), at the position of its hash" << std::endl
+	          << "\t\tassert(symbol != NULL);" << std::endl
+	          << "\t\tassert(position(_words[i].name, _words[i].length) == (size_t) i);" << std::endl << std::endl
+	          << "\t\t_words[i].token = symbol->getToken();" << std::endl
+	          << "\t\t_words[i].slot = slot;" << std::endl
+	          << "\t}" << std::endl
+	          << "}" << std::endl;
+
+	return 0;
+}
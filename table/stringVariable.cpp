@@ -32,7 +32,9 @@ void lp::StringVariable::read()
 
    // Own attribute
    std::cout << "Value of the StringVariable: ";
-   std::getline(std::cin, this->_value);
+   std::string value;
+   std::getline(std::cin, value);
+   this->setValue(value);
 }
 
 
@@ -60,7 +62,7 @@ lp::StringVariable &lp::StringVariable::operator=(const lp::StringVariable &s)
 		this->setType(s.getType());
 
 		// Own method
-		this->setValue(s.getValue());
+		this->setString(s.getSharedString());
 	}
 
 	// Return the current object
@@ -91,7 +93,9 @@ std::istream &operator>>(std::istream &i, lp::StringVariable &s)
   ////////////////////////////////////
 
   // Own attribute
-  std::getline(i, s._value);
+  std::string value;
+  std::getline(i, value);
+  s.setValue(value);
 
   ////////////////////////////////////
 
@@ -110,7 +114,7 @@ std::ostream &operator<<(std::ostream &o, lp::StringVariable const &s)
   o << s._type << std::endl;
 
   // Own attribute
-  o << s._value << std::endl;
+  o << s.getValue() << std::endl;
 
   // The output stream is returned
   return o;
@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include "variable.hpp"
+#include "value.hpp"
 
 /*!	
 	\namespace lp
@@ -24,15 +25,11 @@ namespace lp{
   \class StringVariable
   \brief Definition of attributes and methods of StringVariable class
   \note  StringVariable Class publicly inherits from Variable class
+  \note  The value is kept by Variable. The interpreter creates and reads every variable as a
+         Variable, with the accessors of its type, and never casts it to this class
 */
 class StringVariable : public lp::Variable
 {
-/*!		
-\name Private attributes of StringVariable class
-*/
-	private:
-		std::string _value;   //!< \brief String value of the StringVariable
-
 /*!		
 \name Public methods of StringVariable class
 */
@@ -77,7 +74,7 @@ class StringVariable : public lp::Variable
 		this->setType(s.getType());
 		
 		// Own method
-		this->setValue(s.getValue());
+		this->setString(s.getSharedString());
 	}
 
 
@@ -93,9 +90,9 @@ class StringVariable : public lp::Variable
     \return Value of the StringVariable
 	\sa		getValue
 */
-	inline std::string getValue() const
+	inline std::string const & getValue() const
 	{
-		return this->_value;
+		return this->_string.getString();
 	}
 
 
@@ -115,11 +112,9 @@ class StringVariable : public lp::Variable
 */
 	inline void setValue(const std::string & value)
 	{
-	    this->_value = value;
+	    this->_string = lp::Value(value);
 	}
 
-
-
 /*!	
 	\name I/O Functions
 */
@@ -38,6 +38,56 @@ lp::Symbol * lp::Table::getSymbol(const std::string & name)
 
 
 
+size_t lp::Table::findBucket(const std::string & name) const
+{
+	// FNV-1a hash of the name
+	unsigned long hash = 2166136261UL;
+
+	for (std::string::const_iterator c = name.begin(); c != name.end(); ++c)
+		hash = ((hash ^ (unsigned char) *c) * 16777619UL) & 0xffffffffUL;
+
+	// Open addressing: the buckets are a power of two and never full
+	size_t mask = this->_buckets.size() - 1;
+	size_t bucket = hash & mask;
+
+	while ((this->_buckets[bucket] >= 0) and (this->_names[this->_buckets[bucket]] != name))
+		bucket = (bucket + 1) & mask;
+
+	return bucket;
+}
+
+
+int lp::Table::getSlot(const std::string & name)
+{
+	size_t bucket = this->findBucket(name);
+
+	// The name is already bound to a slot
+	if (this->_buckets[bucket] >= 0)
+		return this->_buckets[bucket];
+
+	// A new slot is added with the name and the current symbol, if any
+	int slot = this->_store.size();
+
+	std::map<std::string, lp::Symbol *>::iterator symbol = this->_table.find(name);
+	this->_store.push_back(symbol != this->_table.end() ? symbol->second : NULL);
+	this->_names.push_back(name);
+
+	this->_buckets[bucket] = slot;
+
+	// The table of the names is kept at most half full
+	if (2 * this->_names.size() > this->_buckets.size())
+	{
+		this->_buckets.assign(2 * this->_buckets.size(), -1);
+
+		for (int i = 0; i < (int) this->_names.size(); i++)
+			this->_buckets[this->findBucket(this->_names[i])] = i;
+	}
+
+	return slot;
+}
+
+
+
 void lp::Table::installSymbol(Symbol * s)
 {
  #ifndef NDEBUG
@@ -48,6 +98,12 @@ void lp::Table::installSymbol(Symbol * s)
    // The pointer to symbol is inserted in the map
 	this->_table[s->getName()] = s;
 
+   // The slot bound to the name, if any, follows the new symbol
+	size_t bucket = this->findBucket(s->getName());
+
+	if (this->_buckets[bucket] >= 0)
+		this->_store[this->_buckets[bucket]] = s;
+
  #ifndef NDEBUG
   // Postcondition
    assert (this->lookupSymbol(s->getName()) == true);
@@ -66,6 +122,12 @@ void lp::Table::eraseSymbol(const std::string & name)
    // The symbol "name" is deleted from the map
 	this->_table.erase(name);
 
+   // The slot bound to the name, if any, is emptied
+	size_t bucket = this->findBucket(name);
+
+	if (this->_buckets[bucket] >= 0)
+		this->_store[this->_buckets[bucket]] = NULL;
+
  #ifndef NDEBUG
   // Postcondition
    assert (this->lookupSymbol(name) == false);
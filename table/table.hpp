@@ -14,6 +14,10 @@
 
 #include <map>
 
+#include <vector>
+
+#include <deque>
+
 #include "tableInterface.hpp"
 
 
@@ -36,6 +40,17 @@ class Table: public lp::TableInterface
 	private:
 	std::map<std::string, lp::Symbol *> _table;   //!< map of strings and pointers to Symbol
 
+	std::deque<std::string> _names;         //!< intern pool: each name once, indexed by slot, never moved
+	std::vector<int> _buckets;              //!< hash table of the names: slot of each bucket, -1 if empty
+	std::vector<lp::Symbol *> _store;       //!< store of the Symbols bound to the AST, indexed by slot
+
+	/*!
+		\brief  Find the bucket of a name in the hash table of the names
+		\param  name: name of a Symbol
+		\return Index of the bucket of the name, or of the empty bucket where it would be
+	*/
+	size_t findBucket(const std::string & name) const;
+
 /*!		
 \name Public methods of Table class
 */
@@ -56,6 +71,9 @@ class Table: public lp::TableInterface
 	{
 		// The method of STL is used.
 		this->_table.clear();
+		this->_names.clear();
+		this->_buckets.assign(64, -1);
+		this->_store.clear();
 	}
 
 /*!	
@@ -72,6 +90,9 @@ class Table: public lp::TableInterface
 	{
 		// The method of STL is used.
 		this->_table.clear();
+		this->_names.clear();
+		this->_buckets.clear();
+		this->_store.clear();
 	}
 
 
@@ -97,6 +118,42 @@ class Table: public lp::TableInterface
 */
 	lp::Symbol * getSymbol(const std::string & name);
 
+/*!
+	\brief  Get the pointer to Symbol saved in a slot of the store
+	\param  slot: slot returned by getSlot()
+	\pre    The slot must have been returned by getSlot()
+	\return The Symbol currently bound to the slot or NULL if it has been erased
+	\note   Inline function: no string is compared
+	\sa     getSlot(), getSymbol()
+*/
+	inline lp::Symbol * getSymbol(int slot) const
+	{
+		return this->_store[slot];
+	}
+
+/*!
+	\brief  Get the slot of the store bound to the name of a Symbol
+	\param  name: name of the Symbol
+	\post   The slot keeps following the Symbol "name" when it is erased and installed again
+	\note   The names are interned: the first call with a name stores it once, in a new slot
+	\return Index of the slot
+	\sa     getSymbol()
+*/
+	int getSlot(const std::string & name);
+
+/*!
+	\brief  Get the name interned in a slot
+	\param  slot: slot returned by getSlot()
+	\pre    The slot must have been returned by getSlot()
+	\return The only copy of the name kept by the Table; its address never changes
+	\note   Inline function: the nodes of the AST keep their slots instead of copies of their names
+	\sa     getSlot()
+*/
+	inline const std::string & getName(int slot) const
+	{
+		return this->_names[slot];
+	}
+
 
 /*!		
 	\brief   Check if the Table is empty
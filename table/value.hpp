@@ -0,0 +1,259 @@
+/*!
+	\file    value.hpp
+	\brief   Declaration of Value class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _VALUE_HPP_
+#define _VALUE_HPP_
+
+#include <string>
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Value
+  \brief Value of an expression tagged with its type
+  \note  A Value takes 16 bytes: the tag and a union of the payloads.
+         The strings are shared by a reference counted handle,
+         so copying a Value never copies the characters of a string,
+         and a string held by a single value grows in place.
+*/
+class Value
+{
+	public:
+
+/*!
+	\brief Tags of the values
+*/
+	enum Tag
+	{
+		EMPTY,    //!< No value: the expression has an invalid type
+		NUMBER,   //!< Payload _number
+		BOOL,     //!< Payload _logic
+		STRING    //!< Payload _string
+	};
+
+	private:
+
+/*!
+  \struct Shared
+  \brief  String shared by several values
+*/
+	struct Shared
+	{
+		int references;   //!< Number of values that hold the string
+		std::string text; //!< Characters of the string
+
+		Shared(std::string const & t): references(1), text(t)
+		{
+			// Empty
+		}
+	};
+
+	int _tag; //!< \brief Tag of the value
+
+	union
+	{
+		double _number;   //!< \brief Payload of a NUMBER
+		bool _logic;      //!< \brief Payload of a BOOL
+		Shared *_string;  //!< \brief Payload of a STRING
+	};
+
+/*!
+	\brief   Drop the reference to the string, if any
+	\post    The string is deleted when no value holds it
+	\return  void
+*/
+	inline void release()
+	{
+		if ((this->_tag == STRING) and (--this->_string->references == 0))
+			delete this->_string;
+	}
+
+	public:
+
+/*!
+	\name Constructors
+*/
+
+/*!
+	\brief Constructor of an EMPTY value
+	\note  Inline function
+*/
+	inline Value(): _tag(EMPTY), _number(0.0)
+	{
+		// Empty
+	}
+
+/*!
+	\brief Constructor of a NUMBER
+	\param number: value of the number
+	\note  Inline function
+*/
+	inline explicit Value(double number): _tag(NUMBER), _number(number)
+	{
+		// Empty
+	}
+
+/*!
+	\brief Constructor of a BOOL
+	\param logic: value of the boolean
+	\note  Inline function
+*/
+	inline explicit Value(bool logic): _tag(BOOL), _logic(logic)
+	{
+		// Empty
+	}
+
+/*!
+	\brief Constructor of a STRING
+	\param text: characters of the string, copied once into the shared handle
+	\note  Inline function
+*/
+	inline explicit Value(std::string const & text): _tag(STRING), _string(new Shared(text))
+	{
+		// Empty
+	}
+
+/*!
+	\brief Copy constructor
+	\param v: object of Value class
+	\post  A string is shared with v, not copied
+	\note  Inline function
+*/
+	inline Value(Value const & v): _tag(v._tag), _number(v._number)
+	{
+		if (this->_tag == STRING)
+		{
+			this->_string = v._string;
+			this->_string->references++;
+		}
+	}
+
+/*!
+	\brief Destructor
+	\note  Inline function
+*/
+	inline ~Value()
+	{
+		this->release();
+	}
+
+
+/*!
+	\name Observers
+*/
+
+/*!
+	\brief  Tag of the value
+	\return int: EMPTY, NUMBER, BOOL or STRING
+*/
+	inline int getTag() const
+	{
+		return this->_tag;
+	}
+
+/*!
+	\brief  Payload of a NUMBER
+	\pre    The tag is NUMBER
+	\return double
+*/
+	inline double getNumber() const
+	{
+		return this->_number;
+	}
+
+/*!
+	\brief  Payload of a BOOL
+	\pre    The tag is BOOL
+	\return bool
+*/
+	inline bool getBool() const
+	{
+		return this->_logic;
+	}
+
+/*!
+	\brief  Payload of a STRING
+	\pre    The tag is STRING
+	\return Reference to the shared characters, valid while this value holds them
+*/
+	inline std::string const & getString() const
+	{
+		return this->_string->text;
+	}
+
+
+/*!
+	\name Operators
+*/
+
+/*!
+	\brief  Assignment Operator
+	\param  v: object of Value class
+	\post   A string is shared with v, not copied
+	\return Reference to this object
+*/
+	inline Value & operator=(Value const & v)
+	{
+		// The new string is retained first, so that v may be this object
+		if (v._tag == STRING)
+			v._string->references++;
+
+		this->release();
+
+		this->_tag = v._tag;
+		this->_number = v._number;
+
+		if (this->_tag == STRING)
+			this->_string = v._string;
+
+		return *this;
+	}
+
+
+/*!
+	\name Modifiers
+*/
+
+/*!
+	\brief  Append characters to a STRING
+	\param  text: characters to append, which may belong to another value
+	\pre    The tag is STRING
+	\post   The string is appended in place when no other value holds it; otherwise
+	        this value gets its own copy first, with room to double, so a string that
+	        grows again and again is copied a logarithmic number of times
+	\return void
+*/
+	inline void append(std::string const & text)
+	{
+		if (this->_string->references > 1)
+		{
+			Shared *copy = new Shared(std::string());
+
+			copy->text.reserve(2 * (this->_string->text.size() + text.size()));
+			copy->text.append(this->_string->text);
+
+			// The other values keep the old string
+			this->_string->references--;
+			this->_string = copy;
+		}
+
+		this->_string->text.append(text);
+	}
+
+// End of Value class
+};
+
+// End of name space lp
+}
+
+// End of _VALUE_HPP_
+#endif
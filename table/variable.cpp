@@ -13,6 +13,31 @@
 
 
 
+lp::Variable::~Variable()
+{
+	for (size_t i = 0; i < this->_orphans.size(); i++)
+		delete this->_orphans[i];
+}
+
+
+void lp::Variable::retype(int type)
+{
+	// The loops that count on the Variable go on counting on a copy of its number,
+	// which is numeric while the Variable is armed
+	if (this->_armed > 0)
+	{
+		lp::Variable *orphan = new lp::Variable(this->getName(), this->getToken(), this->getType());
+
+		orphan->setNumber(this->_number);
+		this->_orphans.push_back(orphan);
+		this->_armed = 0;
+	}
+
+	this->_type = type;
+	this->_string = lp::Value();
+}
+
+
 /*
 	Operator
 */
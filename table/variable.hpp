@@ -11,9 +11,12 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "symbol.hpp"
 
+#include "value.hpp"
+
 /*!	
 	\namespace lp
 	\brief Name space for the subject Language Processors
@@ -22,9 +25,16 @@ namespace lp{
 
 /*!	
   \class     Variable
-  \attention Abstrac class
   \brief     Definition of atributes and methods of Variable class
   \note      Variable Class publicly inherits from Symbol class
+  \note      A Variable holds a value of each type, read and written by the
+             accessors of its current type. When an assignment changes the
+             type of a Variable, the same object is retyped in place, so its
+             address, cached by the engines, stays valid and the table is not
+             changed
+  \note      A for loop counts on the number of its variable. When the body
+             gives the variable another type, the loop goes on counting on a
+             copy of its last number that the body does not see: see arm
 */
 class Variable:public lp::Symbol
 {
@@ -33,6 +43,11 @@ class Variable:public lp::Symbol
 */
 	protected:
 		int      	_type;    //!< \brief Type of the  Variable: UNDEFINED, NUMERICVAR, STRINGVAR, LOGICALVAR
+		double   	_number;  //!< \brief Value of the Variable while it is numeric
+		bool     	_logic;   //!< \brief Value of the Variable while it is logical
+		lp::Value	_string;  //!< \brief Value of the Variable while it is a string, shared with the expressions that read it
+		int      	_armed;   //!< \brief Number of for loops that count on the Variable
+		std::vector<Variable *> _orphans; //!< \brief Copies that the for loops detached from the Variable count on, in order
 
 /*!		
 \name Public methods of Variable class
@@ -53,7 +68,7 @@ class Variable:public lp::Symbol
 	\post  A new Variable is created with the values of the parameters
 	\sa   setName, setToken, setType
 */
-	inline Variable(std::string name="", int token = 0, int type = 0): Symbol(name,token)
+	inline Variable(std::string name="", int token = 0, int type = 0): Symbol(name,token), _number(0.0), _logic(false), _armed(0)
 	{
 		this->setType(type);
 	}
@@ -66,7 +81,7 @@ class Variable:public lp::Symbol
 	\post  A new Variable is created with the values of an existent Variable
 	\sa    setName, setValue
 */
-	inline Variable(const Variable & s)
+	inline Variable(const Variable & s): _number(0.0), _logic(false), _armed(0)
 	{
 		// Inherited methods
 		this->setName(s.getName());
@@ -76,6 +91,12 @@ class Variable:public lp::Symbol
 		this->setType(s.getType());
 	}
 
+/*!		
+	\brief Destructor
+	\note  The copies detached by the for loops are deleted
+*/
+	virtual ~Variable();
+
 
 /*!	
 	\name Observer
@@ -94,6 +115,71 @@ class Variable:public lp::Symbol
 		return this->_type;
 	}	
 
+/*!	
+	\brief  Public method that returns the value of the Variable while it is numeric
+	\note   Inline function
+	\pre    The type of the Variable is NUMBER
+	\post   None
+    \return double
+	\sa		setNumber
+*/
+	inline double getNumber() const
+	{
+		return this->_number;
+	}
+
+/*!	
+	\brief  Public method that returns the address of the numeric value of the Variable
+	\note   Inline function. The machine code of the loops reads and writes the value through it
+	\pre    None
+	\post   None
+    \return Address of the value, valid while the Variable is in the table
+	\sa		getNumber
+*/
+	inline double *getAddress()
+	{
+		return &this->_number;
+	}
+
+/*!	
+	\brief  Public method that returns the value of the Variable while it is logical
+	\note   Inline function
+	\pre    The type of the Variable is BOOL
+	\post   None
+    \return bool
+	\sa		setLogical
+*/
+	inline bool getLogical() const
+	{
+		return this->_logic;
+	}
+
+/*!	
+	\brief  Public method that returns the value of the Variable while it is a string
+	\note   Inline function
+	\pre    The type of the Variable is STRING
+	\post   None
+    \return std::string const &
+	\sa		getSharedString, setString
+*/
+	inline std::string const & getString() const
+	{
+		return this->_string.getString();
+	}
+
+/*!	
+	\brief  Public method that returns the string of the Variable without copying it
+	\note   Inline function
+	\pre    The type of the Variable is STRING
+	\post   None
+    \return lp::Value const &: shares the string with the Variable
+	\sa		getString
+*/
+	inline lp::Value const & getSharedString() const
+	{
+		return this->_string;
+	}
+
 
 /*!	
 	\name Modifier
@@ -114,6 +200,142 @@ class Variable:public lp::Symbol
 	    this->_type = type;
 	}
 
+/*!	
+	\brief   Change the type of the Variable in place
+	\note    The string of the Variable is released; the caller stores the value of the new type.
+	         The for loops that count on the Variable are detached from it: see arm
+	\param   type: new type of the Variable
+	\pre     None
+	\post    The type of the Variable is equal to the parameter and its string is empty
+	\return  void
+	\sa 	 setType
+*/
+	void retype(int type);
+
+/*!	
+	\brief   This functions modifies the numeric value of the Variable
+	\note    Inline function
+	\param   value: new value
+	\pre     The type of the Variable is NUMBER
+	\post    The numeric value of the Variable is equal to the parameter
+	\return  void
+	\sa 	 getNumber
+*/
+	inline void setNumber(double value)
+	{
+	    this->_number = value;
+	}
+
+/*!	
+	\brief   This functions modifies the logical value of the Variable
+	\note    Inline function
+	\param   value: new value
+	\pre     The type of the Variable is BOOL
+	\post    The logical value of the Variable is equal to the parameter
+	\return  void
+	\sa 	 getLogical
+*/
+	inline void setLogical(bool value)
+	{
+	    this->_logic = value;
+	}
+
+/*!	
+	\brief   This functions modifies the string of the Variable
+	\note    Inline function
+	\param   value: new value
+	\pre     The type of the Variable is STRING
+	\post    The string of the Variable is equal to the parameter
+	\return  void
+	\sa 	 getString
+*/
+	inline void setString(const std::string & value)
+	{
+	    this->_string = lp::Value(value);
+	}
+
+/*!	
+	\brief   This functions shares a string with the Variable
+	\note    Inline function
+	\param   value: a Value holding a string
+	\pre     The type of the Variable is STRING
+	\post    The Variable shares the string of the parameter
+	\return  void
+	\sa 	 getSharedString
+*/
+	inline void setString(const lp::Value & value)
+	{
+	    this->_string = value;
+	}
+
+/*!	
+	\brief   Append a text to the string of the Variable
+	\note    Inline function. The string is copied only if it is shared
+	\param   text: text appended
+	\pre     The type of the Variable is STRING
+	\post    The string of the Variable ends with the parameter
+	\return  void
+	\sa 	 setString
+*/
+	inline void append(const std::string & text)
+	{
+	    this->_string.append(text);
+	}
+
+
+/*!	
+	\name For loops
+*/
+
+/*!	
+	\brief   A for loop starts counting on the Variable
+	\note    Before the variables were retyped in place, a type change replaced the
+	         Variable in the table, and the loops went on counting on the old one.
+	         The next retype keeps that: it copies the number of the Variable, and
+	         the loops armed before it count on the copy from their next step
+	\pre     The type of the Variable is NUMBER
+	\post    The Variable is armed
+	\return  int: generation of the loop, to be given to counter
+	\sa 	 counter, disarm, retype
+*/
+	inline int arm()
+	{
+	    this->_armed++;
+	    return this->_orphans.size();
+	}
+
+/*!	
+	\brief   A for loop armed by arm ends
+	\note    Inline function. The loops run as machine code are not counted: they end
+	         without disarming, and the next retype only copies a number that no loop reads
+	\pre     None
+	\post    The Variable is disarmed when no other loop counts on it
+	\return  void
+	\sa 	 arm
+*/
+	inline void disarm()
+	{
+	    if (this->_armed > 0)
+	        this->_armed--;
+	}
+
+/*!	
+	\brief   Variable that a for loop counts on
+	\note    Inline function
+	\param   generation: value returned by arm when the loop started
+	\pre     None
+	\post    None
+	\return  Variable *: the copy detached by the first retype after the loop started, or this Variable
+	\sa 	 arm
+*/
+	inline Variable *counter(int generation)
+	{
+	    if (generation < (int) this->_orphans.size())
+	        return this->_orphans[generation];
+
+	    return this;
+	}
+
 
 /*!	
 	\name Operator
@@ -0,0 +1,148 @@
+/*!
+	\file    bytecode.cpp
+	\brief   Code of the functions of the Chunk class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <iomanip>
+
+#include "bytecode.hpp"
+
+
+/*!
+  \brief Names of the opcodes and number of operands, in the order of OpCode
+*/
+static const struct
+{
+	const char *name;
+	int operands;
+} opcodes[lp::OP_COUNT] =
+{
+	{"PUSH_NUMBER", 1}, {"PUSH_STRING", 1}, {"PUSH_TRUE", 0}, {"PUSH_FALSE", 0},
+	{"LOAD", 1}, {"LOAD_NUMBER", 2}, {"LOAD_BOOL", 2}, {"LOAD_STRING", 2}, {"POP", 0},
+	{"FALLBACK", 1}, {"EVAL", 1}, {"EVAL_NUMBER", 1}, {"EVAL_BOOL", 1}, {"EVAL_STRING", 1},
+	{"EXECUTE", 1},
+	{"NEGATE", 0}, {"INCREMENT", 0}, {"DECREMENT", 0}, {"FACTORIAL", 1},
+	{"ADD", 0}, {"SUBTRACT", 0}, {"MULTIPLY", 0}, {"DIVIDE", 1}, {"INTEGER_DIVIDE", 1},
+	{"MODULO", 1}, {"POWER", 0}, {"CALL_0", 1}, {"CALL_1", 1}, {"CALL_2", 1},
+	{"CONCATENATE", 0}, {"GREATER", 1}, {"GREATER_EQUAL", 1}, {"LESS", 1},
+	{"LESS_EQUAL", 1}, {"EQUAL", 1}, {"NOT_EQUAL", 1}, {"AND", 0}, {"OR", 0}, {"NOT", 0},
+	{"STORE", 2}, {"COPY", 2}, {"PLUS_ASSIGN", 2}, {"MINUS_ASSIGN", 2}, {"APPEND", 2}, {"PRINT", 1},
+	{"READ", 1}, {"READ_STRING", 1}, {"INCREMENT_VARIABLE", 2}, {"DECREMENT_VARIABLE", 2},
+	{"FACTORIAL_VARIABLE", 2}, {"CLEAR_SCREEN", 0},
+	{"JUMP", 1}, {"JUMP_IF_FALSE", 1}, {"JUMP_IF_TRUE", 1}, {"CHECK_NUMBER", 2},
+	{"FOR_INTERVAL", 1}, {"FOR_VARIABLE", 2}, {"FOR_STEP", 1}, {"FOR_TEST", 1},
+	{"FOR_NEXT", 1}, {"CASE", 1}, {"HALT", 0}
+};
+
+
+int lp::Chunk::addNumber(double number)
+{
+	this->_numbers.push_back(number);
+
+	return this->_numbers.size() - 1;
+}
+
+
+int lp::Chunk::addString(std::string const & string)
+{
+	this->_strings.push_back(string);
+
+	return this->_strings.size() - 1;
+}
+
+
+int lp::Chunk::addNode(lp::ExpNode *node)
+{
+	this->_nodes.push_back(node);
+
+	return this->_nodes.size() - 1;
+}
+
+
+int lp::Chunk::addStatement(lp::Statement *stmt)
+{
+	this->_statements.push_back(stmt);
+
+	return this->_statements.size() - 1;
+}
+
+
+int lp::Chunk::addRoot(lp::ExpNode *node, int type, int depth, int start, int destination, int statement)
+{
+	lp::Root root;
+
+	root.node = node;
+	root.type = type;
+	root.depth = depth;
+	root.start = start;
+	root.destination = destination;
+	root.statement = statement;
+	root.resume = -1;
+
+	this->_roots.push_back(root);
+
+	return this->_roots.size() - 1;
+}
+
+
+void lp::Chunk::nameSlot(int slot, std::string const & name)
+{
+	if ((int) this->_names.size() <= slot)
+		this->_names.resize(slot + 1);
+
+	this->_names[slot] = name;
+}
+
+
+int lp::Chunk::addFunction(lp::TypePointerDoubleFunction_0 f)
+{
+	this->_functions0.push_back(f);
+
+	return this->_functions0.size() - 1;
+}
+
+
+int lp::Chunk::addFunction(lp::TypePointerDoubleFunction_1 f)
+{
+	this->_functions1.push_back(f);
+
+	return this->_functions1.size() - 1;
+}
+
+
+int lp::Chunk::addFunction(lp::TypePointerDoubleFunction_2 f)
+{
+	this->_functions2.push_back(f);
+
+	return this->_functions2.size() - 1;
+}
+
+
+void lp::Chunk::disassemble() const
+{
+	unsigned int pc = 0;
+
+	while (pc < this->_code.size())
+	{
+		int op = this->_code[pc];
+
+		std::cout << std::setw(5) << pc << "  " << opcodes[op].name;
+
+		for (int i = 1; i <= opcodes[op].operands; i++)
+			std::cout << " " << this->_code[pc + i];
+
+		// Constants are shown with their values
+		if (op == lp::OP_PUSH_NUMBER)
+			std::cout << "\t(" << this->_numbers[this->_code[pc + 1]] << ")";
+		else if (op == lp::OP_PUSH_STRING)
+			std::cout << "\t('" << this->_strings[this->_code[pc + 1]] << "')";
+
+		std::cout << std::endl;
+
+		pc += 1 + opcodes[op].operands;
+	}
+}
@@ -0,0 +1,302 @@
+/*!
+	\file    bytecode.hpp
+	\brief   Declaration of the bytecode executed by the virtual machine
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _BYTECODE_HPP_
+#define _BYTECODE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../ast/ast.hpp"
+
+#include "../table/builtinParameter0.hpp"
+#include "../table/builtinParameter1.hpp"
+#include "../table/builtinParameter2.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \enum  OpCode
+  \brief Instructions of the virtual machine
+  \note  The operands follow the opcode in the code of the Chunk.
+         "root" is the index of the expression that is evaluated again by the AST
+         when an instruction finds a type or a value that it cannot handle;
+         "stmt" is the index of the statement that is evaluated again by the AST
+         to report an error.
+*/
+enum OpCode
+{
+	// Constants and variables
+	OP_PUSH_NUMBER,     //!< number: push a numeric constant
+	OP_PUSH_STRING,     //!< string: push a string constant
+	OP_PUSH_TRUE,       //!< push true
+	OP_PUSH_FALSE,      //!< push false
+	OP_LOAD,            //!< slot: push a variable with its current type
+	OP_LOAD_NUMBER,     //!< slot root: push a numeric variable
+	OP_LOAD_BOOL,       //!< slot root: push a logical variable
+	OP_LOAD_STRING,     //!< slot root: push a string variable
+	OP_POP,             //!< discard the top of the stack
+
+	// Escapes to the AST
+	OP_FALLBACK,        //!< root: evaluate the whole expression with the AST
+	OP_EVAL,            //!< node: evaluate an expression with its current type
+	OP_EVAL_NUMBER,     //!< node: evaluate an expression as NUMBER
+	OP_EVAL_BOOL,       //!< node: evaluate an expression as BOOL
+	OP_EVAL_STRING,     //!< node: evaluate an expression as STRING
+	OP_EXECUTE,         //!< stmt: evaluate a statement
+
+	// Numeric operators
+	OP_NEGATE,          //!< unary minus
+	OP_INCREMENT,       //!< value + 1
+	OP_DECREMENT,       //!< value - 1
+	OP_FACTORIAL,       //!< root: factorial
+	OP_ADD,             //!< addition
+	OP_SUBTRACT,        //!< subtraction
+	OP_MULTIPLY,        //!< multiplication
+	OP_DIVIDE,          //!< root: division
+	OP_INTEGER_DIVIDE,  //!< root: integer division
+	OP_MODULO,          //!< root: modulo
+	OP_POWER,           //!< power
+	OP_CALL_0,          //!< function: builtin function without parameters
+	OP_CALL_1,          //!< function: builtin function with one parameter
+	OP_CALL_2,          //!< function: builtin function with two parameters
+
+	// String, relational and logical operators
+	OP_CONCATENATE,     //!< concatenation
+	OP_GREATER,         //!< root: greater than
+	OP_GREATER_EQUAL,   //!< root: greater or equal than
+	OP_LESS,            //!< root: less than
+	OP_LESS_EQUAL,      //!< root: less or equal than
+	OP_EQUAL,           //!< root: equal
+	OP_NOT_EQUAL,       //!< root: not equal
+	OP_AND,             //!< logical and
+	OP_OR,              //!< logical or
+	OP_NOT,             //!< logical not
+
+	// Statements
+	OP_STORE,           //!< slot stmt: assign the top of the stack to a variable
+	OP_COPY,            //!< slot slot: multiple assignment, copy the second variable to the first one
+	OP_PLUS_ASSIGN,     //!< slot stmt: +:=
+	OP_MINUS_ASSIGN,    //!< slot stmt: -:=
+	OP_APPEND,          //!< slot stmt: s := s || e, append the top of the stack to the string of a variable
+	OP_PRINT,           //!< stmt: print the top of the stack
+	OP_READ,            //!< slot: read a number
+	OP_READ_STRING,     //!< slot: read a string
+	OP_INCREMENT_VARIABLE, //!< slot stmt: ++
+	OP_DECREMENT_VARIABLE, //!< slot stmt: --
+	OP_FACTORIAL_VARIABLE, //!< slot stmt: !
+	OP_CLEAR_SCREEN,    //!< clear the screen
+
+	// Control flow
+	OP_JUMP,            //!< address: unconditional jump
+	OP_JUMP_IF_FALSE,   //!< address: pop a bool and jump if it is false
+	OP_JUMP_IF_TRUE,    //!< address: pop a bool and jump if it is true
+	OP_CHECK_NUMBER,    //!< node stmt: the bound of a for statement must be numeric
+	OP_FOR_INTERVAL,    //!< stmt: pop "from" and "to" and check the interval
+	OP_FOR_VARIABLE,    //!< slot stmt: pop "from" and push the loop variable
+	OP_FOR_STEP,        //!< stmt: check the step at the top of the stack
+	OP_FOR_TEST,        //!< address: pop "to" and exit the loop when the variable exceeds it
+	OP_FOR_NEXT,        //!< address: add the step to the loop variable and jump to the test
+	OP_CASE,            //!< address: pop a case value and jump if it does not match the switch value
+	OP_HALT,            //!< end of the program
+
+	OP_COUNT            //!< Number of opcodes
+};
+
+
+/*!
+  \struct Root
+  \brief  Expression evaluated by the AST when its bytecode cannot go on
+  \note   The expressions have no side effects, so they can be evaluated again from the beginning
+*/
+struct Root
+{
+	lp::ExpNode *node;  //!< Expression as written in the program
+	int type;           //!< NUMBER, BOOL or STRING; 0 when the statement asks for the type of the expression
+	int depth;          //!< Depth of the stack before the expression is evaluated (stack machine)
+	int start;          //!< Address of the first instruction of the expression (register machine)
+	int destination;    //!< Operand that receives the value of the expression (register machine)
+	int statement;      //!< Statement evaluated again by the AST when the type is 0 (register machine)
+	int resume;         //!< Address of the first instruction after the expression
+};
+
+
+/*!
+  \class Chunk
+  \brief Linear bytecode of a program and its tables of operands
+*/
+class Chunk
+{
+	private:
+		std::vector<int> _code;                  //!< Opcodes and their operands
+		std::vector<double> _numbers;            //!< Numeric constants
+		std::vector<std::string> _strings;       //!< String constants
+		std::vector<lp::ExpNode *> _nodes;       //!< Expressions used to report the errors
+		std::vector<lp::Statement *> _statements; //!< Statements used to report the errors
+		std::vector<lp::Root> _roots;            //!< Expressions evaluated again by the AST
+		std::vector<std::string> _names;         //!< Names of the variables, indexed by slot
+		std::vector<lp::TypePointerDoubleFunction_0> _functions0; //!< Builtin functions without parameters
+		std::vector<lp::TypePointerDoubleFunction_1> _functions1; //!< Builtin functions with one parameter
+		std::vector<lp::TypePointerDoubleFunction_2> _functions2; //!< Builtin functions with two parameters
+		int _maxStack;                           //!< Maximum depth of the stack
+
+	public:
+
+	/*!
+		\brief Constructor of Chunk
+		\post  An empty Chunk is created
+	*/
+		Chunk(): _maxStack(0)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Append an opcode or an operand to the code
+		\param   word: opcode or operand
+		\return  int: address of the word
+	*/
+		inline int emit(int word)
+		{
+			this->_code.push_back(word);
+
+			return this->_code.size() - 1;
+		}
+
+	/*!
+		\brief   Change an operand already emitted
+		\param   address: address of the operand
+		\param   word: new value of the operand
+		\return  void
+	*/
+		inline void patch(int address, int word)
+		{
+			this->_code[address] = word;
+		}
+
+	/*!
+		\brief   Address of the next word to be emitted
+		\return  int
+	*/
+		inline int size() const
+		{
+			return this->_code.size();
+		}
+
+	/*!
+		\brief   Add a numeric constant
+		\return  int: index of the constant
+	*/
+		int addNumber(double number);
+
+	/*!
+		\brief   Add a string constant
+		\return  int: index of the constant
+	*/
+		int addString(std::string const & string);
+
+	/*!
+		\brief   Add an expression used to report the errors
+		\return  int: index of the expression
+	*/
+		int addNode(lp::ExpNode *node);
+
+	/*!
+		\brief   Add a statement used to report the errors
+		\return  int: index of the statement
+	*/
+		int addStatement(lp::Statement *stmt);
+
+	/*!
+		\brief   Add an expression that can be evaluated again by the AST
+		\param   node: expression
+		\param   type: type asked by the statement or 0
+		\param   depth: depth of the stack before the expression
+		\param   start: address of the first instruction of the expression
+		\param   destination: operand that receives the value of the expression
+		\param   statement: statement evaluated again instead of the expression
+		\return  int: index of the root
+		\note    The resume address is set by setResume() once the expression is compiled
+	*/
+		int addRoot(lp::ExpNode *node, int type, int depth, int start = -1, int destination = 0, int statement = -1);
+
+	/*!
+		\brief   Set the address that follows the bytecode of a root
+		\return  void
+	*/
+		inline void setResume(int root, int address)
+		{
+			this->_roots[root].resume = address;
+		}
+
+	/*!
+		\brief   Set the operand that receives the value of a root
+		\return  void
+	*/
+		inline void setDestination(int root, int destination)
+		{
+			this->_roots[root].destination = destination;
+		}
+
+	/*!
+		\brief   Record the name of the variable bound to a slot
+		\return  void
+	*/
+		void nameSlot(int slot, std::string const & name);
+
+	/*!
+		\brief   Add builtin functions
+		\return  int: index of the function
+	*/
+		int addFunction(lp::TypePointerDoubleFunction_0 f);
+		int addFunction(lp::TypePointerDoubleFunction_1 f);
+		int addFunction(lp::TypePointerDoubleFunction_2 f);
+
+	/*!
+		\brief   Record the depth of the stack reached by the code
+		\param   depth: current depth of the stack
+		\return  void
+	*/
+		inline void reachStack(int depth)
+		{
+			if (depth > this->_maxStack)
+				this->_maxStack = depth;
+		}
+
+	/*!
+		\name Observers used by the virtual machine
+	*/
+		inline const std::vector<int> & getCode() const { return this->_code; }
+		inline const std::vector<double> & getNumbers() const { return this->_numbers; }
+		inline const std::vector<std::string> & getStrings() const { return this->_strings; }
+		inline const std::vector<lp::ExpNode *> & getNodes() const { return this->_nodes; }
+		inline const std::vector<lp::Statement *> & getStatements() const { return this->_statements; }
+		inline const std::vector<lp::Root> & getRoots() const { return this->_roots; }
+		inline const std::string & getName(int slot) const { return this->_names[slot]; }
+		inline const std::vector<lp::TypePointerDoubleFunction_0> & getFunctions0() const { return this->_functions0; }
+		inline const std::vector<lp::TypePointerDoubleFunction_1> & getFunctions1() const { return this->_functions1; }
+		inline const std::vector<lp::TypePointerDoubleFunction_2> & getFunctions2() const { return this->_functions2; }
+		inline int getMaxStack() const { return this->_maxStack; }
+
+	/*!
+		\brief   Print the bytecode in a readable form
+		\return  void
+	*/
+		void disassemble() const;
+};
+
+// End of name space lp
+}
+
+// End of _BYTECODE_HPP_
+#endif
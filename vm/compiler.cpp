@@ -0,0 +1,690 @@
+/*!
+	\file    compiler.cpp
+	\brief   Code of the functions of the Compiler class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <list>
+
+#include "compiler.hpp"
+
+#include "../table/table.hpp"
+#include "../table/numericConstant.hpp"
+#include "../table/logicalConstant.hpp"
+#include "../table/builtinParameter0.hpp"
+#include "../table/builtinParameter1.hpp"
+#include "../table/builtinParameter2.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief  Check if an instruction needs the root of its expression
+  \param  opcode: instruction
+  \return true if the instruction can find a value that must be reported by the AST
+*/
+static bool hasRoot(int opcode)
+{
+	switch (opcode)
+	{
+		case lp::OP_FACTORIAL:
+		case lp::OP_DIVIDE:
+		case lp::OP_INTEGER_DIVIDE:
+		case lp::OP_MODULO:
+		case lp::OP_GREATER:
+		case lp::OP_GREATER_EQUAL:
+		case lp::OP_LESS:
+		case lp::OP_LESS_EQUAL:
+		case lp::OP_EQUAL:
+		case lp::OP_NOT_EQUAL:
+			return true;
+	}
+
+	return false;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Compiler::emit(int opcode)
+{
+	this->_chunk->emit(opcode);
+}
+
+void lp::Compiler::emit(int opcode, int operand)
+{
+	this->_chunk->emit(opcode);
+	this->_chunk->emit(operand);
+}
+
+void lp::Compiler::emit(int opcode, int operand1, int operand2)
+{
+	this->_chunk->emit(opcode);
+	this->_chunk->emit(operand1);
+	this->_chunk->emit(operand2);
+}
+
+int lp::Compiler::emitJump(int opcode)
+{
+	this->_chunk->emit(opcode);
+
+	// The address is patched when the target is known
+	return this->_chunk->emit(-1);
+}
+
+void lp::Compiler::patchJump(int address)
+{
+	this->_chunk->patch(address, this->_chunk->size());
+}
+
+void lp::Compiler::push()
+{
+	this->_depth++;
+	this->_chunk->reachStack(this->_depth);
+}
+
+void lp::Compiler::pop(int n)
+{
+	this->_depth -= n;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::Compiler::compile(lp::AST *root)
+{
+	this->compileStatements(root->getStatements());
+
+	this->emit(OP_HALT);
+}
+
+
+void lp::Compiler::compileStatements(std::list<lp::Statement *> *stmts)
+{
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		this->compileStatement(*it);
+}
+
+
+void lp::Compiler::compileStatement(lp::Statement *stmt)
+{
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		this->compileAssignment(asgn);
+	}
+	else if (lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt))
+	{
+		if (plus->getExp() == NULL)
+			this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+		else
+		{
+			this->compileRoot(plus->getExp(), 0);
+			this->emit(OP_PLUS_ASSIGN, plus->getSlot(), this->_chunk->addStatement(stmt));
+			this->pop();
+		}
+	}
+	else if (lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt))
+	{
+		if (minus->getExp() == NULL)
+			this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+		else
+		{
+			this->compileRoot(minus->getExp(), 0);
+			this->emit(OP_MINUS_ASSIGN, minus->getSlot(), this->_chunk->addStatement(stmt));
+			this->pop();
+		}
+	}
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+	{
+		this->compileRoot(print->getExp(), 0);
+		this->emit(OP_PRINT, this->_chunk->addStatement(stmt));
+		this->pop();
+	}
+	else if (lp::ReadStmt *read = dynamic_cast<lp::ReadStmt *>(stmt))
+	{
+		this->_chunk->nameSlot(read->getSlot(), read->getId());
+		this->emit(OP_READ, read->getSlot());
+	}
+	else if (lp::ReadStringStmt *read = dynamic_cast<lp::ReadStringStmt *>(stmt))
+	{
+		this->_chunk->nameSlot(read->getSlot(), read->getId());
+		this->emit(OP_READ_STRING, read->getSlot());
+	}
+	else if (dynamic_cast<lp::EmptyStmt *>(stmt))
+	{
+		// Nothing to do
+	}
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		this->compileRoot(ifStmt->getCondition(), BOOL);
+		int otherwise = this->emitJump(OP_JUMP_IF_FALSE);
+		this->pop();
+
+		this->compileStatements(ifStmt->getConsequent());
+
+		if (ifStmt->getAlternative() != NULL)
+		{
+			int end = this->emitJump(OP_JUMP);
+
+			this->patchJump(otherwise);
+			this->compileStatements(ifStmt->getAlternative());
+			this->patchJump(end);
+		}
+		else
+			this->patchJump(otherwise);
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		this->compileRoot(whileStmt->getCondition(), BOOL);
+		int end = this->emitJump(OP_JUMP_IF_FALSE);
+		this->pop();
+
+		this->compileStatements(whileStmt->getStatements());
+		this->emit(OP_JUMP, top);
+
+		this->patchJump(end);
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		this->compileStatements(doWhile->getStatements());
+
+		this->compileRoot(doWhile->getCondition(), BOOL);
+		this->emit(OP_JUMP_IF_TRUE, top);
+		this->pop();
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		this->compileStatements(repeat->getStatements());
+
+		// The body is repeated until the condition is true
+		this->compileRoot(repeat->getCondition(), BOOL);
+		this->emit(OP_JUMP_IF_FALSE, top);
+		this->pop();
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		this->compileFor(forStmt);
+	}
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		this->compileSwitch(switchStmt);
+	}
+	else if (lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(inc->getExp());
+
+		if (var != NULL)
+			this->emit(OP_INCREMENT_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(dec->getExp());
+
+		if (var != NULL)
+			this->emit(OP_DECREMENT_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(fact->getExp());
+
+		if (var != NULL)
+			this->emit(OP_FACTORIAL_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+	{
+		this->compileStatements(block->getStatements());
+	}
+	else if (dynamic_cast<lp::ClearScreenStmt *>(stmt))
+	{
+		this->emit(OP_CLEAR_SCREEN);
+	}
+	else
+	{
+		// place and the statements without bytecode are evaluated by the AST
+		this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+}
+
+
+void lp::Compiler::compileAssignment(lp::AssignmentStmt *stmt)
+{
+	this->_chunk->nameSlot(stmt->getSlot(), stmt->getId());
+
+	// The string of the variable grows in place: s := s || e
+	if (lp::ExpNode *tail = stmt->getAppended())
+	{
+		this->compileRoot(tail, 0);
+		this->emit(OP_APPEND, stmt->getSlot(), this->_chunk->addStatement(stmt));
+		this->pop();
+	}
+	else if (stmt->getExp() != NULL)
+	{
+		this->compileRoot(stmt->getExp(), 0);
+		this->emit(OP_STORE, stmt->getSlot(), this->_chunk->addStatement(stmt));
+		this->pop();
+	}
+	// Multiple assignment: a := b := 2;
+	else
+	{
+		this->compileAssignment(stmt->getAssignment());
+		this->emit(OP_COPY, stmt->getSlot(), stmt->getAssignment()->getSlot());
+	}
+}
+
+
+void lp::Compiler::compileFor(lp::ForStmt *stmt)
+{
+	int index = this->_chunk->addStatement(stmt);
+
+	this->_chunk->nameSlot(stmt->getSlot(), stmt->getId());
+
+	// Types of the bounds and the step, in the order of the AST
+	this->emit(OP_CHECK_NUMBER, this->_chunk->addNode(stmt->getFrom()), index);
+	this->emit(OP_CHECK_NUMBER, this->_chunk->addNode(stmt->getTo()), index);
+	if (stmt->getStep() != NULL)
+		this->emit(OP_CHECK_NUMBER, this->_chunk->addNode(stmt->getStep()), index);
+
+	// Interval
+	this->compileRoot(stmt->getTo(), NUMBER);
+	this->compileRoot(stmt->getFrom(), NUMBER);
+	this->emit(OP_FOR_INTERVAL, index);
+	this->pop(2);
+
+	// Loop variable: it stays on the stack while the loop runs
+	this->compileRoot(stmt->getFrom(), NUMBER);
+	this->emit(OP_FOR_VARIABLE, stmt->getSlot(), index);
+
+	// Step: it stays on the stack over the loop variable
+	if (stmt->getStep() != NULL)
+		this->compileRoot(stmt->getStep(), NUMBER);
+	else
+	{
+		this->emit(OP_PUSH_NUMBER, this->_chunk->addNumber(1.0));
+		this->push();
+	}
+	this->emit(OP_FOR_STEP, index);
+
+	// The upper bound is evaluated again in every iteration
+	int test = this->_chunk->size();
+	this->compileRoot(stmt->getTo(), NUMBER);
+	int end = this->emitJump(OP_FOR_TEST);
+	this->pop();
+
+	this->compileStatements(stmt->getStatements());
+	this->emit(OP_FOR_NEXT, test);
+
+	this->patchJump(end);
+	this->emit(OP_POP);
+	this->emit(OP_POP);
+	this->pop(2);
+}
+
+
+void lp::Compiler::compileSwitch(lp::SwitchStmt *stmt)
+{
+	std::list<int> ends;
+
+	// The strings are compared by the AST, which finds their case in a hash table
+	if (stmt->hasStringLabels())
+	{
+		this->emit(OP_EXECUTE, this->_chunk->addStatement(stmt));
+		return;
+	}
+
+	// The value of the switch stays on the stack until a case matches
+	this->compileRoot(stmt->getExp(), NUMBER);
+
+	std::list<lp::CaseStmt *> *cases = stmt->getCases();
+
+	for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+	{
+		this->compileRoot((*it)->getExp(), NUMBER);
+		int next = this->emitJump(OP_CASE);
+
+		// The case matches: both values have been popped
+		this->pop(2);
+		this->compileStatements((*it)->getStatements());
+		ends.push_back(this->emitJump(OP_JUMP));
+
+		// The case does not match: the value of the switch is still on the stack
+		this->patchJump(next);
+		this->push();
+	}
+
+	this->emit(OP_POP);
+	this->pop();
+
+	if (stmt->getDefault() != NULL)
+		this->compileStatements(stmt->getDefault());
+
+	for (std::list<int>::iterator it = ends.begin(); it != ends.end(); ++it)
+		this->patchJump(*it);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+bool lp::Compiler::isCompilable(lp::ExpNode *node)
+{
+	if (dynamic_cast<lp::VariableNode *>(node) or dynamic_cast<lp::ConstantNode *>(node)
+		or dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::StringNode *>(node)
+		or dynamic_cast<lp::BoolNode *>(node) or dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+		return true;
+
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		return this->isCompilable(unary->getExp());
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+		return this->isCompilable(binary->getLeft()) and this->isCompilable(binary->getRight());
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return this->isCompilable(f->getExp());
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return this->isCompilable(f->getExp1()) and this->isCompilable(f->getExp2());
+
+	// random and the unknown nodes are evaluated by the AST
+	return false;
+}
+
+
+void lp::Compiler::compileRoot(lp::ExpNode *node, int type)
+{
+	if (not this->isCompilable(node))
+	{
+		switch (type)
+		{
+			case NUMBER: this->emit(OP_EVAL_NUMBER, this->_chunk->addNode(node)); break;
+			case BOOL:   this->emit(OP_EVAL_BOOL, this->_chunk->addNode(node)); break;
+			case STRING: this->emit(OP_EVAL_STRING, this->_chunk->addNode(node)); break;
+			default:     this->emit(OP_EVAL, this->_chunk->addNode(node)); break;
+		}
+		this->push();
+		return;
+	}
+
+	this->_root = this->_chunk->addRoot(node, type, this->_depth);
+
+	this->compileExpression(node, type, true);
+
+	this->_chunk->setResume(this->_root, this->_chunk->size());
+	this->_root = -1;
+}
+
+
+void lp::Compiler::compileExpression(lp::ExpNode *node, int type, bool root)
+{
+	// The statement asks for the type of the expression
+	if (type == 0)
+	{
+		if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+		{
+			this->emit(OP_LOAD, var->getSlot());
+			this->push();
+			return;
+		}
+
+		if (dynamic_cast<lp::ConstantNode *>(node))
+			type = node->getType();
+		else if (dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::NumericUnaryOperatorNode *>(node)
+				or dynamic_cast<lp::NumericOperatorNode *>(node) or dynamic_cast<lp::BuiltinFunctionNode *>(node))
+			type = NUMBER;
+		else if (dynamic_cast<lp::BoolNode *>(node) or dynamic_cast<lp::LogicalUnaryOperatorNode *>(node)
+				or dynamic_cast<lp::RelationalOperatorNode *>(node) or dynamic_cast<lp::LogicalOperatorNode *>(node))
+			type = BOOL;
+		else
+			type = STRING;
+	}
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		int opcode = (type == NUMBER) ? OP_LOAD_NUMBER : (type == BOOL) ? OP_LOAD_BOOL : OP_LOAD_STRING;
+
+		this->emit(opcode, var->getSlot(), this->_root);
+		this->push();
+	}
+	else if (lp::ConstantNode *constant = dynamic_cast<lp::ConstantNode *>(node))
+	{
+		// The values of the constants can never change
+		if ((type == NUMBER) and (constant->getType() == NUMBER))
+		{
+			lp::NumericConstant *n = (lp::NumericConstant *) table.getSymbol(constant->getSlot());
+
+			this->emit(OP_PUSH_NUMBER, this->_chunk->addNumber(n->getValue()));
+			this->push();
+		}
+		else if ((type == BOOL) and (constant->getType() == BOOL))
+		{
+			lp::LogicalConstant *b = (lp::LogicalConstant *) table.getSymbol(constant->getSlot());
+
+			this->emit(b->getValue() ? OP_PUSH_TRUE : OP_PUSH_FALSE);
+			this->push();
+		}
+		else if (type == STRING)
+			this->compileDefault(type, root);
+		else
+		{
+			// The AST reports the error
+			this->emit(OP_FALLBACK, this->_root);
+			this->push();
+		}
+	}
+	else if (lp::NumberNode *number = dynamic_cast<lp::NumberNode *>(node))
+	{
+		if (type == NUMBER)
+		{
+			this->emit(OP_PUSH_NUMBER, this->_chunk->addNumber(number->getNumber()));
+			this->push();
+		}
+		else
+			this->compileDefault(type, root);
+	}
+	else if (lp::StringNode *string = dynamic_cast<lp::StringNode *>(node))
+	{
+		if (type == STRING)
+		{
+			this->emit(OP_PUSH_STRING, this->_chunk->addString(string->getString()));
+			this->push();
+		}
+		else
+			this->compileDefault(type, root);
+	}
+	else if (lp::BoolNode *logic = dynamic_cast<lp::BoolNode *>(node))
+	{
+		if (type == BOOL)
+		{
+			this->emit(logic->getBool() ? OP_PUSH_TRUE : OP_PUSH_FALSE);
+			this->push();
+		}
+		else
+			this->compileDefault(type, root);
+	}
+	else if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+	{
+		if (type != NUMBER)
+			this->compileDefault(type, root);
+		else if (dynamic_cast<lp::UnaryMinusNode *>(node))
+			this->compileUnary(unary, NUMBER, OP_NEGATE);
+		else if (dynamic_cast<lp::UnaryPlusNode *>(node))
+			this->compileUnary(unary, NUMBER, -1);
+		else if (dynamic_cast<lp::UnaryIncrementNode *>(node))
+			this->compileUnary(unary, NUMBER, OP_INCREMENT);
+		else if (dynamic_cast<lp::UnaryDecrementNode *>(node))
+			this->compileUnary(unary, NUMBER, OP_DECREMENT);
+		else if (dynamic_cast<lp::UnaryFactorialNode *>(node))
+			this->compileUnary(unary, NUMBER, OP_FACTORIAL);
+		else
+			this->compileDefault(type, false);
+	}
+	else if (lp::LogicalUnaryOperatorNode *unary = dynamic_cast<lp::LogicalUnaryOperatorNode *>(node))
+	{
+		if ((type == BOOL) and dynamic_cast<lp::NotNode *>(node))
+			this->compileUnary(unary, BOOL, OP_NOT);
+		else
+			this->compileDefault(type, root);
+	}
+	else if (lp::NumericOperatorNode *binary = dynamic_cast<lp::NumericOperatorNode *>(node))
+	{
+		if (type != NUMBER)
+			this->compileDefault(type, root);
+		else if (dynamic_cast<lp::PlusNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_ADD);
+		else if (dynamic_cast<lp::MinusNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_SUBTRACT);
+		else if (dynamic_cast<lp::MultiplicationNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_MULTIPLY);
+		else if (dynamic_cast<lp::DivisionNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_DIVIDE);
+		else if (dynamic_cast<lp::IntegerDivisionNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_INTEGER_DIVIDE);
+		else if (dynamic_cast<lp::ModuloNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_MODULO);
+		else if (dynamic_cast<lp::PowerNode *>(node))
+			this->compileBinary(binary, NUMBER, OP_POWER);
+		else
+			this->compileDefault(type, false);
+	}
+	else if (lp::StringOperatorNode *binary = dynamic_cast<lp::StringOperatorNode *>(node))
+	{
+		if ((type == STRING) and dynamic_cast<lp::ConcatenationNode *>(node))
+			this->compileBinary(binary, STRING, OP_CONCATENATE);
+		else
+			this->compileDefault(type, root);
+	}
+	else if (lp::LogicalOperatorNode *binary = dynamic_cast<lp::LogicalOperatorNode *>(node))
+	{
+		if (type != BOOL)
+			this->compileDefault(type, root);
+		else if (dynamic_cast<lp::AndNode *>(node))
+			this->compileBinary(binary, BOOL, OP_AND);
+		else if (dynamic_cast<lp::OrNode *>(node))
+			this->compileBinary(binary, BOOL, OP_OR);
+		else
+			this->compileDefault(type, false);
+	}
+	else if (lp::RelationalOperatorNode *binary = dynamic_cast<lp::RelationalOperatorNode *>(node))
+	{
+		// The operands keep their own types
+		if (type != BOOL)
+			this->compileDefault(type, root);
+		else if (dynamic_cast<lp::GreaterThanNode *>(node))
+			this->compileBinary(binary, 0, OP_GREATER);
+		else if (dynamic_cast<lp::GreaterOrEqualNode *>(node))
+			this->compileBinary(binary, 0, OP_GREATER_EQUAL);
+		else if (dynamic_cast<lp::LessThanNode *>(node))
+			this->compileBinary(binary, 0, OP_LESS);
+		else if (dynamic_cast<lp::LessOrEqualNode *>(node))
+			this->compileBinary(binary, 0, OP_LESS_EQUAL);
+		else if (dynamic_cast<lp::EqualNode *>(node))
+			this->compileBinary(binary, 0, OP_EQUAL);
+		else if (dynamic_cast<lp::NotEqualNode *>(node))
+			this->compileBinary(binary, 0, OP_NOT_EQUAL);
+		else
+			this->compileDefault(type, false);
+	}
+	else if (lp::BuiltinFunctionNode_0 *f = dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+	{
+		if (type != NUMBER)
+			this->compileDefault(type, root);
+		else
+		{
+			lp::BuiltinParameter0 *b = (lp::BuiltinParameter0 *) table.getSymbol(f->getSlot());
+
+			this->emit(OP_CALL_0, this->_chunk->addFunction(b->getFunction()));
+			this->push();
+		}
+	}
+	else if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+	{
+		if (type != NUMBER)
+			this->compileDefault(type, root);
+		else
+		{
+			lp::BuiltinParameter1 *b = (lp::BuiltinParameter1 *) table.getSymbol(f->getSlot());
+
+			this->compileExpression(f->getExp(), NUMBER, false);
+			this->emit(OP_CALL_1, this->_chunk->addFunction(b->getFunction()));
+		}
+	}
+	else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		if (type != NUMBER)
+			this->compileDefault(type, root);
+		else
+		{
+			lp::BuiltinParameter2 *b = (lp::BuiltinParameter2 *) table.getSymbol(f->getSlot());
+
+			this->compileExpression(f->getExp1(), NUMBER, false);
+			this->compileExpression(f->getExp2(), NUMBER, false);
+			this->emit(OP_CALL_2, this->_chunk->addFunction(b->getFunction()));
+			this->pop();
+		}
+	}
+	else
+		this->compileDefault(type, false);
+}
+
+
+void lp::Compiler::compileDefault(int type, bool root)
+{
+	// The AST does not evaluate an expression in a context that its class ignores
+	if (root and (type == NUMBER))
+		this->emit(OP_PUSH_NUMBER, this->_chunk->addNumber(0.0));
+	else if (root and (type == BOOL))
+		this->emit(OP_PUSH_FALSE);
+	else if (root and (type == STRING))
+		this->emit(OP_PUSH_STRING, this->_chunk->addString(""));
+	// Inside an expression, the type is wrong and the AST reports the error
+	else
+		this->emit(OP_FALLBACK, this->_root);
+
+	this->push();
+}
+
+
+void lp::Compiler::compileUnary(lp::UnaryOperatorNode *node, int childType, int opcode)
+{
+	this->compileExpression(node->getExp(), childType, false);
+
+	if (opcode == -1)
+		return;
+
+	if (hasRoot(opcode))
+		this->emit(opcode, this->_root);
+	else
+		this->emit(opcode);
+}
+
+
+void lp::Compiler::compileBinary(lp::OperatorNode *node, int childType, int opcode)
+{
+	this->compileExpression(node->getLeft(), childType, false);
+	this->compileExpression(node->getRight(), childType, false);
+
+	if (hasRoot(opcode))
+		this->emit(opcode, this->_root);
+	else
+		this->emit(opcode);
+
+	this->pop();
+}
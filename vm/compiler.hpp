@@ -0,0 +1,94 @@
+/*!
+	\file    compiler.hpp
+	\brief   Declaration of the compiler from the AST to the bytecode
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _COMPILER_HPP_
+#define _COMPILER_HPP_
+
+#include <list>
+
+#include "../ast/ast.hpp"
+
+#include "bytecode.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class Compiler
+  \brief Translation of the AST into the bytecode of a Chunk
+  \note  The statements and expressions that have no bytecode are kept
+         as escapes to the AST, so every program can be compiled.
+*/
+class Compiler
+{
+	private:
+		lp::Chunk *_chunk;   //!< Chunk that receives the bytecode
+		int _depth;          //!< Depth of the stack at the current instruction
+		int _root;           //!< Root of the expression being compiled
+
+	public:
+
+	/*!
+		\brief Constructor of Compiler
+		\param chunk: empty Chunk that receives the bytecode
+	*/
+		Compiler(lp::Chunk *chunk): _chunk(chunk), _depth(0), _root(-1)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compile the whole program
+		\param   root: AST of the program, already analyzed
+		\return  void
+		\post    The last instruction of the Chunk is OP_HALT
+	*/
+		void compile(lp::AST *root);
+
+	private:
+
+	/*!
+		\name Auxiliary functions
+	*/
+		void emit(int opcode);
+		void emit(int opcode, int operand);
+		void emit(int opcode, int operand1, int operand2);
+		int emitJump(int opcode);
+		void patchJump(int address);
+		void push();
+		void pop(int n = 1);
+
+	/*!
+		\name Statements
+	*/
+		void compileStatements(std::list<lp::Statement *> *stmts);
+		void compileStatement(lp::Statement *stmt);
+		void compileAssignment(lp::AssignmentStmt *stmt);
+		void compileFor(lp::ForStmt *stmt);
+		void compileSwitch(lp::SwitchStmt *stmt);
+
+	/*!
+		\name Expressions
+	*/
+		bool isCompilable(lp::ExpNode *node);
+		void compileRoot(lp::ExpNode *node, int type);
+		void compileExpression(lp::ExpNode *node, int type, bool root);
+		void compileDefault(int type, bool root);
+		void compileUnary(lp::UnaryOperatorNode *node, int childType, int opcode);
+		void compileBinary(lp::OperatorNode *node, int childType, int opcode);
+};
+
+// End of name space lp
+}
+
+// End of _COMPILER_HPP_
+#endif
@@ -0,0 +1,39 @@
+/*!
+	\file    dispatch.hpp
+	\brief   Dispatch of the instructions of the virtual machines
+	\author
+	\date    2025-06-06
+	\version 1.0
+	\note    With GCC the loop of a machine jumps from an instruction straight
+	         to the next one through a table of label addresses (computed goto).
+	         Define SWITCH_DISPATCH to use a portable switch instead:
+	         make DISPATCH=switch
+*/
+
+#ifndef _DISPATCH_HPP_
+#define _DISPATCH_HPP_
+
+#if defined(__GNUC__) && !defined(SWITCH_DISPATCH)
+	#define COMPUTED_GOTO
+#endif
+
+/*!
+  \def   DISPATCH
+  \brief Jump to the instruction at code[pc]; "labels" is the table of the machine
+  \def   INSTRUCTION(op)
+  \brief Beginning of the code of an instruction
+  \def   NEXT
+  \brief End of the code of an instruction: go on with the instruction at code[pc]
+*/
+#ifdef COMPUTED_GOTO
+	#define DISPATCH         goto *labels[code[pc]];
+	#define INSTRUCTION(op)  L_##op
+	#define NEXT             goto *labels[code[pc]]
+#else
+	#define DISPATCH         switch (code[pc])
+	#define INSTRUCTION(op)  case op
+	#define NEXT             break
+#endif
+
+// End of _DISPATCH_HPP_
+#endif
@@ -0,0 +1,843 @@
+/*!
+	\file    jit.cpp
+	\brief   Code of the functions of the Jit class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstring>
+#include <cstdarg>
+
+#include "jit.hpp"
+
+#ifdef JIT_X86_64
+	#include <sys/mman.h>
+#endif
+
+#include "../table/table.hpp"
+#include "../table/variable.hpp"
+
+#include "../includes/macros.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+#ifdef JIT_X86_64
+
+/*!
+  \brief Machine code of the loops
+*/
+typedef std::vector<unsigned char> Code;
+
+/*!
+  \brief Jump whose displacement is known when the whole loop is translated
+*/
+struct Patch
+{
+	int position;   //!< Offset of the 32 bit displacement in the machine code
+	int target;     //!< Address of the instruction of the register machine
+	bool exit;      //!< true: return target to the register machine, false: jump to its machine code
+};
+
+/*!
+  \brief Condition codes of the jumps: the second byte of "0F 8x rel32"
+*/
+enum Condition
+{
+	ALWAYS = 0,         //!< jmp
+	BELOW = 0x82,       //!< jb: CF
+	ABOVE_EQUAL = 0x83, //!< jae: not CF
+	ZERO = 0x84,        //!< jz
+	NOT_ZERO = 0x85,    //!< jnz
+	BELOW_EQUAL = 0x86, //!< jbe: CF or ZF, also when a comparison is unordered
+	ABOVE = 0x87        //!< ja: not CF and not ZF
+};
+
+static const unsigned long SIGN_MASK = 0x8000000000000000UL;   //!< Sign bit of a double
+static const unsigned long ABSOLUTE_MASK = 0x7FFFFFFFFFFFFFFFUL; //!< Bits of a double without the sign
+
+
+static void emit(Code &code, int count, ...)
+{
+	va_list bytes;
+
+	va_start(bytes, count);
+	for (int i = 0; i < count; i++)
+		code.push_back((unsigned char) va_arg(bytes, int));
+	va_end(bytes);
+}
+
+
+static void emit32(Code &code, int value)
+{
+	for (int i = 0; i < 4; i++)
+		code.push_back((unsigned char) (((unsigned int) value) >> (8 * i)));
+}
+
+
+static void emit64(Code &code, unsigned long value)
+{
+	for (int i = 0; i < 8; i++)
+		code.push_back((unsigned char) (value >> (8 * i)));
+}
+
+
+static void patch32(Code &code, int position, int value)
+{
+	for (int i = 0; i < 4; i++)
+		code[position + i] = (unsigned char) (((unsigned int) value) >> (8 * i));
+}
+
+
+static unsigned long bitsOf(double value)
+{
+	union
+	{
+		double number;
+		unsigned long bits;
+	} both;
+
+	both.number = value;
+	return both.bits;
+}
+
+
+/*!
+  \brief movsd xmm, operand: a register (rbx) or a variable of references (r13)
+*/
+static void loadNumber(Code &code, int xmm, int operand, int reference)
+{
+	if (operand >= 0)
+	{
+		emit(code, 4, 0xF2, 0x0F, 0x10, 0x83 | (xmm << 3));
+		emit32(code, 8 * operand);
+	}
+	else
+	{
+		// mov rax, [r13 + 8 * reference]
+		emit(code, 3, 0x49, 0x8B, 0x85);
+		emit32(code, 8 * reference);
+		emit(code, 4, 0xF2, 0x0F, 0x10, xmm << 3);
+	}
+}
+
+
+/*!
+  \brief movsd operand, xmm0
+*/
+static void storeNumber(Code &code, int operand, int reference)
+{
+	if (operand >= 0)
+	{
+		emit(code, 4, 0xF2, 0x0F, 0x11, 0x83);
+		emit32(code, 8 * operand);
+	}
+	else
+	{
+		emit(code, 3, 0x49, 0x8B, 0x85);
+		emit32(code, 8 * reference);
+		emit(code, 4, 0xF2, 0x0F, 0x11, 0x00);
+	}
+}
+
+
+/*!
+  \brief movzx eax or ecx (reg 0 or 1), byte [r12 + operand]
+*/
+static void loadBool(Code &code, int reg, int operand)
+{
+	emit(code, 5, 0x41, 0x0F, 0xB6, 0x84 | (reg << 3), 0x24);
+	emit32(code, operand);
+}
+
+
+/*!
+  \brief mov byte [r12 + operand], al
+*/
+static void storeBool(Code &code, int operand)
+{
+	emit(code, 4, 0x41, 0x88, 0x84, 0x24);
+	emit32(code, operand);
+}
+
+
+/*!
+  \brief mov rax, bits; movq xmm, rax
+*/
+static void loadBits(Code &code, int xmm, unsigned long bits)
+{
+	emit(code, 2, 0x48, 0xB8);
+	emit64(code, bits);
+	emit(code, 4, 0x66, 0x48, 0x0F, 0x6E);
+	code.push_back(0xC0 | (xmm << 3));
+}
+
+
+/*!
+  \brief xmm0 = |xmm0|, with xmm2 as scratch
+*/
+static void absolute(Code &code)
+{
+	loadBits(code, 2, ABSOLUTE_MASK);
+	emit(code, 4, 0x66, 0x0F, 0x54, 0xC2);
+}
+
+
+/*!
+  \brief mov rax, function; call rax
+*/
+static void call(Code &code, unsigned long function)
+{
+	emit(code, 2, 0x48, 0xB8);
+	emit64(code, function);
+	emit(code, 2, 0xFF, 0xD0);
+}
+
+
+/*!
+  \brief Jump to an instruction, or return it to the register machine when exit is true
+*/
+static void branch(Code &code, std::vector<Patch> &patches, int condition, int target, bool exit)
+{
+	if (condition == ALWAYS)
+		code.push_back(0xE9);
+	else
+		emit(code, 2, 0x0F, condition);
+
+	Patch patch = {(int) code.size(), target, exit};
+	patches.push_back(patch);
+
+	emit32(code, 0);
+}
+
+
+/*!
+  \brief Return pc to the register machine when |xmm1| <= ERROR_BOUND, as the division does
+*/
+static void checkDivisor(Code &code, std::vector<Patch> &patches, int pc)
+{
+	// movapd xmm2, xmm1; andpd xmm2, mask
+	emit(code, 4, 0x66, 0x0F, 0x28, 0xD1);
+	loadBits(code, 3, ABSOLUTE_MASK);
+	emit(code, 4, 0x66, 0x0F, 0x54, 0xD3);
+
+	// ucomisd xmm2, ERROR_BOUND
+	loadBits(code, 3, bitsOf(ERROR_BOUND));
+	emit(code, 4, 0x66, 0x0F, 0x2E, 0xD3);
+	branch(code, patches, BELOW_EQUAL, pc, true);
+}
+
+
+/*!
+  \brief eax = (int) xmm0, ecx = (int) xmm1 and cdq; return pc when ecx is 0 or -1, that idiv cannot divide by
+*/
+static void integers(Code &code, std::vector<Patch> &patches, int pc)
+{
+	emit(code, 4, 0xF2, 0x0F, 0x2C, 0xC0);
+	emit(code, 4, 0xF2, 0x0F, 0x2C, 0xC9);
+
+	// test ecx, ecx
+	emit(code, 2, 0x85, 0xC9);
+	branch(code, patches, ZERO, pc, true);
+
+	// cmp ecx, -1
+	emit(code, 3, 0x83, 0xF9, 0xFF);
+	branch(code, patches, ZERO, pc, true);
+
+	// cdq; idiv ecx
+	emit(code, 3, 0x99, 0xF7, 0xF9);
+}
+
+
+/*!
+  \brief Type of an expression for R_CHECK_NUMBER, called from the machine code
+*/
+static int isNumber(lp::ExpNode *node)
+{
+	return node->getType() == NUMBER;
+}
+
+
+/*!
+  \brief s := s || e for R_APPEND, called from the machine code
+  \param strings: string registers of the register machine
+  \param slot: slot of s
+  \param operand: e, a string register or the variable of the slot -(operand + 1)
+  \return 0 when s or e is not a string, which the register machine reports
+*/
+static int appendString(std::string **strings, int slot, int operand)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	if (var->getType() != STRING)
+		return 0;
+
+	if (operand >= 0)
+		var->append((*strings)[operand]);
+	else
+	{
+		lp::Variable *tail = (lp::Variable *) table.getSymbol(- operand - 1);
+
+		if (tail->getType() != STRING)
+			return 0;
+
+		var->append(tail->getString());
+	}
+
+	return 1;
+}
+
+
+/*!
+  \brief Index of the reference of the variable of a number operand
+*/
+#define REFERENCE(operand) (((operand) < 0) ? this->reference(native, - (operand) - 1, -1) : -1)
+
+#endif
+
+
+lp::Jit::Jit(const lp::RegisterChunk *chunk): _chunk(chunk), _strings(NULL), _memory(NULL), _size(0), _rejected(0)
+{
+	const std::vector<int> & program = chunk->getCode();
+
+	this->_natives.assign(program.size(), -1);
+
+#ifdef JIT_X86_64
+	Code code;
+
+	// Every jump back to a previous instruction closes a loop
+	for (int pc = 0; pc < (int) program.size(); pc += lp::RegisterChunk::length(program[pc]))
+	{
+		int target = -1;
+
+		switch (program[pc])
+		{
+			case R_JUMP:          target = program[pc + 1]; break;
+			case R_JUMP_IF_FALSE:
+			case R_JUMP_IF_TRUE:  target = program[pc + 2]; break;
+			case R_FOR_NEXT:      target = program[pc + 3]; break;
+		}
+
+		if ((target < 0) or (target > pc))
+			continue;
+
+		Native native;
+		native.offset = code.size();
+		native.code = NULL;
+
+		if (this->translate(target, pc + lp::RegisterChunk::length(program[pc]), native, code))
+		{
+			this->_natives[pc] = this->_loops.size();
+			this->_loops.push_back(native);
+		}
+		else
+		{
+			code.resize(native.offset);
+			this->_rejected++;
+		}
+	}
+
+	if (code.empty())
+		return;
+
+	// The memory is writable while the code is copied, then only executable
+	void *memory = mmap(NULL, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (memory != MAP_FAILED)
+	{
+		memcpy(memory, &code[0], code.size());
+
+		if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) != 0)
+		{
+			munmap(memory, code.size());
+			memory = MAP_FAILED;
+		}
+	}
+
+	if (memory == MAP_FAILED)
+	{
+		// The register machine runs every loop
+		this->_natives.assign(program.size(), -1);
+		this->_rejected += this->_loops.size();
+		this->_loops.clear();
+		return;
+	}
+
+	this->_memory = (unsigned char *) memory;
+	this->_size = code.size();
+
+	size_t references = 1;
+
+	for (unsigned int i = 0; i < this->_loops.size(); i++)
+	{
+		this->_loops[i].code = reinterpret_cast<NativeLoop>(this->_memory + this->_loops[i].offset);
+
+		if (this->_loops[i].references.size() > references)
+			references = this->_loops[i].references.size();
+	}
+
+	this->_references.resize(references);
+	this->_variables.resize(references);
+#endif
+}
+
+
+lp::Jit::~Jit()
+{
+#ifdef JIT_X86_64
+	if (this->_memory != NULL)
+		munmap(this->_memory, this->_size);
+#endif
+}
+
+
+int lp::Jit::run(int index, int to, double *numbers, char *bools, std::string *strings, lp::Variable **loops)
+{
+	Native & native = this->_loops[index];
+
+	// R_APPEND finds the string registers here
+	this->_strings = strings;
+
+	// The machine code only handles numeric variables
+	for (unsigned int k = 0; k < native.references.size(); k++)
+	{
+		lp::Variable *var;
+
+		if (native.references[k].slot >= 0)
+		{
+			var = (lp::Variable *) table.getSymbol(native.references[k].slot);
+
+			if ((var == NULL) or (var->getType() != NUMBER))
+				return to;
+		}
+		else
+		{
+			var = loops[native.references[k].loop];
+
+			if (var == NULL)
+				return to;
+		}
+
+		this->_variables[k] = var;
+		this->_references[k] = var->getAddress();
+	}
+
+	lp::NativeFrame frame = {numbers, bools, &this->_references[0], &this->_variables[0], loops};
+
+	return native.code(&frame);
+}
+
+
+int lp::Jit::reference(Native &native, int slot, int loop)
+{
+	for (unsigned int k = 0; k < native.references.size(); k++)
+	{
+		if ((native.references[k].slot == slot) and ((slot >= 0) or (native.references[k].loop == loop)))
+			return k;
+	}
+
+	Reference reference = {slot, loop};
+	native.references.push_back(reference);
+
+	return native.references.size() - 1;
+}
+
+
+bool lp::Jit::translate(int head, int end, Native &native, std::vector<unsigned char> &code)
+{
+#ifdef JIT_X86_64
+	const std::vector<int> & program = this->_chunk->getCode();
+	std::vector<int> labels(end - head, -1);
+	std::vector<Patch> patches;
+	std::map<int, int> loopSlots;   // Slot of the variable of the for statements that begin in the loop
+
+	// Prologue: push rbx, r12, r13, r14, r15 keeps the stack aligned for the calls
+	emit(code, 9, 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57);
+
+	// rbx = numbers, r12 = bools, r13 = references, r14 = variables, r15 = loops
+	emit(code, 3, 0x48, 0x8B, 0x1F);
+	emit(code, 4, 0x4C, 0x8B, 0x67, 0x08);
+	emit(code, 4, 0x4C, 0x8B, 0x6F, 0x10);
+	emit(code, 4, 0x4C, 0x8B, 0x77, 0x18);
+	emit(code, 4, 0x4C, 0x8B, 0x7F, 0x20);
+
+	for (int pc = head; pc < end; pc += lp::RegisterChunk::length(program[pc]))
+	{
+		const int *op = &program[pc];
+
+		labels[pc - head] = code.size();
+
+		switch (op[0])
+		{
+			////////////////////////////////////////////
+			// Moves
+
+			case R_MOVE_NUMBER:
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_MOVE_BOOL:
+				// The logical variables are left to the register machine
+				if ((op[1] < 0) or (op[2] < 0))
+					return false;
+
+				loadBool(code, 0, op[2]);
+				storeBool(code, op[1]);
+				break;
+
+			////////////////////////////////////////////
+			// Numeric operators
+
+			case R_NEGATE:
+			case R_INCREMENT:
+			case R_DECREMENT:
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+
+				if (op[0] == R_NEGATE)
+				{
+					// xorpd xmm0, sign
+					loadBits(code, 1, SIGN_MASK);
+					emit(code, 4, 0x66, 0x0F, 0x57, 0xC1);
+				}
+				else
+				{
+					// addsd or subsd xmm0, 1.0
+					loadBits(code, 1, bitsOf(1.0));
+					emit(code, 4, 0xF2, 0x0F, (op[0] == R_INCREMENT) ? 0x58 : 0x5C, 0xC1);
+				}
+
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_ADD:
+			case R_SUBTRACT:
+			case R_MULTIPLY:
+			case R_DIVIDE:
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+				loadNumber(code, 1, op[3], REFERENCE(op[3]));
+
+				if (op[0] == R_ADD)
+					emit(code, 4, 0xF2, 0x0F, 0x58, 0xC1);
+				else if (op[0] == R_SUBTRACT)
+					emit(code, 4, 0xF2, 0x0F, 0x5C, 0xC1);
+				else if (op[0] == R_MULTIPLY)
+					emit(code, 4, 0xF2, 0x0F, 0x59, 0xC1);
+				else
+				{
+					checkDivisor(code, patches, pc);
+					emit(code, 4, 0xF2, 0x0F, 0x5E, 0xC1);
+				}
+
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_INTEGER_DIVIDE:
+			case R_MODULO:
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+				loadNumber(code, 1, op[3], REFERENCE(op[3]));
+				checkDivisor(code, patches, pc);
+				integers(code, patches, pc);
+
+				// cvtsi2sd xmm0, eax (quotient) or edx (remainder)
+				emit(code, 4, 0xF2, 0x0F, 0x2A, (op[0] == R_INTEGER_DIVIDE) ? 0xC0 : 0xC2);
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_POWER:
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+				loadNumber(code, 1, op[3], REFERENCE(op[3]));
+				call(code, reinterpret_cast<unsigned long>(static_cast<double (*)(double, double)>(&pow)));
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_CALL_0:
+				call(code, reinterpret_cast<unsigned long>(this->_chunk->getFunctions0()[op[2]]));
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_CALL_1:
+				loadNumber(code, 0, op[3], REFERENCE(op[3]));
+				call(code, reinterpret_cast<unsigned long>(this->_chunk->getFunctions1()[op[2]]));
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			case R_CALL_2:
+				loadNumber(code, 0, op[3], REFERENCE(op[3]));
+				loadNumber(code, 1, op[4], REFERENCE(op[4]));
+				call(code, reinterpret_cast<unsigned long>(this->_chunk->getFunctions2()[op[2]]));
+				storeNumber(code, op[1], REFERENCE(op[1]));
+				break;
+
+			////////////////////////////////////////////
+			// Relational and logical operators
+
+			case R_GREATER:
+			case R_GREATER_EQUAL:
+			case R_LESS:
+			case R_LESS_EQUAL:
+			case R_EQUAL:
+			case R_NOT_EQUAL:
+				if (op[1] < 0)
+					return false;
+
+				loadNumber(code, 0, op[2], REFERENCE(op[2]));
+				loadNumber(code, 1, op[3], REFERENCE(op[3]));
+
+				// ucomisd and seta or setae: an unordered comparison is false, as in C++
+				switch (op[0])
+				{
+					case R_GREATER:
+						emit(code, 7, 0x66, 0x0F, 0x2E, 0xC1, 0x0F, 0x97, 0xC0);
+						break;
+					case R_GREATER_EQUAL:
+						emit(code, 7, 0x66, 0x0F, 0x2E, 0xC1, 0x0F, 0x93, 0xC0);
+						break;
+					case R_LESS:
+						emit(code, 7, 0x66, 0x0F, 0x2E, 0xC8, 0x0F, 0x97, 0xC0);
+						break;
+					case R_LESS_EQUAL:
+						emit(code, 7, 0x66, 0x0F, 0x2E, 0xC8, 0x0F, 0x93, 0xC0);
+						break;
+					default:
+						// ERROR_BOUND to control the precision of real numbers: |a - b| against it
+						emit(code, 4, 0xF2, 0x0F, 0x5C, 0xC1);
+						absolute(code);
+						loadBits(code, 2, bitsOf(ERROR_BOUND));
+
+						if (op[0] == R_EQUAL)
+							emit(code, 7, 0x66, 0x0F, 0x2E, 0xD0, 0x0F, 0x97, 0xC0);
+						else
+							emit(code, 7, 0x66, 0x0F, 0x2E, 0xC2, 0x0F, 0x93, 0xC0);
+						break;
+				}
+
+				storeBool(code, op[1]);
+				break;
+
+			case R_AND:
+			case R_OR:
+				if ((op[1] < 0) or (op[2] < 0) or (op[3] < 0))
+					return false;
+
+				loadBool(code, 0, op[2]);
+				loadBool(code, 1, op[3]);
+				emit(code, 2, (op[0] == R_AND) ? 0x21 : 0x09, 0xC8);
+				storeBool(code, op[1]);
+				break;
+
+			case R_NOT:
+				if ((op[1] < 0) or (op[2] < 0))
+					return false;
+
+				loadBool(code, 0, op[2]);
+				emit(code, 3, 0x83, 0xF0, 0x01);
+				storeBool(code, op[1]);
+				break;
+
+			////////////////////////////////////////////
+			// Statements on numeric variables
+
+			case R_ASSIGN_VARIABLE:
+			case R_COPY:
+			{
+				// Both variables are numeric while the machine code runs
+				int destination = - op[1] - 1;
+				int source = - op[2] - 1;
+
+				loadNumber(code, 0, source, REFERENCE(source));
+				storeNumber(code, destination, REFERENCE(destination));
+			}
+			break;
+
+			case R_PLUS_ASSIGN:
+			case R_MINUS_ASSIGN:
+			{
+				int variable = - op[1] - 1;
+
+				loadNumber(code, 0, variable, REFERENCE(variable));
+				loadNumber(code, 1, op[2], REFERENCE(op[2]));
+				emit(code, 4, 0xF2, 0x0F, (op[0] == R_PLUS_ASSIGN) ? 0x58 : 0x5C, 0xC1);
+				storeNumber(code, variable, REFERENCE(variable));
+			}
+			break;
+
+			case R_INCREMENT_VARIABLE:
+			case R_DECREMENT_VARIABLE:
+			{
+				int variable = - op[1] - 1;
+
+				loadNumber(code, 0, variable, REFERENCE(variable));
+				loadBits(code, 1, bitsOf(1.0));
+				emit(code, 4, 0xF2, 0x0F, (op[0] == R_INCREMENT_VARIABLE) ? 0x58 : 0x5C, 0xC1);
+				storeNumber(code, variable, REFERENCE(variable));
+			}
+			break;
+
+			////////////////////////////////////////////
+			// Appends to string variables, called from the machine code
+
+			case R_APPEND:
+				// mov rdi, &strings; mov esi, slot; mov edx, operand
+				emit(code, 2, 0x48, 0xBF);
+				emit64(code, (unsigned long) &this->_strings);
+				code.push_back(0xBE);
+				emit32(code, op[1]);
+				code.push_back(0xBA);
+				emit32(code, op[2]);
+				call(code, reinterpret_cast<unsigned long>(&appendString));
+				emit(code, 2, 0x85, 0xC0);
+				branch(code, patches, ZERO, pc, true);
+				break;
+
+			////////////////////////////////////////////
+			// Control flow
+
+			case R_JUMP:
+				branch(code, patches, ALWAYS, op[1], false);
+				break;
+
+			case R_JUMP_IF_FALSE:
+			case R_JUMP_IF_TRUE:
+				if (op[1] < 0)
+					return false;
+
+				loadBool(code, 0, op[1]);
+				emit(code, 2, 0x85, 0xC0);
+				branch(code, patches, (op[0] == R_JUMP_IF_FALSE) ? ZERO : NOT_ZERO, op[2], false);
+				break;
+
+			case R_CHECK_NUMBER:
+				// mov rdi, node
+				emit(code, 2, 0x48, 0xBF);
+				emit64(code, (unsigned long) this->_chunk->getNodes()[op[1]]);
+				call(code, reinterpret_cast<unsigned long>(&isNumber));
+				emit(code, 2, 0x85, 0xC0);
+				branch(code, patches, ZERO, pc, true);
+				break;
+
+			case R_FOR_INTERVAL:
+				// The register machine reports to < from
+				loadNumber(code, 0, op[1], REFERENCE(op[1]));
+				loadNumber(code, 1, op[2], REFERENCE(op[2]));
+				emit(code, 4, 0x66, 0x0F, 0x2E, 0xC8);
+				branch(code, patches, ABOVE, pc, true);
+				break;
+
+			case R_FOR_VARIABLE:
+			{
+				int variable = - op[2] - 1;
+				int k = REFERENCE(variable);
+
+				loopSlots[op[1]] = op[2];
+
+				loadNumber(code, 0, op[3], REFERENCE(op[3]));
+				storeNumber(code, variable, k);
+
+				// mov rax, [r14 + 8 * k]; mov [r15 + 8 * loop], rax
+				emit(code, 3, 0x49, 0x8B, 0x86);
+				emit32(code, 8 * k);
+				emit(code, 3, 0x49, 0x89, 0x87);
+				emit32(code, 8 * op[1]);
+			}
+			break;
+
+			case R_FOR_STEP:
+				// The register machine reports step <= ERROR_BOUND
+				loadNumber(code, 0, op[1], REFERENCE(op[1]));
+				loadBits(code, 2, bitsOf(ERROR_BOUND));
+				emit(code, 4, 0x66, 0x0F, 0x2E, 0xC2);
+				branch(code, patches, BELOW_EQUAL, pc, true);
+				break;
+
+			case R_FOR_TEST:
+			case R_FOR_NEXT:
+			{
+				int k;
+
+				if (loopSlots.find(op[1]) != loopSlots.end())
+					k = this->reference(native, loopSlots[op[1]], -1);
+				else
+					k = this->reference(native, -1, op[1]);
+
+				loadNumber(code, 0, -1, k);
+				loadNumber(code, 1, op[2], REFERENCE(op[2]));
+
+				if (op[0] == R_FOR_TEST)
+				{
+					// Exit when to < variable or they are unordered
+					emit(code, 4, 0x66, 0x0F, 0x2E, 0xC8);
+					branch(code, patches, BELOW, op[3], false);
+				}
+				else
+				{
+					emit(code, 4, 0xF2, 0x0F, 0x58, 0xC1);
+					storeNumber(code, -1, k);
+					branch(code, patches, ALWAYS, op[3], false);
+				}
+			}
+			break;
+
+			case R_CASE:
+				loadNumber(code, 0, op[1], REFERENCE(op[1]));
+				loadNumber(code, 1, op[2], REFERENCE(op[2]));
+				emit(code, 4, 0xF2, 0x0F, 0x5C, 0xC1);
+				absolute(code);
+				loadBits(code, 2, bitsOf(ERROR_BOUND));
+				emit(code, 4, 0x66, 0x0F, 0x2E, 0xD0);
+				branch(code, patches, BELOW_EQUAL, op[3], false);
+				break;
+
+			default:
+				// Strings, print, read and the escapes to the AST
+				return false;
+		}
+	}
+
+	// The last instruction falls through to the end of the loop
+	emit(code, 1, 0xB8);
+	emit32(code, end);
+
+	// Epilogue: pop r15, r14, r13, r12, rbx; ret
+	int epilogue = code.size();
+	emit(code, 10, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0xC3);
+
+	// Every address returned to the register machine: mov eax, address; jmp epilogue
+	std::map<int, int> exits;
+
+	for (unsigned int i = 0; i < patches.size(); i++)
+	{
+		Patch & patch = patches[i];
+		int destination;
+
+		if ((not patch.exit) and (patch.target >= head) and (patch.target < end))
+			destination = labels[patch.target - head];
+		else
+		{
+			if (exits.find(patch.target) == exits.end())
+			{
+				exits[patch.target] = code.size();
+				emit(code, 1, 0xB8);
+				emit32(code, patch.target);
+				emit(code, 1, 0xE9);
+				emit32(code, epilogue - ((int) code.size() + 4));
+			}
+
+			destination = exits[patch.target];
+		}
+
+		patch32(code, patch.position, destination - (patch.position + 4));
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,185 @@
+/*!
+	\file    jit.hpp
+	\brief   Declaration of the translator of the loops of the register machine to machine code
+	\author
+	\date    2025-06-06
+	\version 1.0
+	\note    The machine code is only generated on x86-64 Linux.
+	         Elsewhere every loop is run by the register machine.
+*/
+
+#ifndef _JIT_HPP_
+#define _JIT_HPP_
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+#include "registerCode.hpp"
+
+#include "../table/variable.hpp"
+
+#if defined(__x86_64__) && defined(__linux__)
+	#define JIT_X86_64
+#endif
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \struct NativeFrame
+  \brief  State of the register machine shared with the machine code
+  \note   The machine code finds the fields at fixed offsets: do not reorder them
+*/
+struct NativeFrame
+{
+	double *numbers;                    //!< Registers of type NUMBER
+	char *bools;                        //!< Registers of type BOOL
+	double **references;                //!< Values of the variables used by the loop
+	lp::Variable **variables;           //!< Variables used by the loop, in the order of references
+	lp::Variable **loops;               //!< Variables of the for statements, by nesting depth
+};
+
+
+/*!
+  \class Jit
+  \brief Translation of the numeric loops of a RegisterChunk to x86-64 machine code
+  \note  Every loop is translated instruction by instruction from its first
+         instruction to its jump back, when all its instructions are numeric:
+         moves, assignments, arithmetic, comparisons, logical operators,
+         builtin functions, +:=, -:=, ++, --, jumps, cases and for statements;
+         "s := s || e" calls the append of the register machine.
+         The registers stay in the memory of the register machine, so the
+         machine code can return at any instruction: it returns the address of
+         the first instruction that it does not run, and the register machine
+         goes on from there. That happens when the loop ends and when an
+         instruction would report an error, such as a division by zero.
+         A loop only runs as machine code while all its variables are numeric.
+         No instruction of the machine code changes the type of a variable, so
+         its for statements are never detached from their variables and
+         neither arm nor disarm them: see Variable::arm.
+*/
+class Jit
+{
+	public:
+
+	/*!
+		\brief Machine code of a loop: returns the address of the next instruction
+	*/
+		typedef int (*NativeLoop)(lp::NativeFrame *frame);
+
+	private:
+
+	/*!
+	  \struct Reference
+	  \brief  Variable used by a loop: the variable of a slot or of a for statement
+	*/
+		struct Reference
+		{
+			int slot;   //!< Slot of the variable, -1 for the variable of a for statement
+			int loop;   //!< Nesting depth of the for statement when slot is -1
+		};
+
+	/*!
+	  \struct Native
+	  \brief  Loop translated to machine code
+	*/
+		struct Native
+		{
+			int offset;                           //!< Offset of the machine code in the executable memory
+			NativeLoop code;                      //!< Entry point of the machine code
+			std::vector<Reference> references;    //!< Variables used by the loop
+		};
+
+		const lp::RegisterChunk *_chunk;                  //!< Code whose loops are translated
+		std::vector<int> _natives;                        //!< Index of the Native of each jump back, -1 otherwise
+		std::vector<Native> _loops;                       //!< Loops translated to machine code
+		std::vector<double *> _references;                //!< Values of the variables while a loop runs
+		std::vector<lp::Variable *> _variables;           //!< Variables while a loop runs
+		std::string *_strings;                            //!< String registers of the register machine while a loop runs
+		unsigned char *_memory;                           //!< Executable memory, NULL if there is none
+		size_t _size;                                     //!< Size of the executable memory
+		int _rejected;                                    //!< Number of loops with instructions that are not numeric
+
+	public:
+
+	/*!
+		\brief Constructor of Jit
+		\param chunk: code whose loops are translated
+		\post  The loops are translated and their machine code is executable
+	*/
+		Jit(const lp::RegisterChunk *chunk);
+
+	/*!
+		\brief Destructor
+		\post  The executable memory is released
+	*/
+		~Jit();
+
+	/*!
+		\brief   Follow a jump of the register machine
+		\param   from: address of the jump
+		\param   to: address of the destination of the jump
+		\param   numbers, bools, strings, loops: registers and for statements of the register machine
+		\return  int: address of the next instruction of the register machine
+		\note    A jump back to the beginning of a translated loop runs the rest of the loop as machine code
+	*/
+		inline int jump(int from, int to, double *numbers, char *bools, std::string *strings, lp::Variable **loops)
+		{
+			if (this->_natives[from] < 0)
+				return to;
+
+			return this->run(this->_natives[from], to, numbers, bools, strings, loops);
+		}
+
+	/*!
+		\name Observers used to report the translation
+	*/
+		inline int getCompiled() const { return this->_loops.size(); }
+		inline int getRejected() const { return this->_rejected; }
+		inline size_t getSize() const { return this->_size; }
+
+	private:
+
+	/*!
+		\brief   Run the machine code of a loop if all its variables are numeric
+		\param   index: index of the Native
+		\param   to: beginning of the loop, returned when the loop cannot run as machine code
+		\param   numbers, bools, strings, loops: registers and for statements of the register machine
+		\return  int: address of the next instruction of the register machine
+	*/
+		int run(int index, int to, double *numbers, char *bools, std::string *strings, lp::Variable **loops);
+
+	/*!
+		\brief   Index of a variable in the references of a loop, added if it is not there
+		\param   native: loop
+		\param   slot: slot of the variable, -1 for the variable of a for statement
+		\param   loop: nesting depth of the for statement when slot is -1
+		\return  int
+	*/
+		int reference(Native &native, int slot, int loop);
+
+	/*!
+		\brief   Translate the instructions of a loop
+		\param   head: address of the first instruction of the loop
+		\param   end: address of the first instruction after the jump back
+		\param   native: variables used by the loop
+		\param   code: machine code, the translation is appended to it
+		\return  bool: false if an instruction cannot be translated
+	*/
+		bool translate(int head, int end, Native &native, std::vector<unsigned char> &code);
+
+	// Copying a Jit would release its executable memory twice
+		Jit(Jit const &);
+		Jit & operator=(Jit const &);
+};
+
+// End of name space lp
+}
+
+// End of _JIT_HPP_
+#endif
@@ -0,0 +1,75 @@
+/*!
+	\file    registerCode.cpp
+	\brief   Code of the functions of the RegisterChunk class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <iomanip>
+
+#include "registerCode.hpp"
+
+
+/*!
+  \brief Names of the opcodes and number of operands, in the order of RegisterOpCode
+*/
+static const struct
+{
+	const char *name;
+	int operands;
+} opcodes[lp::R_COUNT] =
+{
+	{"MOVE_NUMBER", 2}, {"MOVE_BOOL", 2}, {"MOVE_STRING", 2},
+	{"NEGATE", 2}, {"INCREMENT", 2}, {"DECREMENT", 2}, {"FACTORIAL", 2},
+	{"ADD", 3}, {"SUBTRACT", 3}, {"MULTIPLY", 3}, {"DIVIDE", 3}, {"INTEGER_DIVIDE", 3},
+	{"MODULO", 3}, {"POWER", 3}, {"CALL_0", 2}, {"CALL_1", 3}, {"CALL_2", 4},
+	{"CONCATENATE", 3}, {"GREATER", 3}, {"GREATER_EQUAL", 3}, {"LESS", 3},
+	{"LESS_EQUAL", 3}, {"EQUAL", 3}, {"NOT_EQUAL", 3}, {"COMPARE_BOOL", 4},
+	{"COMPARE_STRING", 4}, {"AND", 3}, {"OR", 3}, {"NOT", 2},
+	{"FALLBACK", 0}, {"EVAL_NUMBER", 2}, {"EVAL_BOOL", 2}, {"EVAL_STRING", 2}, {"EXECUTE", 1},
+	{"ASSIGN_VARIABLE", 3}, {"COPY", 2}, {"PLUS_ASSIGN", 3}, {"MINUS_ASSIGN", 3}, {"APPEND", 3},
+	{"PRINT_NUMBER", 1}, {"PRINT_BOOL", 1}, {"PRINT_STRING", 1}, {"PRINT_VARIABLE", 2},
+	{"READ", 1}, {"READ_STRING", 1}, {"INCREMENT_VARIABLE", 2}, {"DECREMENT_VARIABLE", 2},
+	{"FACTORIAL_VARIABLE", 2}, {"CLEAR_SCREEN", 0},
+	{"JUMP", 1}, {"JUMP_IF_FALSE", 2}, {"JUMP_IF_TRUE", 2}, {"CHECK_NUMBER", 2},
+	{"FOR_INTERVAL", 3}, {"FOR_VARIABLE", 4}, {"FOR_STEP", 2}, {"FOR_TEST", 3},
+	{"FOR_NEXT", 3}, {"CASE", 3}, {"HALT", 0}
+};
+
+
+int lp::RegisterChunk::length(int opcode)
+{
+	return 1 + opcodes[opcode].operands;
+}
+
+
+void lp::RegisterChunk::disassemble() const
+{
+	const std::vector<int> & code = this->getCode();
+	unsigned int pc = 0;
+
+	std::cout << "registers: " << this->_numberRegisters << " number, "
+	          << this->_boolRegisters << " bool, " << this->_stringRegisters << " string" << std::endl;
+
+	while (pc < code.size())
+	{
+		int op = code[pc];
+
+		std::cout << std::setw(5) << pc << "  " << opcodes[op].name;
+
+		// Variables are shown with their names
+		for (int i = 1; i <= opcodes[op].operands; i++)
+		{
+			if (code[pc + i] < 0)
+				std::cout << " " << this->getName(- code[pc + i] - 1);
+			else
+				std::cout << " " << code[pc + i];
+		}
+
+		std::cout << std::endl;
+
+		pc += length(op);
+	}
+}
@@ -0,0 +1,199 @@
+/*!
+	\file    registerCode.hpp
+	\brief   Declaration of the code executed by the register machine
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _REGISTERCODE_HPP_
+#define _REGISTERCODE_HPP_
+
+#include "bytecode.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \enum  RegisterOpCode
+  \brief Instructions of the register machine
+  \note  The operands follow the opcode in the code of the Chunk.
+         "dN", "dB" and "dS" are destinations and "aN", "bN", "aB"... are sources
+         of type NUMBER, BOOL and STRING: a register when the operand is not
+         negative, otherwise the variable of the slot -(operand + 1).
+         "stmt" is the index of the statement that is evaluated again by the AST
+         to report an error.
+*/
+enum RegisterOpCode
+{
+	// Moves
+	R_MOVE_NUMBER,        //!< dN aN
+	R_MOVE_BOOL,          //!< dB aB
+	R_MOVE_STRING,        //!< dS aS
+
+	// Numeric operators
+	R_NEGATE,             //!< dN aN: unary minus
+	R_INCREMENT,          //!< dN aN: value + 1
+	R_DECREMENT,          //!< dN aN: value - 1
+	R_FACTORIAL,          //!< dN aN: factorial
+	R_ADD,                //!< dN aN bN
+	R_SUBTRACT,           //!< dN aN bN
+	R_MULTIPLY,           //!< dN aN bN
+	R_DIVIDE,             //!< dN aN bN
+	R_INTEGER_DIVIDE,     //!< dN aN bN
+	R_MODULO,             //!< dN aN bN
+	R_POWER,              //!< dN aN bN
+	R_CALL_0,             //!< dN function
+	R_CALL_1,             //!< dN function aN
+	R_CALL_2,             //!< dN function aN bN
+
+	// String, relational and logical operators
+	R_CONCATENATE,        //!< dS aS bS
+	R_GREATER,            //!< dB aN bN
+	R_GREATER_EQUAL,      //!< dB aN bN
+	R_LESS,               //!< dB aN bN
+	R_LESS_EQUAL,         //!< dB aN bN
+	R_EQUAL,              //!< dB aN bN
+	R_NOT_EQUAL,          //!< dB aN bN
+	R_COMPARE_BOOL,       //!< dB aB bB comparison: the comparison is one of the numeric opcodes
+	R_COMPARE_STRING,     //!< dB aS bS comparison
+	R_AND,                //!< dB aB bB
+	R_OR,                 //!< dB aB bB
+	R_NOT,                //!< dB aB
+
+	// Escapes to the AST
+	R_FALLBACK,           //!< evaluate the whole expression with the AST
+	R_EVAL_NUMBER,        //!< dN node
+	R_EVAL_BOOL,          //!< dB node
+	R_EVAL_STRING,        //!< dS node
+	R_EXECUTE,            //!< stmt: evaluate a statement
+
+	// Statements
+	R_ASSIGN_VARIABLE,    //!< slot slot stmt: assign a variable of any type
+	R_COPY,               //!< slot slot: multiple assignment, copy the second variable to the first one
+	R_PLUS_ASSIGN,        //!< slot aN stmt: +:=
+	R_MINUS_ASSIGN,       //!< slot aN stmt: -:=
+	R_APPEND,             //!< slot aS stmt: s := s || e, append to the string of a variable
+	R_PRINT_NUMBER,       //!< aN
+	R_PRINT_BOOL,         //!< aB
+	R_PRINT_STRING,       //!< aS
+	R_PRINT_VARIABLE,     //!< slot stmt: print a variable of any type
+	R_READ,               //!< slot: read a number
+	R_READ_STRING,        //!< slot: read a string
+	R_INCREMENT_VARIABLE, //!< slot stmt: ++
+	R_DECREMENT_VARIABLE, //!< slot stmt: --
+	R_FACTORIAL_VARIABLE, //!< slot stmt: !
+	R_CLEAR_SCREEN,       //!< clear the screen
+
+	// Control flow
+	R_JUMP,               //!< address
+	R_JUMP_IF_FALSE,      //!< aB address
+	R_JUMP_IF_TRUE,       //!< aB address
+	R_CHECK_NUMBER,       //!< node stmt: the bound of a for statement must be numeric
+	R_FOR_INTERVAL,       //!< aN bN stmt: "to" and "from" of a for statement
+	R_FOR_VARIABLE,       //!< loop slot aN stmt: initialize the variable of a loop
+	R_FOR_STEP,           //!< aN stmt: check the step of a for statement
+	R_FOR_TEST,           //!< loop aN address: exit the loop when the variable exceeds "to"
+	R_FOR_NEXT,           //!< loop aN address: add the step to the variable and jump to the test
+	R_CASE,               //!< aN bN address: jump if the case does not match the switch value
+	R_HALT,               //!< end of the program
+
+	R_COUNT               //!< Number of opcodes
+};
+
+
+/*!
+  \class RegisterChunk
+  \brief Code of the register machine and the sizes of its register files
+  \note  The registers of each type are the temporaries of the expressions
+         followed by the constants of the Chunk. The bool constants are
+         false and true.
+*/
+class RegisterChunk: public lp::Chunk
+{
+	private:
+		int _numberRegisters;   //!< Temporary registers of type NUMBER
+		int _boolRegisters;     //!< Temporary registers of type BOOL
+		int _stringRegisters;   //!< Temporary registers of type STRING
+		int _loops;             //!< Nesting depth of the for statements
+		int _forNext;           //!< Address of the R_FOR_NEXT of the last outermost for statement, -1 if none
+
+	public:
+
+	/*!
+		\brief Constructor of RegisterChunk
+		\post  An empty RegisterChunk is created
+	*/
+		RegisterChunk(): _numberRegisters(0), _boolRegisters(0), _stringRegisters(0), _loops(0), _forNext(-1)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Record the number of temporary registers used by the code
+		\param   numbers, bools, strings: temporary registers in use
+		\return  void
+	*/
+		inline void reachRegisters(int numbers, int bools, int strings)
+		{
+			if (numbers > this->_numberRegisters)
+				this->_numberRegisters = numbers;
+			if (bools > this->_boolRegisters)
+				this->_boolRegisters = bools;
+			if (strings > this->_stringRegisters)
+				this->_stringRegisters = strings;
+		}
+
+	/*!
+		\brief   Record the nesting depth of the for statements
+		\return  void
+	*/
+		inline void reachLoops(int loops)
+		{
+			if (loops > this->_loops)
+				this->_loops = loops;
+		}
+
+	/*!
+		\brief   Record the R_FOR_NEXT of an outermost for statement
+		\param   address: address of the instruction
+		\return  void
+		\note    A chunk compiled from a single for statement can go on from the middle of its iterations
+	*/
+		inline void setForNext(int address)
+		{
+			this->_forNext = address;
+		}
+
+	/*!
+		\name Observers used by the register machine
+	*/
+		inline int getForNext() const { return this->_forNext; }
+		inline int getNumberRegisters() const { return this->_numberRegisters; }
+		inline int getBoolRegisters() const { return this->_boolRegisters; }
+		inline int getStringRegisters() const { return this->_stringRegisters; }
+		inline int getLoops() const { return this->_loops; }
+
+	/*!
+		\brief   Number of integers of an instruction, its opcode included
+		\param   opcode: RegisterOpCode of the instruction
+		\return  int
+	*/
+		static int length(int opcode);
+
+	/*!
+		\brief   Print the code in a readable form
+		\return  void
+	*/
+		void disassemble() const;
+};
+
+// End of name space lp
+}
+
+// End of _REGISTERCODE_HPP_
+#endif
@@ -0,0 +1,827 @@
+/*!
+	\file    registerCompiler.cpp
+	\brief   Code of the functions of the RegisterCompiler class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <list>
+
+#include "registerCompiler.hpp"
+
+#include "../table/table.hpp"
+#include "../table/numericConstant.hpp"
+#include "../table/logicalConstant.hpp"
+#include "../table/builtinParameter0.hpp"
+#include "../table/builtinParameter1.hpp"
+#include "../table/builtinParameter2.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief The operator chooses its own destination
+*/
+static const int NONE = -2147483647 - 1;
+
+/*!
+  \brief Constants are encoded as CONSTANT_BASE * kind + index until the end of the compilation
+*/
+static const int CONSTANT_BASE = 1 << 28;
+
+
+/*!
+  \brief  Kind of a constant: 1, 2 and 3 for NUMBER, BOOL and STRING
+*/
+static int kindOf(int type)
+{
+	return (type == NUMBER) ? 1 : (type == BOOL) ? 2 : 3;
+}
+
+
+/*!
+  \brief  Type of the value of an expression when no error is found
+  \param  node: expression
+  \return NUMBER, BOOL, STRING or 0 if it depends on the variables
+*/
+static int naturalType(lp::ExpNode *node)
+{
+	if (dynamic_cast<lp::ConstantNode *>(node))
+		return node->getType();
+
+	if (dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::NumericUnaryOperatorNode *>(node)
+		or dynamic_cast<lp::NumericOperatorNode *>(node) or dynamic_cast<lp::BuiltinFunctionNode *>(node))
+		return NUMBER;
+
+	if (dynamic_cast<lp::StringNode *>(node) or dynamic_cast<lp::ConcatenationNode *>(node))
+		return STRING;
+
+	if (dynamic_cast<lp::BoolNode *>(node) or dynamic_cast<lp::LogicalUnaryOperatorNode *>(node)
+		or dynamic_cast<lp::RelationalOperatorNode *>(node) or dynamic_cast<lp::LogicalOperatorNode *>(node))
+		return BOOL;
+
+	// Variables and unknown nodes
+	return 0;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::RegisterCompiler::emit(int word)
+{
+	int address = this->_chunk->emit(word);
+
+	// Operands that are constants are placed when the temporaries are known
+	if (word >= CONSTANT_BASE)
+		this->_constants.push_back(address);
+}
+
+void lp::RegisterCompiler::emit(int opcode, int operand)
+{
+	this->emit(opcode);
+	this->emit(operand);
+}
+
+void lp::RegisterCompiler::emit(int opcode, int operand1, int operand2)
+{
+	this->emit(opcode, operand1);
+	this->emit(operand2);
+}
+
+void lp::RegisterCompiler::emit(int opcode, int operand1, int operand2, int operand3)
+{
+	this->emit(opcode, operand1, operand2);
+	this->emit(operand3);
+}
+
+void lp::RegisterCompiler::emit(int opcode, int operand1, int operand2, int operand3, int operand4)
+{
+	this->emit(opcode, operand1, operand2, operand3);
+	this->emit(operand4);
+}
+
+void lp::RegisterCompiler::patchJump(int address)
+{
+	this->_chunk->patch(address, this->_chunk->size());
+}
+
+int lp::RegisterCompiler::temporary(int type)
+{
+	int result;
+
+	if (type == NUMBER)
+		result = this->_numbers++;
+	else if (type == BOOL)
+		result = this->_bools++;
+	else
+		result = this->_strings++;
+
+	this->_chunk->reachRegisters(this->_numbers, this->_bools, this->_strings);
+
+	return result;
+}
+
+int lp::RegisterCompiler::constant(int type, int index)
+{
+	return CONSTANT_BASE * kindOf(type) + index;
+}
+
+int lp::RegisterCompiler::variable(lp::VariableNode *var)
+{
+	this->_chunk->nameSlot(var->getSlot(), var->getId());
+
+	return - var->getSlot() - 1;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+void lp::RegisterCompiler::compile(lp::AST *root)
+{
+	this->compileStatements(root->getStatements());
+
+	this->finish();
+}
+
+
+void lp::RegisterCompiler::compile(lp::Statement *stmt)
+{
+	this->compileStatement(stmt);
+
+	this->finish();
+}
+
+
+void lp::RegisterCompiler::finish()
+{
+	this->emit(R_HALT);
+
+	// The constants follow the temporary registers of their type
+	for (std::list<int>::iterator it = this->_constants.begin(); it != this->_constants.end(); ++it)
+	{
+		int word = this->_chunk->getCode()[*it];
+		int kind = word / CONSTANT_BASE;
+		int index = word % CONSTANT_BASE;
+
+		if (kind == 1)
+			index += this->_chunk->getNumberRegisters();
+		else if (kind == 2)
+			index += this->_chunk->getBoolRegisters();
+		else
+			index += this->_chunk->getStringRegisters();
+
+		this->_chunk->patch(*it, index);
+	}
+}
+
+
+void lp::RegisterCompiler::compileStatements(std::list<lp::Statement *> *stmts)
+{
+	for (std::list<lp::Statement *>::iterator it = stmts->begin(); it != stmts->end(); ++it)
+		this->compileStatement(*it);
+}
+
+
+void lp::RegisterCompiler::compileStatement(lp::Statement *stmt)
+{
+	// The temporaries of a statement are free once it has been executed
+	int numbers = this->_numbers;
+	int bools = this->_bools;
+	int strings = this->_strings;
+
+	if (lp::AssignmentStmt *asgn = dynamic_cast<lp::AssignmentStmt *>(stmt))
+	{
+		this->compileAssignment(asgn);
+	}
+	else if ((dynamic_cast<lp::PlusAssignmentStmt *>(stmt) != NULL) or (dynamic_cast<lp::MinusAssignmentStmt *>(stmt) != NULL))
+	{
+		lp::PlusAssignmentStmt *plus = dynamic_cast<lp::PlusAssignmentStmt *>(stmt);
+		lp::MinusAssignmentStmt *minus = dynamic_cast<lp::MinusAssignmentStmt *>(stmt);
+		lp::ExpNode *exp = (plus != NULL) ? plus->getExp() : minus->getExp();
+		int slot = (plus != NULL) ? plus->getSlot() : minus->getSlot();
+		int index = this->_chunk->addStatement(stmt);
+
+		if ((exp == NULL) or not this->isCompilable(exp)
+			or ((dynamic_cast<lp::VariableNode *>(exp) == NULL) and (naturalType(exp) != NUMBER)))
+			this->emit(R_EXECUTE, index);
+		else
+		{
+			// Any error evaluates the whole statement again
+			int root = this->_chunk->addRoot(exp, 0, 0, this->_chunk->size(), NONE, index);
+			int operand = this->compileExpression(exp, NUMBER, NONE);
+
+			this->emit((plus != NULL) ? R_PLUS_ASSIGN : R_MINUS_ASSIGN, slot, operand, index);
+			this->_chunk->setResume(root, this->_chunk->size());
+		}
+	}
+	else if (lp::PrintStmt *print = dynamic_cast<lp::PrintStmt *>(stmt))
+	{
+		lp::ExpNode *exp = print->getExp();
+		int index = this->_chunk->addStatement(stmt);
+		int type = naturalType(exp);
+
+		if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(exp))
+			this->emit(R_PRINT_VARIABLE, var->getSlot(), index);
+		else if ((type == 0) or not this->isCompilable(exp))
+			this->emit(R_EXECUTE, index);
+		else
+		{
+			// Any error evaluates the whole statement again
+			int root = this->_chunk->addRoot(exp, 0, 0, this->_chunk->size(), NONE, index);
+			int operand = this->compileExpression(exp, type, NONE);
+
+			this->emit((type == NUMBER) ? R_PRINT_NUMBER : (type == BOOL) ? R_PRINT_BOOL : R_PRINT_STRING, operand);
+			this->_chunk->setResume(root, this->_chunk->size());
+		}
+	}
+	else if (lp::ReadStmt *read = dynamic_cast<lp::ReadStmt *>(stmt))
+	{
+		this->_chunk->nameSlot(read->getSlot(), read->getId());
+		this->emit(R_READ, read->getSlot());
+	}
+	else if (lp::ReadStringStmt *read = dynamic_cast<lp::ReadStringStmt *>(stmt))
+	{
+		this->_chunk->nameSlot(read->getSlot(), read->getId());
+		this->emit(R_READ_STRING, read->getSlot());
+	}
+	else if (dynamic_cast<lp::EmptyStmt *>(stmt))
+	{
+		// Nothing to do
+	}
+	else if (lp::IfStmt *ifStmt = dynamic_cast<lp::IfStmt *>(stmt))
+	{
+		int condition = this->compileRoot(ifStmt->getCondition(), BOOL);
+		this->emit(R_JUMP_IF_FALSE, condition, -1);
+		int otherwise = this->_chunk->size() - 1;
+
+		this->compileStatements(ifStmt->getConsequent());
+
+		if (ifStmt->getAlternative() != NULL)
+		{
+			this->emit(R_JUMP, -1);
+			int end = this->_chunk->size() - 1;
+
+			this->patchJump(otherwise);
+			this->compileStatements(ifStmt->getAlternative());
+			this->patchJump(end);
+		}
+		else
+			this->patchJump(otherwise);
+	}
+	else if (lp::WhileStmt *whileStmt = dynamic_cast<lp::WhileStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		int condition = this->compileRoot(whileStmt->getCondition(), BOOL);
+		this->emit(R_JUMP_IF_FALSE, condition, -1);
+		int end = this->_chunk->size() - 1;
+
+		this->compileStatements(whileStmt->getStatements());
+		this->emit(R_JUMP, top);
+
+		this->patchJump(end);
+	}
+	else if (lp::DoWhileStmt *doWhile = dynamic_cast<lp::DoWhileStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		this->compileStatements(doWhile->getStatements());
+
+		int condition = this->compileRoot(doWhile->getCondition(), BOOL);
+		this->emit(R_JUMP_IF_TRUE, condition, top);
+	}
+	else if (lp::RepeatStmt *repeat = dynamic_cast<lp::RepeatStmt *>(stmt))
+	{
+		int top = this->_chunk->size();
+
+		this->compileStatements(repeat->getStatements());
+
+		// The body is repeated until the condition is true
+		int condition = this->compileRoot(repeat->getCondition(), BOOL);
+		this->emit(R_JUMP_IF_FALSE, condition, top);
+	}
+	else if (lp::ForStmt *forStmt = dynamic_cast<lp::ForStmt *>(stmt))
+	{
+		this->compileFor(forStmt);
+	}
+	else if (lp::SwitchStmt *switchStmt = dynamic_cast<lp::SwitchStmt *>(stmt))
+	{
+		this->compileSwitch(switchStmt);
+	}
+	else if (lp::UnaryIncrementStmt *inc = dynamic_cast<lp::UnaryIncrementStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(inc->getExp());
+
+		if (var != NULL)
+			this->emit(R_INCREMENT_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(R_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::UnaryDecrementStmt *dec = dynamic_cast<lp::UnaryDecrementStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(dec->getExp());
+
+		if (var != NULL)
+			this->emit(R_DECREMENT_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(R_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::UnaryFactorialStmt *fact = dynamic_cast<lp::UnaryFactorialStmt *>(stmt))
+	{
+		lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(fact->getExp());
+
+		if (var != NULL)
+			this->emit(R_FACTORIAL_VARIABLE, var->getSlot(), this->_chunk->addStatement(stmt));
+		else
+			this->emit(R_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+	else if (lp::BlockStmt *block = dynamic_cast<lp::BlockStmt *>(stmt))
+	{
+		this->compileStatements(block->getStatements());
+	}
+	else if (dynamic_cast<lp::ClearScreenStmt *>(stmt))
+	{
+		this->emit(R_CLEAR_SCREEN);
+	}
+	else
+	{
+		// place and the statements without code are evaluated by the AST
+		this->emit(R_EXECUTE, this->_chunk->addStatement(stmt));
+	}
+
+	this->_numbers = numbers;
+	this->_bools = bools;
+	this->_strings = strings;
+}
+
+
+void lp::RegisterCompiler::compileAssignment(lp::AssignmentStmt *stmt)
+{
+	this->_chunk->nameSlot(stmt->getSlot(), stmt->getId());
+
+	// Multiple assignment: a := b := 2;
+	if (stmt->getExp() == NULL)
+	{
+		this->compileAssignment(stmt->getAssignment());
+		this->emit(R_COPY, stmt->getSlot(), stmt->getAssignment()->getSlot());
+		return;
+	}
+
+	lp::ExpNode *exp = stmt->getExp();
+	lp::ExpNode *tail = stmt->getAppended();
+	int index = this->_chunk->addStatement(stmt);
+	int type = naturalType(exp);
+
+	// The string of the variable grows in place: s := s || e
+	if ((tail != NULL) and this->isCompilable(tail)
+		and ((dynamic_cast<lp::VariableNode *>(tail) != NULL) or (naturalType(tail) == STRING)))
+	{
+		// Any error evaluates the whole statement again
+		int root = this->_chunk->addRoot(tail, 0, 0, this->_chunk->size(), NONE, index);
+		int operand = this->compileExpression(tail, STRING, NONE);
+
+		this->emit(R_APPEND, stmt->getSlot(), operand, index);
+		this->_chunk->setResume(root, this->_chunk->size());
+	}
+	else if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(exp))
+		this->emit(R_ASSIGN_VARIABLE, stmt->getSlot(), var->getSlot(), index);
+	else if ((type == 0) or not this->isCompilable(exp))
+		this->emit(R_EXECUTE, index);
+	else
+	{
+		// The last operator writes the variable; any error evaluates the whole statement again
+		int destination = - stmt->getSlot() - 1;
+		int root = this->_chunk->addRoot(exp, 0, 0, this->_chunk->size(), destination, index);
+
+		this->compileExpression(exp, type, destination);
+		this->_chunk->setResume(root, this->_chunk->size());
+	}
+}
+
+
+void lp::RegisterCompiler::compileFor(lp::ForStmt *stmt)
+{
+	int index = this->_chunk->addStatement(stmt);
+	int loop = this->_loop;
+
+	this->_chunk->nameSlot(stmt->getSlot(), stmt->getId());
+
+	// Types of the bounds and the step, in the order of the AST
+	this->emit(R_CHECK_NUMBER, this->_chunk->addNode(stmt->getFrom()), index);
+	this->emit(R_CHECK_NUMBER, this->_chunk->addNode(stmt->getTo()), index);
+	if (stmt->getStep() != NULL)
+		this->emit(R_CHECK_NUMBER, this->_chunk->addNode(stmt->getStep()), index);
+
+	int numbers = this->_numbers;
+
+	// Interval
+	int to = this->compileRoot(stmt->getTo(), NUMBER);
+	int from = this->compileRoot(stmt->getFrom(), NUMBER);
+	this->emit(R_FOR_INTERVAL, to, from, index);
+	this->_numbers = numbers;
+
+	// Loop variable
+	from = this->compileRoot(stmt->getFrom(), NUMBER);
+	this->emit(R_FOR_VARIABLE, loop, stmt->getSlot(), from, index);
+	this->_numbers = numbers;
+
+	// Step: its register is kept while the loop runs
+	int step;
+	if (stmt->getStep() != NULL)
+		step = this->compileRoot(stmt->getStep(), NUMBER);
+	else
+		step = this->constant(NUMBER, this->_chunk->addNumber(1.0));
+	this->emit(R_FOR_STEP, step, index);
+
+	// The upper bound is evaluated again in every iteration
+	int test = this->_chunk->size();
+	to = this->compileRoot(stmt->getTo(), NUMBER);
+	this->emit(R_FOR_TEST, loop, to, -1);
+	int end = this->_chunk->size() - 1;
+
+	this->_loop++;
+	this->_chunk->reachLoops(this->_loop);
+
+	this->compileStatements(stmt->getStatements());
+
+	if (loop == 0)
+		this->_chunk->setForNext(this->_chunk->size());
+
+	this->emit(R_FOR_NEXT, loop, step, test);
+
+	this->_loop--;
+	this->patchJump(end);
+}
+
+
+void lp::RegisterCompiler::compileSwitch(lp::SwitchStmt *stmt)
+{
+	std::list<int> ends;
+
+	// The strings are compared by the AST, which finds their case in a hash table
+	if (stmt->hasStringLabels())
+	{
+		this->emit(R_EXECUTE, this->_chunk->addStatement(stmt));
+		return;
+	}
+
+	// The register of the value of the switch is kept until a case matches
+	int value = this->compileRoot(stmt->getExp(), NUMBER);
+	int numbers = this->_numbers;
+
+	std::list<lp::CaseStmt *> *cases = stmt->getCases();
+
+	for (std::list<lp::CaseStmt *>::iterator it = cases->begin(); it != cases->end(); ++it)
+	{
+		int label = this->compileRoot((*it)->getExp(), NUMBER);
+		this->emit(R_CASE, value, label, -1);
+		int next = this->_chunk->size() - 1;
+		this->_numbers = numbers;
+
+		this->compileStatements((*it)->getStatements());
+		this->emit(R_JUMP, -1);
+		ends.push_back(this->_chunk->size() - 1);
+
+		this->patchJump(next);
+	}
+
+	if (stmt->getDefault() != NULL)
+		this->compileStatements(stmt->getDefault());
+
+	for (std::list<int>::iterator it = ends.begin(); it != ends.end(); ++it)
+		this->patchJump(*it);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+bool lp::RegisterCompiler::isCompilable(lp::ExpNode *node)
+{
+	if (dynamic_cast<lp::VariableNode *>(node) or dynamic_cast<lp::ConstantNode *>(node)
+		or dynamic_cast<lp::NumberNode *>(node) or dynamic_cast<lp::StringNode *>(node)
+		or dynamic_cast<lp::BoolNode *>(node) or dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+		return true;
+
+	if (lp::UnaryOperatorNode *unary = dynamic_cast<lp::UnaryOperatorNode *>(node))
+		return this->isCompilable(unary->getExp());
+
+	if (lp::OperatorNode *binary = dynamic_cast<lp::OperatorNode *>(node))
+		return this->isCompilable(binary->getLeft()) and this->isCompilable(binary->getRight());
+
+	if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+		return this->isCompilable(f->getExp());
+
+	if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+		return this->isCompilable(f->getExp1()) and this->isCompilable(f->getExp2());
+
+	// random and the unknown nodes are evaluated by the AST
+	return false;
+}
+
+
+int lp::RegisterCompiler::compileRoot(lp::ExpNode *node, int type)
+{
+	bool variable = (dynamic_cast<lp::VariableNode *>(node) != NULL);
+
+	// The AST evaluates the expressions that have no code or another type
+	if (not this->isCompilable(node) or (not variable and (naturalType(node) != type)))
+	{
+		int destination = this->temporary(type);
+
+		switch (type)
+		{
+			case NUMBER: this->emit(R_EVAL_NUMBER, destination, this->_chunk->addNode(node)); break;
+			case BOOL:   this->emit(R_EVAL_BOOL, destination, this->_chunk->addNode(node)); break;
+			default:     this->emit(R_EVAL_STRING, destination, this->_chunk->addNode(node)); break;
+		}
+
+		return destination;
+	}
+
+	int root = this->_chunk->addRoot(node, type, 0, this->_chunk->size());
+	int operand = this->compileExpression(node, type, NONE);
+
+	// The statements read their operands from registers: a variable is moved and its type checked
+	if (operand < 0)
+	{
+		int destination = this->temporary(type);
+
+		switch (type)
+		{
+			case NUMBER: this->emit(R_MOVE_NUMBER, destination, operand); break;
+			case BOOL:   this->emit(R_MOVE_BOOL, destination, operand); break;
+			default:     this->emit(R_MOVE_STRING, destination, operand); break;
+		}
+
+		operand = destination;
+	}
+
+	this->_chunk->setDestination(root, operand);
+	this->_chunk->setResume(root, this->_chunk->size());
+
+	return operand;
+}
+
+
+int lp::RegisterCompiler::compileExpression(lp::ExpNode *node, int type, int destination)
+{
+	int operand = NONE;
+
+	if (lp::VariableNode *var = dynamic_cast<lp::VariableNode *>(node))
+	{
+		operand = this->variable(var);
+	}
+	else if (lp::ConstantNode *c = dynamic_cast<lp::ConstantNode *>(node))
+	{
+		// The values of the constants can never change
+		if ((type == NUMBER) and (c->getType() == NUMBER))
+		{
+			lp::NumericConstant *n = (lp::NumericConstant *) table.getSymbol(c->getSlot());
+
+			operand = this->constant(NUMBER, this->_chunk->addNumber(n->getValue()));
+		}
+		else if ((type == BOOL) and (c->getType() == BOOL))
+		{
+			lp::LogicalConstant *b = (lp::LogicalConstant *) table.getSymbol(c->getSlot());
+
+			operand = this->constant(BOOL, b->getValue() ? 1 : 0);
+		}
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::NumberNode *number = dynamic_cast<lp::NumberNode *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+
+		operand = this->constant(NUMBER, this->_chunk->addNumber(number->getNumber()));
+	}
+	else if (lp::StringNode *string = dynamic_cast<lp::StringNode *>(node))
+	{
+		if (type != STRING)
+			return this->compileFallback(type, destination);
+
+		operand = this->constant(STRING, this->_chunk->addString(string->getString()));
+	}
+	else if (lp::BoolNode *logic = dynamic_cast<lp::BoolNode *>(node))
+	{
+		if (type != BOOL)
+			return this->compileFallback(type, destination);
+
+		operand = this->constant(BOOL, logic->getBool() ? 1 : 0);
+	}
+	else if (lp::NumericUnaryOperatorNode *unary = dynamic_cast<lp::NumericUnaryOperatorNode *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+		else if (dynamic_cast<lp::UnaryMinusNode *>(node))
+			return this->compileUnary(unary, R_NEGATE, destination);
+		else if (dynamic_cast<lp::UnaryPlusNode *>(node))
+			return this->compileExpression(unary->getExp(), NUMBER, destination);
+		else if (dynamic_cast<lp::UnaryIncrementNode *>(node))
+			return this->compileUnary(unary, R_INCREMENT, destination);
+		else if (dynamic_cast<lp::UnaryDecrementNode *>(node))
+			return this->compileUnary(unary, R_DECREMENT, destination);
+		else if (dynamic_cast<lp::UnaryFactorialNode *>(node))
+			return this->compileUnary(unary, R_FACTORIAL, destination);
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::LogicalUnaryOperatorNode *unary = dynamic_cast<lp::LogicalUnaryOperatorNode *>(node))
+	{
+		if ((type == BOOL) and dynamic_cast<lp::NotNode *>(node))
+			return this->compileUnary(unary, R_NOT, destination);
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::NumericOperatorNode *binary = dynamic_cast<lp::NumericOperatorNode *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+		else if (dynamic_cast<lp::PlusNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_ADD, destination);
+		else if (dynamic_cast<lp::MinusNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_SUBTRACT, destination);
+		else if (dynamic_cast<lp::MultiplicationNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_MULTIPLY, destination);
+		else if (dynamic_cast<lp::DivisionNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_DIVIDE, destination);
+		else if (dynamic_cast<lp::IntegerDivisionNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_INTEGER_DIVIDE, destination);
+		else if (dynamic_cast<lp::ModuloNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_MODULO, destination);
+		else if (dynamic_cast<lp::PowerNode *>(node))
+			return this->compileBinary(binary, NUMBER, NUMBER, R_POWER, destination);
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::ConcatenationNode *binary = dynamic_cast<lp::ConcatenationNode *>(node))
+	{
+		if (type != STRING)
+			return this->compileFallback(type, destination);
+
+		return this->compileBinary(binary, STRING, STRING, R_CONCATENATE, destination);
+	}
+	else if (lp::LogicalOperatorNode *binary = dynamic_cast<lp::LogicalOperatorNode *>(node))
+	{
+		if (type != BOOL)
+			return this->compileFallback(type, destination);
+		else if (dynamic_cast<lp::AndNode *>(node))
+			return this->compileBinary(binary, BOOL, BOOL, R_AND, destination);
+		else if (dynamic_cast<lp::OrNode *>(node))
+			return this->compileBinary(binary, BOOL, BOOL, R_OR, destination);
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::RelationalOperatorNode *binary = dynamic_cast<lp::RelationalOperatorNode *>(node))
+	{
+		// The operands keep their own type: the one of the first operand that is not a variable
+		int childType = naturalType(binary->getLeft());
+		if (childType == 0)
+			childType = naturalType(binary->getRight());
+		if (childType == 0)
+			childType = NUMBER;
+
+		if (type != BOOL)
+			return this->compileFallback(type, destination);
+		else if (dynamic_cast<lp::GreaterThanNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_GREATER, destination);
+		else if (dynamic_cast<lp::GreaterOrEqualNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_GREATER_EQUAL, destination);
+		else if (dynamic_cast<lp::LessThanNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_LESS, destination);
+		else if (dynamic_cast<lp::LessOrEqualNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_LESS_EQUAL, destination);
+		else if (dynamic_cast<lp::EqualNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_EQUAL, destination);
+		else if (dynamic_cast<lp::NotEqualNode *>(node))
+			return this->compileBinary(binary, childType, BOOL, R_NOT_EQUAL, destination);
+		else
+			return this->compileFallback(type, destination);
+	}
+	else if (lp::BuiltinFunctionNode_0 *f = dynamic_cast<lp::BuiltinFunctionNode_0 *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+
+		lp::BuiltinParameter0 *b = (lp::BuiltinParameter0 *) table.getSymbol(f->getSlot());
+
+		if (destination == NONE)
+			destination = this->temporary(NUMBER);
+
+		this->emit(R_CALL_0, destination, this->_chunk->addFunction(b->getFunction()));
+		return destination;
+	}
+	else if (lp::BuiltinFunctionNode_1 *f = dynamic_cast<lp::BuiltinFunctionNode_1 *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+
+		lp::BuiltinParameter1 *b = (lp::BuiltinParameter1 *) table.getSymbol(f->getSlot());
+		int numbers = this->_numbers;
+
+		int argument = this->compileExpression(f->getExp(), NUMBER, NONE);
+
+		this->_numbers = numbers;
+		if (destination == NONE)
+			destination = this->temporary(NUMBER);
+
+		this->emit(R_CALL_1, destination, this->_chunk->addFunction(b->getFunction()), argument);
+		return destination;
+	}
+	else if (lp::BuiltinFunctionNode_2 *f = dynamic_cast<lp::BuiltinFunctionNode_2 *>(node))
+	{
+		if (type != NUMBER)
+			return this->compileFallback(type, destination);
+
+		lp::BuiltinParameter2 *b = (lp::BuiltinParameter2 *) table.getSymbol(f->getSlot());
+		int numbers = this->_numbers;
+
+		int argument1 = this->compileExpression(f->getExp1(), NUMBER, NONE);
+		int argument2 = this->compileExpression(f->getExp2(), NUMBER, NONE);
+
+		this->_numbers = numbers;
+		if (destination == NONE)
+			destination = this->temporary(NUMBER);
+
+		this->emit(R_CALL_2, destination, this->_chunk->addFunction(b->getFunction()), argument1, argument2);
+		return destination;
+	}
+	else
+		return this->compileFallback(type, destination);
+
+	// A variable or a constant is only moved when the destination is given
+	if (destination == NONE)
+		return operand;
+
+	switch (type)
+	{
+		case NUMBER: this->emit(R_MOVE_NUMBER, destination, operand); break;
+		case BOOL:   this->emit(R_MOVE_BOOL, destination, operand); break;
+		default:     this->emit(R_MOVE_STRING, destination, operand); break;
+	}
+
+	return destination;
+}
+
+
+int lp::RegisterCompiler::compileFallback(int type, int destination)
+{
+	// The type is wrong and the AST reports the error
+	this->emit(R_FALLBACK);
+
+	return (destination == NONE) ? this->temporary(type) : destination;
+}
+
+
+int lp::RegisterCompiler::compileUnary(lp::UnaryOperatorNode *node, int opcode, int destination)
+{
+	int type = (opcode == R_NOT) ? BOOL : NUMBER;
+	int numbers = this->_numbers;
+	int bools = this->_bools;
+
+	int operand = this->compileExpression(node->getExp(), type, NONE);
+
+	// The destination can reuse the register of the operand
+	this->_numbers = numbers;
+	this->_bools = bools;
+	if (destination == NONE)
+		destination = this->temporary(type);
+
+	this->emit(opcode, destination, operand);
+
+	return destination;
+}
+
+
+int lp::RegisterCompiler::compileBinary(lp::OperatorNode *node, int childType, int type, int opcode, int destination)
+{
+	int numbers = this->_numbers;
+	int bools = this->_bools;
+	int strings = this->_strings;
+
+	int left = this->compileExpression(node->getLeft(), childType, NONE);
+	int right = this->compileExpression(node->getRight(), childType, NONE);
+
+	// The destination can reuse the registers of the operands
+	this->_numbers = numbers;
+	this->_bools = bools;
+	this->_strings = strings;
+	if (destination == NONE)
+		destination = this->temporary(type);
+
+	// Comparison of logical values or strings
+	if ((childType != NUMBER) and (type == BOOL) and (opcode != R_AND) and (opcode != R_OR))
+		this->emit((childType == BOOL) ? R_COMPARE_BOOL : R_COMPARE_STRING, destination, left, right, opcode);
+	else
+		this->emit(opcode, destination, left, right);
+
+	return destination;
+}
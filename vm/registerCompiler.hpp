@@ -0,0 +1,116 @@
+/*!
+	\file    registerCompiler.hpp
+	\brief   Declaration of the compiler from the AST to the code of the register machine
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _REGISTERCOMPILER_HPP_
+#define _REGISTERCOMPILER_HPP_
+
+#include <list>
+
+#include "../ast/ast.hpp"
+
+#include "registerCode.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class RegisterCompiler
+  \brief Translation of the AST into the code of a RegisterChunk
+  \note  Every operator writes its result straight into its destination:
+         a temporary register or, for the last operator of an assignment,
+         the variable itself. The constants are encoded while the code is
+         being compiled and placed after the temporary registers at the end.
+*/
+class RegisterCompiler
+{
+	private:
+		lp::RegisterChunk *_chunk;      //!< Chunk that receives the code
+		int _numbers;                   //!< Temporary registers of type NUMBER in use
+		int _bools;                     //!< Temporary registers of type BOOL in use
+		int _strings;                   //!< Temporary registers of type STRING in use
+		int _loop;                      //!< Nesting depth of the current for statement
+		std::list<int> _constants;      //!< Addresses of the operands that are constants
+
+	public:
+
+	/*!
+		\brief Constructor of RegisterCompiler
+		\param chunk: empty RegisterChunk that receives the code
+	*/
+		RegisterCompiler(lp::RegisterChunk *chunk): _chunk(chunk), _numbers(0), _bools(0), _strings(0), _loop(0)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief   Compile the whole program
+		\param   root: AST of the program, already analyzed
+		\return  void
+		\post    The last instruction of the RegisterChunk is R_HALT
+	*/
+		void compile(lp::AST *root);
+
+	/*!
+		\brief   Compile a single statement, as a loop promoted by the AST
+		\param   stmt: statement, already analyzed
+		\return  void
+		\post    The last instruction of the RegisterChunk is R_HALT
+	*/
+		void compile(lp::Statement *stmt);
+
+	private:
+
+	/*!
+		\brief   End the code with R_HALT and place the constants after the temporary registers
+		\return  void
+	*/
+		void finish();
+
+	/*!
+		\name Auxiliary functions
+	*/
+		void emit(int word);
+		void emit(int opcode, int operand);
+		void emit(int opcode, int operand1, int operand2);
+		void emit(int opcode, int operand1, int operand2, int operand3);
+		void emit(int opcode, int operand1, int operand2, int operand3, int operand4);
+		void patchJump(int address);
+		int temporary(int type);
+		int constant(int type, int index);
+		int variable(lp::VariableNode *var);
+
+	/*!
+		\name Statements
+	*/
+		void compileStatements(std::list<lp::Statement *> *stmts);
+		void compileStatement(lp::Statement *stmt);
+		void compileAssignment(lp::AssignmentStmt *stmt);
+		void compileFor(lp::ForStmt *stmt);
+		void compileSwitch(lp::SwitchStmt *stmt);
+
+	/*!
+		\name Expressions
+	*/
+		bool isCompilable(lp::ExpNode *node);
+		int compileRoot(lp::ExpNode *node, int type);
+		int compileStatementRoot(lp::ExpNode *node, int type, int destination, int stmt);
+		int compileExpression(lp::ExpNode *node, int type, int destination);
+		int compileFallback(int type, int destination);
+		int compileUnary(lp::UnaryOperatorNode *node, int opcode, int destination);
+		int compileBinary(lp::OperatorNode *node, int childType, int type, int opcode, int destination);
+};
+
+// End of name space lp
+}
+
+// End of _REGISTERCOMPILER_HPP_
+#endif
@@ -0,0 +1,882 @@
+/*!
+	\file    registerMachine.cpp
+	\brief   Code of the functions of the RegisterMachine class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <string>
+#include <cmath>
+
+#include "registerMachine.hpp"
+
+#include "../table/table.hpp"
+#include "../table/variable.hpp"
+
+#include "../includes/globals.hpp"
+#include "../includes/macros.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+#include "dispatch.hpp"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief Read an operand of type NUMBER: a register or a numeric variable
+*/
+#define NUMBER_OPERAND(value, operand)                                        \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			value = numbers[o_];                                              \
+		else                                                                  \
+		{                                                                     \
+			lp::Variable *v_ = (lp::Variable *) table.getSymbol(- o_ - 1);    \
+			if (v_->getType() != NUMBER)                                      \
+				goto fallback;                                                \
+			value = v_->getNumber();                 \
+		}                                                                     \
+	}
+
+/*!
+  \brief Read an operand of type BOOL: a register or a logical variable
+*/
+#define BOOL_OPERAND(value, operand)                                          \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			value = bools[o_];                                                \
+		else                                                                  \
+		{                                                                     \
+			lp::Variable *v_ = (lp::Variable *) table.getSymbol(- o_ - 1);    \
+			if (v_->getType() != BOOL)                                        \
+				goto fallback;                                                \
+			value = v_->getLogical();                 \
+		}                                                                     \
+	}
+
+/*!
+  \brief Read an operand of type STRING: a register or a string variable
+*/
+#define STRING_OPERAND(value, operand)                                        \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			value = strings[o_];                                              \
+		else                                                                  \
+		{                                                                     \
+			lp::Variable *v_ = (lp::Variable *) table.getSymbol(- o_ - 1);    \
+			if (v_->getType() != STRING)                                      \
+				goto fallback;                                                \
+			value = v_->getString();                  \
+		}                                                                     \
+	}
+
+/*!
+  \brief Write a destination: a register or a variable, as the assignment of the AST does
+*/
+#define SET_NUMBER(operand, value)                                            \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			numbers[o_] = (value);                                            \
+		else                                                                  \
+			this->storeNumber(- o_ - 1, (value));                             \
+	}
+
+#define SET_BOOL(operand, value)                                              \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			bools[o_] = (value);                                              \
+		else                                                                  \
+			this->storeBool(- o_ - 1, (value));                               \
+	}
+
+#define SET_STRING(operand, value)                                            \
+	{                                                                         \
+		int o_ = (operand);                                                   \
+		if (o_ >= 0)                                                          \
+			strings[o_] = (value);                                            \
+		else                                                                  \
+			this->storeString(- o_ - 1, (value));                             \
+	}
+
+
+/*!
+  \brief Address after a jump: the jumps back to a loop translated by the Jit run it as machine code
+*/
+#define JUMP(from, to) ((jit == NULL) ? (to) : jit->jump((from), (to), numbers, bools, strings, loops))
+
+
+lp::RegisterMachine::RegisterMachine(const lp::RegisterChunk *chunk, lp::Jit *jit): _chunk(chunk), _jit(jit)
+{
+	const std::vector<double> & numbers = chunk->getNumbers();
+	const std::vector<std::string> & strings = chunk->getStrings();
+
+	// The temporary registers are followed by the constants
+	this->_numbers.resize(chunk->getNumberRegisters());
+	this->_numbers.insert(this->_numbers.end(), numbers.begin(), numbers.end());
+	this->_numbers.push_back(0.0);
+
+	this->_bools.resize(chunk->getBoolRegisters());
+	this->_bools.push_back(false);
+	this->_bools.push_back(true);
+
+	this->_strings.resize(chunk->getStringRegisters());
+	this->_strings.insert(this->_strings.end(), strings.begin(), strings.end());
+	this->_strings.push_back("");
+
+	this->_loops.resize(chunk->getLoops() + 1);
+	this->_generations.resize(chunk->getLoops() + 1);
+}
+
+
+int lp::RegisterMachine::fallback(int pc)
+{
+	const std::vector<lp::Root> & roots = this->_chunk->getRoots();
+
+	// The roots are sorted by their first instruction and do not overlap
+	int low = 0;
+	int high = roots.size() - 1;
+
+	while (low < high)
+	{
+		int middle = (low + high + 1) / 2;
+
+		if (roots[middle].start <= pc)
+			low = middle;
+		else
+			high = middle - 1;
+	}
+
+	const lp::Root & root = roots[low];
+
+	// Same order as the statements of the AST: the type first, then the value
+	if (root.type == 0)
+		this->_chunk->getStatements()[root.statement]->evaluate();
+	else if (root.type == NUMBER)
+		this->_numbers[root.destination] = root.node->evaluateNumber();
+	else if (root.type == BOOL)
+		this->_bools[root.destination] = root.node->evaluateBool();
+	else
+		this->_strings[root.destination] = root.node->evaluateString();
+
+	return root.resume;
+}
+
+
+void lp::RegisterMachine::storeNumber(int slot, double value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != NUMBER)
+	{
+		var->retype(NUMBER);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setNumber(value);
+}
+
+
+void lp::RegisterMachine::storeBool(int slot, bool value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != BOOL)
+	{
+		var->retype(BOOL);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setLogical(value);
+}
+
+
+void lp::RegisterMachine::storeString(int slot, std::string const & value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != STRING)
+	{
+		var->retype(STRING);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setString(value);
+}
+
+
+void lp::RegisterMachine::resume(lp::Variable *loopVar, int generation, double step)
+{
+	const std::vector<int> & code = this->_chunk->getCode();
+	int next = this->_chunk->getForNext();
+
+	// The state of the loop kept by the AST: its variable, its generation and its step
+	this->_loops[code[next + 1]] = loopVar;
+	this->_generations[code[next + 1]] = generation;
+	this->_numbers[code[next + 2]] = step;
+
+	this->run(code[next + 3]);
+}
+
+
+void lp::RegisterMachine::run(int start)
+{
+	const int *code = &this->_chunk->getCode()[0];
+	const std::vector<lp::ExpNode *> & nodes = this->_chunk->getNodes();
+	const std::vector<lp::Statement *> & statements = this->_chunk->getStatements();
+
+	double *numbers = &this->_numbers[0];
+	char *bools = &this->_bools[0];
+	std::string *strings = &this->_strings[0];
+	lp::Variable **loops = &this->_loops[0];
+	int *generations = &this->_generations[0];
+	lp::Jit *jit = this->_jit;
+
+	int pc = start;   // Next instruction
+
+#ifdef COMPUTED_GOTO
+	// Address of the code of every instruction, in the order of RegisterOpCode
+	static const void *labels[] =
+	{
+		&&L_R_MOVE_NUMBER, &&L_R_MOVE_BOOL, &&L_R_MOVE_STRING, &&L_R_NEGATE, &&L_R_INCREMENT,
+		&&L_R_DECREMENT, &&L_R_FACTORIAL, &&L_R_ADD, &&L_R_SUBTRACT, &&L_R_MULTIPLY, &&L_R_DIVIDE,
+		&&L_R_INTEGER_DIVIDE, &&L_R_MODULO, &&L_R_POWER, &&L_R_CALL_0, &&L_R_CALL_1, &&L_R_CALL_2,
+		&&L_R_CONCATENATE, &&L_R_GREATER, &&L_R_GREATER_EQUAL, &&L_R_LESS, &&L_R_LESS_EQUAL, &&L_R_EQUAL,
+		&&L_R_NOT_EQUAL, &&L_R_COMPARE_BOOL, &&L_R_COMPARE_STRING, &&L_R_AND, &&L_R_OR, &&L_R_NOT,
+		&&L_R_FALLBACK, &&L_R_EVAL_NUMBER, &&L_R_EVAL_BOOL, &&L_R_EVAL_STRING, &&L_R_EXECUTE,
+		&&L_R_ASSIGN_VARIABLE, &&L_R_COPY, &&L_R_PLUS_ASSIGN, &&L_R_MINUS_ASSIGN, &&L_R_APPEND,
+		&&L_R_PRINT_NUMBER, &&L_R_PRINT_BOOL, &&L_R_PRINT_STRING, &&L_R_PRINT_VARIABLE, &&L_R_READ, &&L_R_READ_STRING,
+		&&L_R_INCREMENT_VARIABLE, &&L_R_DECREMENT_VARIABLE, &&L_R_FACTORIAL_VARIABLE, &&L_R_CLEAR_SCREEN,
+		&&L_R_JUMP, &&L_R_JUMP_IF_FALSE, &&L_R_JUMP_IF_TRUE, &&L_R_CHECK_NUMBER, &&L_R_FOR_INTERVAL,
+		&&L_R_FOR_VARIABLE, &&L_R_FOR_STEP, &&L_R_FOR_TEST, &&L_R_FOR_NEXT, &&L_R_CASE, &&L_R_HALT
+	};
+#endif
+
+	for (;;)
+	{
+		DISPATCH
+		{
+			////////////////////////////////////////////
+			// Moves
+
+			INSTRUCTION(R_MOVE_NUMBER):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				SET_NUMBER(code[pc + 1], a);
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_MOVE_BOOL):
+			{
+				bool a;
+				BOOL_OPERAND(a, code[pc + 2]);
+				SET_BOOL(code[pc + 1], a);
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_MOVE_STRING):
+			{
+				std::string a;
+				STRING_OPERAND(a, code[pc + 2]);
+				SET_STRING(code[pc + 1], a);
+				pc += 3;
+			}
+			NEXT;
+
+			////////////////////////////////////////////
+			// Numeric operators
+
+			INSTRUCTION(R_NEGATE):
+			INSTRUCTION(R_INCREMENT):
+			INSTRUCTION(R_DECREMENT):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 2]);
+
+				if (code[pc] == R_NEGATE)
+					a = - a;
+				else if (code[pc] == R_INCREMENT)
+					a++;
+				else
+					a--;
+
+				SET_NUMBER(code[pc + 1], a);
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_FACTORIAL):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 2]);
+
+				if (a < 0 || floor(a) != a)
+					goto fallback;
+
+				double result = 1.0;
+				for (int i = 1; i <= (int) a; ++i)
+					result *= i;
+
+				SET_NUMBER(code[pc + 1], result);
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_ADD):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+				SET_NUMBER(code[pc + 1], a + b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_SUBTRACT):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+				SET_NUMBER(code[pc + 1], a - b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_MULTIPLY):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+				SET_NUMBER(code[pc + 1], a * b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_DIVIDE):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+
+				if (std::abs(b) <= ERROR_BOUND)
+					goto fallback;
+
+				SET_NUMBER(code[pc + 1], a / b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_INTEGER_DIVIDE):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+
+				int leftInt = static_cast<int>(a);
+				int rightInt = static_cast<int>(b);
+
+				if ((std::abs(b) <= ERROR_BOUND) or (rightInt == 0))
+					goto fallback;
+
+				SET_NUMBER(code[pc + 1], static_cast<double>(leftInt / rightInt));
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_MODULO):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+
+				if (std::abs(b) <= ERROR_BOUND)
+					goto fallback;
+
+				SET_NUMBER(code[pc + 1], (int) a % (int) b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_POWER):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+				SET_NUMBER(code[pc + 1], pow(a, b));
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_CALL_0):
+				SET_NUMBER(code[pc + 1], this->_chunk->getFunctions0()[code[pc + 2]]());
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_CALL_1):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 3]);
+				SET_NUMBER(code[pc + 1], this->_chunk->getFunctions1()[code[pc + 2]](a));
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_CALL_2):
+			{
+				double a, b;
+				NUMBER_OPERAND(a, code[pc + 3]);
+				NUMBER_OPERAND(b, code[pc + 4]);
+				SET_NUMBER(code[pc + 1], this->_chunk->getFunctions2()[code[pc + 2]](a, b));
+				pc += 5;
+			}
+			NEXT;
+
+			////////////////////////////////////////////
+			// String, relational and logical operators
+
+			INSTRUCTION(R_CONCATENATE):
+			{
+				std::string a, b;
+				STRING_OPERAND(a, code[pc + 2]);
+				STRING_OPERAND(b, code[pc + 3]);
+				SET_STRING(code[pc + 1], a + b);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_GREATER):
+			INSTRUCTION(R_GREATER_EQUAL):
+			INSTRUCTION(R_LESS):
+			INSTRUCTION(R_LESS_EQUAL):
+			INSTRUCTION(R_EQUAL):
+			INSTRUCTION(R_NOT_EQUAL):
+			{
+				double a, b;
+				bool result = false;
+				NUMBER_OPERAND(a, code[pc + 2]);
+				NUMBER_OPERAND(b, code[pc + 3]);
+
+				switch (code[pc])
+				{
+					case R_GREATER:       result = (a > b); break;
+					case R_GREATER_EQUAL: result = (a >= b); break;
+					case R_LESS:          result = (a < b); break;
+					case R_LESS_EQUAL:    result = (a <= b); break;
+					// ERROR_BOUND to control the precision of real numbers
+					case R_EQUAL:         result = (std::abs(a - b) < ERROR_BOUND); break;
+					case R_NOT_EQUAL:     result = (std::abs(a - b) >= ERROR_BOUND); break;
+				}
+
+				SET_BOOL(code[pc + 1], result);
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_COMPARE_BOOL):
+			{
+				bool a, b, result = false;
+				BOOL_OPERAND(a, code[pc + 2]);
+				BOOL_OPERAND(b, code[pc + 3]);
+
+				switch (code[pc + 4])
+				{
+					case R_GREATER:       result = (a > b); break;
+					case R_GREATER_EQUAL: result = (a >= b); break;
+					case R_LESS:          result = (a < b); break;
+					case R_LESS_EQUAL:    result = (a <= b); break;
+					case R_EQUAL:         result = (a == b); break;
+					case R_NOT_EQUAL:     result = (a != b); break;
+				}
+
+				SET_BOOL(code[pc + 1], result);
+				pc += 5;
+			}
+			NEXT;
+
+			INSTRUCTION(R_COMPARE_STRING):
+			{
+				std::string a, b;
+				bool result = false;
+				STRING_OPERAND(a, code[pc + 2]);
+				STRING_OPERAND(b, code[pc + 3]);
+
+				switch (code[pc + 4])
+				{
+					case R_GREATER:       result = (a > b); break;
+					case R_GREATER_EQUAL: result = (a >= b); break;
+					case R_LESS:          result = (a < b); break;
+					case R_LESS_EQUAL:    result = (a <= b); break;
+					case R_EQUAL:         result = (a == b); break;
+					case R_NOT_EQUAL:     result = (a != b); break;
+				}
+
+				SET_BOOL(code[pc + 1], result);
+				pc += 5;
+			}
+			NEXT;
+
+			INSTRUCTION(R_AND):
+			INSTRUCTION(R_OR):
+			{
+				bool a, b;
+				BOOL_OPERAND(a, code[pc + 2]);
+				BOOL_OPERAND(b, code[pc + 3]);
+				SET_BOOL(code[pc + 1], (code[pc] == R_AND) ? (a and b) : (a or b));
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_NOT):
+			{
+				bool a;
+				BOOL_OPERAND(a, code[pc + 2]);
+				SET_BOOL(code[pc + 1], not a);
+				pc += 3;
+			}
+			NEXT;
+
+			////////////////////////////////////////////
+			// Escapes to the AST
+
+			INSTRUCTION(R_FALLBACK):
+				goto fallback;
+
+			INSTRUCTION(R_EVAL_NUMBER):
+				numbers[code[pc + 1]] = nodes[code[pc + 2]]->evaluateNumber();
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_EVAL_BOOL):
+				bools[code[pc + 1]] = nodes[code[pc + 2]]->evaluateBool();
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_EVAL_STRING):
+				strings[code[pc + 1]] = nodes[code[pc + 2]]->evaluateString();
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_EXECUTE):
+				statements[code[pc + 1]]->evaluate();
+				pc += 2;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Statements
+
+			INSTRUCTION(R_ASSIGN_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 2]);
+
+				if (var->getType() == NUMBER)
+					this->storeNumber(code[pc + 1], var->getNumber());
+				else if (var->getType() == BOOL)
+					this->storeBool(code[pc + 1], var->getLogical());
+				else if (var->getType() == STRING)
+					this->storeString(code[pc + 1], var->getString());
+				else
+					// The AST reports the error
+					statements[code[pc + 3]]->evaluate();
+
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_COPY):
+			{
+				lp::Variable *second = (lp::Variable *) table.getSymbol(code[pc + 2]);
+
+				// Only numeric and logical variables are copied
+				if (second->getType() == NUMBER)
+					this->storeNumber(code[pc + 1], second->getNumber());
+				else if (second->getType() == BOOL)
+					this->storeBool(code[pc + 1], second->getLogical());
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_PLUS_ASSIGN):
+			INSTRUCTION(R_MINUS_ASSIGN):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 2]);
+
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if (var->getType() == NUMBER)
+				{
+					lp::Variable *n = var;
+
+					if (code[pc] == R_PLUS_ASSIGN)
+						n->setNumber(n->getNumber() + a);
+					else
+						n->setNumber(n->getNumber() - a);
+				}
+				else
+					// The AST reports the error
+					statements[code[pc + 3]]->evaluate();
+
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_APPEND):
+			{
+				std::string a;
+				STRING_OPERAND(a, code[pc + 2]);
+
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				// The string of the variable is not copied
+				if (var->getType() == STRING)
+					var->append(a);
+				else
+					// The AST reports the error
+					statements[code[pc + 3]]->evaluate();
+
+				pc += 4;
+			}
+			NEXT;
+
+			INSTRUCTION(R_PRINT_NUMBER):
+			{
+				double a;
+				NUMBER_OPERAND(a, code[pc + 1]);
+				std::cout << a << std::endl;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(R_PRINT_BOOL):
+			{
+				bool a;
+				BOOL_OPERAND(a, code[pc + 1]);
+				std::cout << (a ? "true" : "false") << std::endl;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(R_PRINT_STRING):
+			{
+				std::string a;
+				STRING_OPERAND(a, code[pc + 1]);
+				std::cout << a << std::endl;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(R_PRINT_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if (var->getType() == NUMBER)
+					std::cout << var->getNumber() << std::endl;
+				else if (var->getType() == BOOL)
+					std::cout << (var->getLogical() ? "true" : "false") << std::endl;
+				else if (var->getType() == STRING)
+					std::cout << var->getString() << std::endl;
+				else
+					// The AST reports the error
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_READ):
+			{
+				double value;
+				std::cin >> value;
+
+				this->storeNumber(code[pc + 1], value);
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(R_READ_STRING):
+			{
+				std::string value;
+				std::cin >> value;
+
+				this->storeString(code[pc + 1], value);
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(R_INCREMENT_VARIABLE):
+			INSTRUCTION(R_DECREMENT_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if ((var != NULL) and (var->getType() == NUMBER))
+				{
+					lp::Variable *n = var;
+
+					n->setNumber(n->getNumber() + ((code[pc] == R_INCREMENT_VARIABLE) ? 1 : -1));
+				}
+				else
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_FACTORIAL_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+				bool valid = (var != NULL) and (var->getType() == NUMBER);
+
+				if (valid)
+				{
+					lp::Variable *n = var;
+					double value = n->getNumber();
+
+					if (value < 0 || value != static_cast<int>(value))
+						valid = false;
+					else
+					{
+						int result = 1;
+						for (int i = 2; i <= static_cast<int>(value); ++i)
+							result *= i;
+
+						n->setNumber(result);
+					}
+				}
+
+				if (not valid)
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(R_CLEAR_SCREEN):
+				std::cout << CLEAR_SCREEN_TEXT;
+				pc++;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Control flow: the conditions, bounds and cases are always in registers
+
+			INSTRUCTION(R_JUMP):
+				pc = JUMP(pc, code[pc + 1]);
+				NEXT;
+
+			INSTRUCTION(R_JUMP_IF_FALSE):
+				pc = bools[code[pc + 1]] ? pc + 3 : JUMP(pc, code[pc + 2]);
+				NEXT;
+
+			INSTRUCTION(R_JUMP_IF_TRUE):
+				pc = bools[code[pc + 1]] ? JUMP(pc, code[pc + 2]) : pc + 3;
+				NEXT;
+
+			INSTRUCTION(R_CHECK_NUMBER):
+				if (nodes[code[pc + 1]]->getType() != NUMBER)
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_FOR_INTERVAL):
+				// to < from
+				if (numbers[code[pc + 1]] < numbers[code[pc + 2]])
+					statements[code[pc + 3]]->evaluate();
+
+				pc += 4;
+				NEXT;
+
+			INSTRUCTION(R_FOR_VARIABLE):
+			{
+				int slot = code[pc + 2];
+				lp::Variable *symbol = (lp::Variable *) table.getSymbol(slot);
+				lp::Variable *loopVar;
+
+				if (symbol == NULL)
+				{
+					loopVar = new lp::Variable(this->_chunk->getName(slot), VARIABLE, NUMBER);
+					table.installSymbol(loopVar);
+				}
+				else
+				{
+					if (symbol->getType() != NUMBER)
+					{
+						symbol->retype(NUMBER);
+						// The expressions that use the variable may change their type
+						typeEpoch++;
+					}
+
+					loopVar = symbol;
+				}
+
+				loopVar->setNumber(numbers[code[pc + 3]]);
+
+				loops[code[pc + 1]] = loopVar;
+				generations[code[pc + 1]] = loopVar->arm();
+				pc += 5;
+			}
+			NEXT;
+
+			INSTRUCTION(R_FOR_STEP):
+				if (numbers[code[pc + 1]] <= ERROR_BOUND)
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(R_FOR_TEST):
+				if (loops[code[pc + 1]]->getNumber() <= numbers[code[pc + 2]])
+					pc += 4;
+				else
+				{
+					loops[code[pc + 1]]->disarm();
+					pc = code[pc + 3];
+				}
+				NEXT;
+
+			INSTRUCTION(R_FOR_NEXT):
+			{
+				// The body may have detached the loop from its variable
+				lp::Variable *loopVar = loops[code[pc + 1]]->counter(generations[code[pc + 1]]);
+
+				loops[code[pc + 1]] = loopVar;
+				loopVar->setNumber(loopVar->getNumber() + numbers[code[pc + 2]]);
+				pc = JUMP(pc, code[pc + 3]);
+			}
+			NEXT;
+
+			INSTRUCTION(R_CASE):
+				if (fabs(numbers[code[pc + 1]] - numbers[code[pc + 2]]) < ERROR_BOUND)
+					pc += 4;
+				else
+					pc = code[pc + 3];
+				NEXT;
+
+			INSTRUCTION(R_HALT):
+				return;
+		}
+
+		continue;
+
+	fallback:
+		// The AST evaluates again the expression or the statement of the instruction
+		pc = this->fallback(pc);
+	}
+}
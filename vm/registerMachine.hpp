@@ -0,0 +1,94 @@
+/*!
+	\file    registerMachine.hpp
+	\brief   Declaration of the register machine
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _REGISTERMACHINE_HPP_
+#define _REGISTERMACHINE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "registerCode.hpp"
+#include "jit.hpp"
+
+#include "../table/variable.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class RegisterMachine
+  \brief Interpreter of the code of a RegisterChunk
+  \note  There is one file of registers for each type, so the registers
+         hold plain values without tags. The errors are reported by the AST:
+         when an instruction finds a value that it cannot handle, the
+         expression or the statement that contains it is evaluated again.
+*/
+class RegisterMachine
+{
+	private:
+		const lp::RegisterChunk *_chunk;           //!< Code to be run
+		std::vector<double> _numbers;              //!< Registers of type NUMBER
+		std::vector<char> _bools;                  //!< Registers of type BOOL, not packed as std::vector<bool>
+		std::vector<std::string> _strings;         //!< Registers of type STRING
+		std::vector<lp::Variable *> _loops;        //!< Variables of the for statements, by nesting depth
+		std::vector<int> _generations;             //!< Generations of the for statements, given by Variable::arm
+		lp::Jit *_jit;                             //!< Machine code of the loops, NULL if there is none
+
+	public:
+
+	/*!
+		\brief Constructor of RegisterMachine
+		\param chunk: code to be run
+		\param jit: machine code of the loops of chunk, NULL to interpret all of them
+		\post  The constants are loaded after the temporary registers
+	*/
+		RegisterMachine(const lp::RegisterChunk *chunk, lp::Jit *jit = NULL);
+
+	/*!
+		\brief   Run the code until R_HALT
+		\param   start: address of the first instruction
+		\return  void
+	*/
+		void run(int start = 0);
+
+	/*!
+		\brief   Go on with a for statement compiled alone from the test of its next iteration
+		\param   loopVar: variable of the loop, already incremented
+		\param   generation: generation of the loop, given by Variable::arm
+		\param   step: step of the loop
+		\return  void
+		\pre     The chunk has been compiled from a single ForStmt
+	*/
+		void resume(lp::Variable *loopVar, int generation, double step);
+
+	private:
+
+	/*!
+		\brief   Evaluate again the expression or the statement that contains an instruction
+		\param   pc: address of the instruction
+		\return  int: address of the first instruction after the expression or the statement
+	*/
+		int fallback(int pc);
+
+	/*!
+		\name Assignments that mirror the ones of the AST
+	*/
+		void storeNumber(int slot, double value);
+		void storeBool(int slot, bool value);
+		void storeString(int slot, std::string const & value);
+};
+
+// End of name space lp
+}
+
+// End of _REGISTERMACHINE_HPP_
+#endif
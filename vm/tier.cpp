@@ -0,0 +1,153 @@
+/*!
+	\file    tier.cpp
+	\brief   Code of the functions of the LoopTier class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <string>
+
+#include "tier.hpp"
+#include "registerCompiler.hpp"
+
+
+/*!
+  \brief  Name of a loop in the reports
+*/
+static std::string kindOf(lp::Statement *loop)
+{
+	if (dynamic_cast<lp::WhileStmt *>(loop))
+		return "while";
+
+	if (dynamic_cast<lp::DoWhileStmt *>(loop))
+		return "do-while";
+
+	if (dynamic_cast<lp::RepeatStmt *>(loop))
+		return "repeat";
+
+	return "for";
+}
+
+
+/*!
+  \brief  Check if an instruction only escapes to the AST or jumps
+*/
+static bool isEscape(int opcode)
+{
+	switch (opcode)
+	{
+		case lp::R_FALLBACK:
+		case lp::R_EVAL_NUMBER:
+		case lp::R_EVAL_BOOL:
+		case lp::R_EVAL_STRING:
+		case lp::R_EXECUTE:
+		case lp::R_JUMP:
+		case lp::R_JUMP_IF_FALSE:
+		case lp::R_JUMP_IF_TRUE:
+		case lp::R_HALT:
+			return true;
+	}
+
+	return false;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+lp::LoopTier::~LoopTier()
+{
+	for (std::map<lp::Statement *, Promotion *>::iterator it = this->_promotions.begin(); it != this->_promotions.end(); ++it)
+	{
+		delete it->second->machine;
+		delete it->second->jit;
+		delete it->second;
+	}
+}
+
+
+bool lp::LoopTier::promote(lp::Statement *loop)
+{
+	Promotion *promotion = new Promotion;
+	lp::RegisterCompiler compiler(&promotion->chunk);
+
+	compiler.compile(loop);
+
+	// A loop whose instructions only hand its statements back to the AST would run slower
+	const std::vector<int> & code = promotion->chunk.getCode();
+	int instructions = 0;
+	bool faster = false;
+
+	for (size_t pc = 0; pc < code.size(); pc += lp::RegisterChunk::length(code[pc]))
+	{
+		instructions++;
+
+		if (not isEscape(code[pc]))
+			faster = true;
+	}
+
+	if (not faster)
+	{
+		if (this->_verbose)
+			std::cerr << "tier: " << kindOf(loop) << " loop of line " << loop->_lineNumber
+			          << " stays in the AST: all its statements are evaluated by the AST" << std::endl;
+
+		delete promotion;
+		return false;
+	}
+
+	promotion->jit = this->_translate ? new lp::Jit(&promotion->chunk) : NULL;
+	promotion->machine = new lp::RegisterMachine(&promotion->chunk, promotion->jit);
+	promotion->runs = 0;
+
+	this->_promotions[loop] = promotion;
+	this->_order.push_back(loop);
+
+	if (this->_verbose)
+	{
+		std::cerr << "tier: " << kindOf(loop) << " loop of line " << loop->_lineNumber << " promoted after "
+		          << loop->_iterations << " iterations: " << instructions << " instructions";
+
+		if (promotion->jit != NULL)
+			std::cerr << ", " << promotion->jit->getCompiled() << " loops as machine code";
+
+		std::cerr << std::endl;
+	}
+
+	return true;
+}
+
+
+void lp::LoopTier::run(lp::Statement *loop)
+{
+	Promotion *promotion = this->_promotions[loop];
+
+	promotion->runs++;
+	promotion->machine->run();
+}
+
+
+void lp::LoopTier::resume(lp::Statement *loop, lp::Variable *loopVar, int generation, double step)
+{
+	Promotion *promotion = this->_promotions[loop];
+
+	promotion->runs++;
+	promotion->machine->resume(loopVar, generation, step);
+}
+
+
+void lp::LoopTier::report() const
+{
+	if (not this->_verbose)
+		return;
+
+	for (size_t i = 0; i < this->_order.size(); i++)
+	{
+		lp::Statement *loop = this->_order[i];
+
+		std::cerr << "tier: " << kindOf(loop) << " loop of line " << loop->_lineNumber << " run "
+		          << this->_promotions.find(loop)->second->runs << " times by the register machine" << std::endl;
+	}
+}
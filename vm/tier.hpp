@@ -0,0 +1,130 @@
+/*!
+	\file    tier.hpp
+	\brief   Declaration of the tier that runs the hot loops of the AST
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _TIER_HPP_
+#define _TIER_HPP_
+
+#include <map>
+#include <vector>
+
+#include "../ast/ast.hpp"
+
+#include "registerCode.hpp"
+#include "registerMachine.hpp"
+#include "jit.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \class LoopTier
+  \brief Register machine, with its numeric loops as machine code, for the loops that get hot in the AST
+  \note  The program starts in the AST, so the cold code costs nothing to
+         compile. A loop is compiled alone to register code when it reaches
+         the threshold; the variables stay in the table of symbols, so the
+         register machine goes on from the state left by the AST, with the
+         variable and the step of a for statement handed over. The loops
+         whose statements would all be evaluated by the AST again stay there.
+*/
+class LoopTier: public lp::Tier
+{
+	private:
+
+	/*!
+	  \struct Promotion
+	  \brief  Code of a promoted loop
+	*/
+		struct Promotion
+		{
+			lp::RegisterChunk chunk;        //!< Register code of the loop
+			lp::Jit *jit;                   //!< Machine code of its numeric loops, NULL without translation
+			lp::RegisterMachine *machine;   //!< Machine that runs the chunk
+			unsigned long runs;             //!< Times the loop has been run by the tier
+		};
+
+		unsigned long _threshold;                               //!< Iterations before a loop is promoted
+		bool _translate;                                        //!< Translate the numeric loops to machine code
+		bool _verbose;                                          //!< Report the decisions on the standard error
+		std::map<lp::Statement *, Promotion *> _promotions;     //!< Code of each promoted loop
+		std::vector<lp::Statement *> _order;                    //!< Promoted loops, in the order of their promotion
+
+	public:
+
+	/*!
+		\brief Constructor of LoopTier
+		\param threshold: iterations run by the AST before a loop is promoted
+		\param translate: translate the numeric loops of the promoted code to machine code
+		\param verbose: report the promotions and the loops that stay in the AST
+	*/
+		LoopTier(unsigned long threshold, bool translate, bool verbose):
+			_threshold(threshold), _translate(translate), _verbose(verbose)
+		{
+			// Empty
+		}
+
+	/*!
+		\brief Destructor
+		\post  The code of the promoted loops is released
+	*/
+		~LoopTier();
+
+	/*!
+		\brief   Iterations run by the AST before a loop is promoted
+		\return  unsigned long
+	*/
+		inline unsigned long getThreshold() const
+		{
+			return this->_threshold;
+		}
+
+	/*!
+		\brief   Compile a hot loop to register code
+		\param   loop: WhileStmt, DoWhileStmt, RepeatStmt or ForStmt
+		\return  bool: false if the loop stays in the AST
+	*/
+		bool promote(lp::Statement *loop);
+
+	/*!
+		\brief   Run a promoted loop in the register machine
+		\param   loop: statement accepted by promote
+		\return  void
+	*/
+		void run(lp::Statement *loop);
+
+	/*!
+		\brief   Go on with a promoted for statement in the register machine
+		\param   loop: ForStmt accepted by promote
+		\param   loopVar: variable of the loop, already incremented
+		\param   generation: generation of the loop, given by Variable::arm
+		\param   step: step of the loop
+		\return  void
+	*/
+		void resume(lp::Statement *loop, lp::Variable *loopVar, int generation, double step);
+
+	/*!
+		\brief   Print the number of runs of each promoted loop, if verbose
+		\return  void
+	*/
+		void report() const;
+
+	private:
+
+	// Copying a LoopTier would release its code twice
+		LoopTier(LoopTier const &);
+		LoopTier & operator=(LoopTier const &);
+};
+
+// End of name space lp
+}
+
+// End of _TIER_HPP_
+#endif
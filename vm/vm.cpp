@@ -0,0 +1,755 @@
+/*!
+	\file    vm.cpp
+	\brief   Code of the functions of the VirtualMachine class
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#include <iostream>
+#include <string>
+#include <cmath>
+
+#include "vm.hpp"
+
+#include "../table/table.hpp"
+#include "../table/variable.hpp"
+
+#include "../includes/globals.hpp"
+#include "../includes/macros.hpp"
+
+#include "../parser/interpreter.tab.h"
+
+#include "dispatch.hpp"
+
+
+extern lp::Table table; //!< Reference to the Table of Symbols
+
+
+/*!
+  \brief The expression of the root is evaluated by the AST and the bytecode goes on after it
+*/
+#define FALLBACK(r)                                               \
+	{                                                             \
+		const lp::Root & root = roots[r];                         \
+		sp = root.depth;                                          \
+		this->evaluate(root.node, root.type, stack[sp]);          \
+		sp++;                                                     \
+		pc = root.resume;                                         \
+		NEXT;                                                     \
+	}
+
+
+lp::VirtualMachine::VirtualMachine(const lp::Chunk *chunk): _chunk(chunk)
+{
+	// The depth of the stack is known when the program is compiled
+	this->_stack.resize(chunk->getMaxStack() + 1);
+}
+
+
+void lp::VirtualMachine::evaluate(lp::ExpNode *node, int type, lp::StackValue & value)
+{
+	// Same order as the statements of the AST: the type first, then the value
+	if (type == 0)
+		type = node->getType();
+
+	value.type = type;
+
+	switch (type)
+	{
+		case NUMBER:
+			value.number = node->evaluateNumber();
+			break;
+		case BOOL:
+			value.logic = node->evaluateBool();
+			break;
+		case STRING:
+			value.string = node->evaluateString();
+			break;
+	}
+}
+
+
+void lp::VirtualMachine::storeNumber(int slot, double value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != NUMBER)
+	{
+		var->retype(NUMBER);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setNumber(value);
+}
+
+
+void lp::VirtualMachine::storeBool(int slot, bool value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != BOOL)
+	{
+		var->retype(BOOL);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setLogical(value);
+}
+
+
+void lp::VirtualMachine::storeString(int slot, std::string const & value)
+{
+	lp::Variable *var = (lp::Variable *) table.getSymbol(slot);
+
+	// The variable is retyped in place: its address does not change
+	if (var->getType() != STRING)
+	{
+		var->retype(STRING);
+		// The expressions that use the variable may change their type
+		typeEpoch++;
+	}
+
+	var->setString(value);
+}
+
+
+void lp::VirtualMachine::run()
+{
+	const int *code = &this->_chunk->getCode()[0];
+	const std::vector<double> & numbers = this->_chunk->getNumbers();
+	const std::vector<std::string> & strings = this->_chunk->getStrings();
+	const std::vector<lp::ExpNode *> & nodes = this->_chunk->getNodes();
+	const std::vector<lp::Statement *> & statements = this->_chunk->getStatements();
+	const std::vector<lp::Root> & roots = this->_chunk->getRoots();
+
+	lp::StackValue *stack = &this->_stack[0];
+	int sp = 0;   // First free position of the stack
+	int pc = 0;   // Next instruction
+
+#ifdef COMPUTED_GOTO
+	// Address of the code of every instruction, in the order of OpCode
+	static const void *labels[] =
+	{
+		&&L_OP_PUSH_NUMBER, &&L_OP_PUSH_STRING, &&L_OP_PUSH_TRUE, &&L_OP_PUSH_FALSE, &&L_OP_LOAD,
+		&&L_OP_LOAD_NUMBER, &&L_OP_LOAD_BOOL, &&L_OP_LOAD_STRING, &&L_OP_POP, &&L_OP_FALLBACK,
+		&&L_OP_EVAL, &&L_OP_EVAL_NUMBER, &&L_OP_EVAL_BOOL, &&L_OP_EVAL_STRING, &&L_OP_EXECUTE,
+		&&L_OP_NEGATE, &&L_OP_INCREMENT, &&L_OP_DECREMENT, &&L_OP_FACTORIAL, &&L_OP_ADD, &&L_OP_SUBTRACT,
+		&&L_OP_MULTIPLY, &&L_OP_DIVIDE, &&L_OP_INTEGER_DIVIDE, &&L_OP_MODULO, &&L_OP_POWER,
+		&&L_OP_CALL_0, &&L_OP_CALL_1, &&L_OP_CALL_2, &&L_OP_CONCATENATE, &&L_OP_GREATER,
+		&&L_OP_GREATER_EQUAL, &&L_OP_LESS, &&L_OP_LESS_EQUAL, &&L_OP_EQUAL, &&L_OP_NOT_EQUAL, &&L_OP_AND,
+		&&L_OP_OR, &&L_OP_NOT, &&L_OP_STORE, &&L_OP_COPY, &&L_OP_PLUS_ASSIGN, &&L_OP_MINUS_ASSIGN,
+		&&L_OP_APPEND, &&L_OP_PRINT, &&L_OP_READ, &&L_OP_READ_STRING, &&L_OP_INCREMENT_VARIABLE,
+		&&L_OP_DECREMENT_VARIABLE, &&L_OP_FACTORIAL_VARIABLE, &&L_OP_CLEAR_SCREEN, &&L_OP_JUMP,
+		&&L_OP_JUMP_IF_FALSE, &&L_OP_JUMP_IF_TRUE, &&L_OP_CHECK_NUMBER, &&L_OP_FOR_INTERVAL,
+		&&L_OP_FOR_VARIABLE, &&L_OP_FOR_STEP, &&L_OP_FOR_TEST, &&L_OP_FOR_NEXT, &&L_OP_CASE, &&L_OP_HALT
+	};
+#endif
+
+	for (;;)
+	{
+		DISPATCH
+		{
+			////////////////////////////////////////////
+			// Constants and variables
+
+			INSTRUCTION(OP_PUSH_NUMBER):
+				stack[sp].type = NUMBER;
+				stack[sp].number = numbers[code[pc + 1]];
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_PUSH_STRING):
+				stack[sp].type = STRING;
+				stack[sp].string = strings[code[pc + 1]];
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_PUSH_TRUE):
+			INSTRUCTION(OP_PUSH_FALSE):
+				stack[sp].type = BOOL;
+				stack[sp].logic = (code[pc] == OP_PUSH_TRUE);
+				sp++;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_LOAD):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				stack[sp].type = var->getType();
+
+				if (stack[sp].type == NUMBER)
+					stack[sp].number = var->getNumber();
+				else if (stack[sp].type == BOOL)
+					stack[sp].logic = var->getLogical();
+				else if (stack[sp].type == STRING)
+					stack[sp].string = var->getString();
+
+				sp++;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_LOAD_NUMBER):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if (var->getType() != NUMBER)
+					FALLBACK(code[pc + 2]);
+
+				stack[sp].type = NUMBER;
+				stack[sp].number = var->getNumber();
+				sp++;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_LOAD_BOOL):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if (var->getType() != BOOL)
+					FALLBACK(code[pc + 2]);
+
+				stack[sp].type = BOOL;
+				stack[sp].logic = var->getLogical();
+				sp++;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_LOAD_STRING):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if (var->getType() != STRING)
+					FALLBACK(code[pc + 2]);
+
+				stack[sp].type = STRING;
+				stack[sp].string = var->getString();
+				sp++;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_POP):
+				sp--;
+				pc++;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Escapes to the AST
+
+			INSTRUCTION(OP_FALLBACK):
+				FALLBACK(code[pc + 1]);
+
+			INSTRUCTION(OP_EVAL):
+				this->evaluate(nodes[code[pc + 1]], 0, stack[sp]);
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_EVAL_NUMBER):
+				this->evaluate(nodes[code[pc + 1]], NUMBER, stack[sp]);
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_EVAL_BOOL):
+				this->evaluate(nodes[code[pc + 1]], BOOL, stack[sp]);
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_EVAL_STRING):
+				this->evaluate(nodes[code[pc + 1]], STRING, stack[sp]);
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_EXECUTE):
+				statements[code[pc + 1]]->evaluate();
+				pc += 2;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Numeric operators
+
+			INSTRUCTION(OP_NEGATE):
+				stack[sp - 1].number = - stack[sp - 1].number;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_INCREMENT):
+				stack[sp - 1].number++;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_DECREMENT):
+				stack[sp - 1].number--;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_FACTORIAL):
+			{
+				double value = stack[sp - 1].number;
+
+				if (value < 0 || floor(value) != value)
+					FALLBACK(code[pc + 1]);
+
+				double result = 1.0;
+				for (int i = 1; i <= (int) value; ++i)
+					result *= i;
+
+				stack[sp - 1].number = result;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_ADD):
+				sp--;
+				stack[sp - 1].number += stack[sp].number;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_SUBTRACT):
+				sp--;
+				stack[sp - 1].number -= stack[sp].number;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_MULTIPLY):
+				sp--;
+				stack[sp - 1].number *= stack[sp].number;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_DIVIDE):
+				if (std::abs(stack[sp - 1].number) <= ERROR_BOUND)
+					FALLBACK(code[pc + 1]);
+
+				sp--;
+				stack[sp - 1].number /= stack[sp].number;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_INTEGER_DIVIDE):
+			{
+				int leftInt = static_cast<int>(stack[sp - 2].number);
+				int rightInt = static_cast<int>(stack[sp - 1].number);
+
+				if ((std::abs(stack[sp - 1].number) <= ERROR_BOUND) or (rightInt == 0))
+					FALLBACK(code[pc + 1]);
+
+				sp--;
+				stack[sp - 1].number = static_cast<double>(leftInt / rightInt);
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_MODULO):
+				if (std::abs(stack[sp - 1].number) <= ERROR_BOUND)
+					FALLBACK(code[pc + 1]);
+
+				sp--;
+				stack[sp - 1].number = (int) stack[sp - 1].number % (int) stack[sp].number;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_POWER):
+				sp--;
+				stack[sp - 1].number = pow(stack[sp - 1].number, stack[sp].number);
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_CALL_0):
+				stack[sp].type = NUMBER;
+				stack[sp].number = this->_chunk->getFunctions0()[code[pc + 1]]();
+				sp++;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_CALL_1):
+				stack[sp - 1].number = this->_chunk->getFunctions1()[code[pc + 1]](stack[sp - 1].number);
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_CALL_2):
+				sp--;
+				stack[sp - 1].number = this->_chunk->getFunctions2()[code[pc + 1]](stack[sp - 1].number, stack[sp].number);
+				pc += 2;
+				NEXT;
+
+			////////////////////////////////////////////
+			// String, relational and logical operators
+
+			INSTRUCTION(OP_CONCATENATE):
+				sp--;
+				stack[sp - 1].string += stack[sp].string;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_GREATER):
+			INSTRUCTION(OP_GREATER_EQUAL):
+			INSTRUCTION(OP_LESS):
+			INSTRUCTION(OP_LESS_EQUAL):
+			INSTRUCTION(OP_EQUAL):
+			INSTRUCTION(OP_NOT_EQUAL):
+			{
+				lp::StackValue & left = stack[sp - 2];
+				lp::StackValue & right = stack[sp - 1];
+				bool result = false;
+
+				// Both operands must have the same valid type
+				if (left.type != right.type)
+					FALLBACK(code[pc + 1]);
+
+				if (left.type == NUMBER)
+				{
+					switch (code[pc])
+					{
+						case OP_GREATER:       result = (left.number > right.number); break;
+						case OP_GREATER_EQUAL: result = (left.number >= right.number); break;
+						case OP_LESS:          result = (left.number < right.number); break;
+						case OP_LESS_EQUAL:    result = (left.number <= right.number); break;
+						// ERROR_BOUND to control the precision of real numbers
+						case OP_EQUAL:         result = (std::abs(left.number - right.number) < ERROR_BOUND); break;
+						case OP_NOT_EQUAL:     result = (std::abs(left.number - right.number) >= ERROR_BOUND); break;
+					}
+				}
+				else if (left.type == BOOL)
+				{
+					switch (code[pc])
+					{
+						case OP_GREATER:       result = (left.logic > right.logic); break;
+						case OP_GREATER_EQUAL: result = (left.logic >= right.logic); break;
+						case OP_LESS:          result = (left.logic < right.logic); break;
+						case OP_LESS_EQUAL:    result = (left.logic <= right.logic); break;
+						case OP_EQUAL:         result = (left.logic == right.logic); break;
+						case OP_NOT_EQUAL:     result = (left.logic != right.logic); break;
+					}
+				}
+				else if (left.type == STRING)
+				{
+					switch (code[pc])
+					{
+						case OP_GREATER:       result = (left.string > right.string); break;
+						case OP_GREATER_EQUAL: result = (left.string >= right.string); break;
+						case OP_LESS:          result = (left.string < right.string); break;
+						case OP_LESS_EQUAL:    result = (left.string <= right.string); break;
+						case OP_EQUAL:         result = (left.string == right.string); break;
+						case OP_NOT_EQUAL:     result = (left.string != right.string); break;
+					}
+				}
+				else
+					FALLBACK(code[pc + 1]);
+
+				sp--;
+				stack[sp - 1].type = BOOL;
+				stack[sp - 1].logic = result;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_AND):
+				sp--;
+				stack[sp - 1].logic = stack[sp - 1].logic and stack[sp].logic;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_OR):
+				sp--;
+				stack[sp - 1].logic = stack[sp - 1].logic or stack[sp].logic;
+				pc++;
+				NEXT;
+
+			INSTRUCTION(OP_NOT):
+				stack[sp - 1].logic = not stack[sp - 1].logic;
+				pc++;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Statements
+
+			INSTRUCTION(OP_STORE):
+			{
+				lp::StackValue & value = stack[sp - 1];
+
+				if (value.type == NUMBER)
+					this->storeNumber(code[pc + 1], value.number);
+				else if (value.type == BOOL)
+					this->storeBool(code[pc + 1], value.logic);
+				else if (value.type == STRING)
+					this->storeString(code[pc + 1], value.string);
+				else
+					// The AST reports the error
+					statements[code[pc + 2]]->evaluate();
+
+				sp--;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_COPY):
+			{
+				lp::Variable *second = (lp::Variable *) table.getSymbol(code[pc + 2]);
+
+				// Only numeric and logical variables are copied
+				if (second->getType() == NUMBER)
+					this->storeNumber(code[pc + 1], second->getNumber());
+				else if (second->getType() == BOOL)
+					this->storeBool(code[pc + 1], second->getLogical());
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_PLUS_ASSIGN):
+			INSTRUCTION(OP_MINUS_ASSIGN):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if ((stack[sp - 1].type == NUMBER) and (var->getType() == NUMBER))
+				{
+					lp::Variable *n = var;
+
+					if (code[pc] == OP_PLUS_ASSIGN)
+						n->setNumber(n->getNumber() + stack[sp - 1].number);
+					else
+						n->setNumber(n->getNumber() - stack[sp - 1].number);
+				}
+				else
+					// The AST reports the error
+					statements[code[pc + 2]]->evaluate();
+
+				sp--;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_APPEND):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				// The string of the variable is not copied
+				if ((stack[sp - 1].type == STRING) and (var->getType() == STRING))
+					var->append(stack[sp - 1].string);
+				else
+					// The AST reports the error
+					statements[code[pc + 2]]->evaluate();
+
+				sp--;
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_PRINT):
+			{
+				lp::StackValue & value = stack[sp - 1];
+
+				if (value.type == NUMBER)
+					std::cout << value.number << std::endl;
+				else if (value.type == BOOL)
+					std::cout << (value.logic ? "true" : "false") << std::endl;
+				else if (value.type == STRING)
+					std::cout << value.string << std::endl;
+				else
+					// The AST reports the error
+					statements[code[pc + 1]]->evaluate();
+
+				sp--;
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_READ):
+			{
+				double value;
+				std::cin >> value;
+
+				this->storeNumber(code[pc + 1], value);
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_READ_STRING):
+			{
+				std::string value;
+				std::cin >> value;
+
+				this->storeString(code[pc + 1], value);
+				pc += 2;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_INCREMENT_VARIABLE):
+			INSTRUCTION(OP_DECREMENT_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+
+				if ((var != NULL) and (var->getType() == NUMBER))
+				{
+					lp::Variable *n = var;
+
+					n->setNumber(n->getNumber() + ((code[pc] == OP_INCREMENT_VARIABLE) ? 1 : -1));
+				}
+				else
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_FACTORIAL_VARIABLE):
+			{
+				lp::Variable *var = (lp::Variable *) table.getSymbol(code[pc + 1]);
+				bool valid = (var != NULL) and (var->getType() == NUMBER);
+
+				if (valid)
+				{
+					lp::Variable *n = var;
+					double value = n->getNumber();
+
+					if (value < 0 || value != static_cast<int>(value))
+						valid = false;
+					else
+					{
+						int result = 1;
+						for (int i = 2; i <= static_cast<int>(value); ++i)
+							result *= i;
+
+						n->setNumber(result);
+					}
+				}
+
+				if (not valid)
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_CLEAR_SCREEN):
+				std::cout << CLEAR_SCREEN_TEXT;
+				pc++;
+				NEXT;
+
+			////////////////////////////////////////////
+			// Control flow
+
+			INSTRUCTION(OP_JUMP):
+				pc = code[pc + 1];
+				NEXT;
+
+			INSTRUCTION(OP_JUMP_IF_FALSE):
+				sp--;
+				pc = stack[sp].logic ? pc + 2 : code[pc + 1];
+				NEXT;
+
+			INSTRUCTION(OP_JUMP_IF_TRUE):
+				sp--;
+				pc = stack[sp].logic ? code[pc + 1] : pc + 2;
+				NEXT;
+
+			INSTRUCTION(OP_CHECK_NUMBER):
+				if (nodes[code[pc + 1]]->getType() != NUMBER)
+					statements[code[pc + 2]]->evaluate();
+
+				pc += 3;
+				NEXT;
+
+			INSTRUCTION(OP_FOR_INTERVAL):
+				// to < from
+				if (stack[sp - 2].number < stack[sp - 1].number)
+					statements[code[pc + 1]]->evaluate();
+
+				sp -= 2;
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_FOR_VARIABLE):
+			{
+				int slot = code[pc + 1];
+				lp::Variable *symbol = (lp::Variable *) table.getSymbol(slot);
+				lp::Variable *loopVar;
+
+				if (symbol == NULL)
+				{
+					loopVar = new lp::Variable(this->_chunk->getName(slot), VARIABLE, NUMBER);
+					table.installSymbol(loopVar);
+				}
+				else
+				{
+					if (symbol->getType() != NUMBER)
+					{
+						symbol->retype(NUMBER);
+						// The expressions that use the variable may change their type
+						typeEpoch++;
+					}
+
+					loopVar = symbol;
+				}
+
+				loopVar->setNumber(stack[sp - 1].number);
+
+				// The loop variable replaces "from" on the stack
+				stack[sp - 1].variable = loopVar;
+				stack[sp - 1].generation = loopVar->arm();
+				pc += 3;
+			}
+			NEXT;
+
+			INSTRUCTION(OP_FOR_STEP):
+				if (stack[sp - 1].number <= ERROR_BOUND)
+					statements[code[pc + 1]]->evaluate();
+
+				pc += 2;
+				NEXT;
+
+			INSTRUCTION(OP_FOR_TEST):
+				// Stack: variable, step, to
+				sp--;
+				if (stack[sp - 2].variable->getNumber() <= stack[sp].number)
+					pc += 2;
+				else
+				{
+					stack[sp - 2].variable->disarm();
+					pc = code[pc + 1];
+				}
+				NEXT;
+
+			INSTRUCTION(OP_FOR_NEXT):
+			{
+				// The body may have detached the loop from its variable
+				lp::Variable *loopVar = stack[sp - 2].variable->counter(stack[sp - 2].generation);
+
+				stack[sp - 2].variable = loopVar;
+				loopVar->setNumber(loopVar->getNumber() + stack[sp - 1].number);
+				pc = code[pc + 1];
+			}
+			NEXT;
+
+			INSTRUCTION(OP_CASE):
+				sp--;
+				if (fabs(stack[sp - 1].number - stack[sp].number) < ERROR_BOUND)
+				{
+					// The value of the switch is not needed any more
+					sp--;
+					pc += 2;
+				}
+				else
+					pc = code[pc + 1];
+				NEXT;
+
+			INSTRUCTION(OP_HALT):
+				return;
+		}
+	}
+}
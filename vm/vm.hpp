@@ -0,0 +1,91 @@
+/*!
+	\file    vm.hpp
+	\brief   Declaration of the stack virtual machine
+	\author
+	\date    2025-06-06
+	\version 1.0
+*/
+
+#ifndef _VM_HPP_
+#define _VM_HPP_
+
+#include <string>
+#include <vector>
+
+#include "bytecode.hpp"
+
+#include "../table/variable.hpp"
+
+
+/*!
+	\namespace lp
+	\brief Name space for the subject Language Processors
+*/
+namespace lp{
+
+/*!
+  \struct StackValue
+  \brief  Value stored in the stack of the virtual machine
+*/
+struct StackValue
+{
+	int type;                        //!< NUMBER, BOOL, STRING or the type of an invalid variable
+	double number;                   //!< Value of a NUMBER
+	bool logic;                      //!< Value of a BOOL
+	std::string string;              //!< Value of a STRING
+	lp::Variable *variable;          //!< Variable of a for statement
+	int generation;                  //!< Generation of the for statement, given by Variable::arm
+};
+
+
+/*!
+  \class VirtualMachine
+  \brief Interpreter of the bytecode of a Chunk
+  \note  The errors are reported by the AST: when an instruction finds
+         a value that it cannot handle, the expression or the statement
+         that has been compiled into it is evaluated again by the AST.
+*/
+class VirtualMachine
+{
+	private:
+		const lp::Chunk *_chunk;              //!< Bytecode to be run
+		std::vector<lp::StackValue> _stack;   //!< Stack of values
+
+	public:
+
+	/*!
+		\brief Constructor of VirtualMachine
+		\param chunk: bytecode to be run
+	*/
+		VirtualMachine(const lp::Chunk *chunk);
+
+	/*!
+		\brief   Run the bytecode until OP_HALT
+		\return  void
+	*/
+		void run();
+
+	private:
+
+	/*!
+		\brief   Evaluate an expression with the AST
+		\param   node: expression
+		\param   type: NUMBER, BOOL, STRING or 0 to use the type of the expression
+		\param   value: result
+		\return  void
+	*/
+		void evaluate(lp::ExpNode *node, int type, lp::StackValue & value);
+
+	/*!
+		\name Assignments that mirror the ones of the AST
+	*/
+		void storeNumber(int slot, double value);
+		void storeBool(int slot, bool value);
+		void storeString(int slot, std::string const & value);
+};
+
+// End of name space lp
+}
+
+// End of _VM_HPP_
+#endif